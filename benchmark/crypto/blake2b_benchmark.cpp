@@ -0,0 +1,77 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "crypto/blake2/blake2b.h"
+
+namespace {
+
+  std::vector<uint8_t> makeData(size_t size) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+    return data;
+  }
+
+  /// Blake2b-256 of an input, like a block header or runtime code
+  void Blake2b256(benchmark::State &state) {
+    auto data = makeData(state.range(0));
+    uint8_t out[32];
+    for (auto _ : state) {
+      blake2b(out, sizeof(out), nullptr, 0, data.data(), data.size());
+      benchmark::DoNotOptimize(out);
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+  }
+
+  /// Blake2b-256 of 16 inputs of the same size one by one, like children of
+  /// a trie branch
+  void Blake2b256_OneByOne(benchmark::State &state) {
+    auto data = makeData(state.range(0) * 16);
+    uint8_t out[16][32];
+    for (auto _ : state) {
+      for (size_t i = 0; i < 16; ++i) {
+        blake2b(out[i],
+                sizeof(out[i]),
+                nullptr,
+                0,
+                data.data() + i * state.range(0),
+                state.range(0));
+      }
+      benchmark::DoNotOptimize(out);
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+  }
+
+  /// Same as Blake2b256_OneByOne with blake2b_many
+  void Blake2b256_Many(benchmark::State &state) {
+    auto data = makeData(state.range(0) * 16);
+    uint8_t out[16][32];
+    uint8_t *outs[16];
+    const uint8_t *ins[16];
+    size_t lens[16];
+    for (size_t i = 0; i < 16; ++i) {
+      outs[i] = out[i];
+      ins[i] = data.data() + i * state.range(0);
+      lens[i] = state.range(0);
+    }
+    for (auto _ : state) {
+      blake2b_many(outs, 32, ins, lens, 16);
+      benchmark::DoNotOptimize(out);
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+  }
+
+}  // namespace
+
+BENCHMARK(Blake2b256)->Range(32, 2 << 20);
+
+// trie nodes from short leaves to full branches
+BENCHMARK(Blake2b256_OneByOne)->RangeMultiplier(2)->Range(32, 1024);
+BENCHMARK(Blake2b256_Many)->RangeMultiplier(2)->Range(32, 1024);
@@ -0,0 +1,87 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <array>
+#include <cstring>
+
+#include <benchmark/benchmark.h>
+#include <xxhash/xxhash.h>
+
+#include "crypto/twox/twox.hpp"
+
+using kagome::common::Buffer;
+using kagome::common::Hash256;
+using kagome::crypto::make_twox128;
+using kagome::crypto::make_twox256;
+
+namespace {
+
+  /**
+   * Calculates the hash the way make_twox256 used to: passes the data once
+   * per seed. Serves as a baseline
+   */
+  Hash256 twox256PerSeed(const Buffer &data) {
+    Hash256 hash;
+    for (uint64_t seed = 0; seed < 4; ++seed) {
+      auto h = XXH64(data.data(), data.size(), seed);
+      std::memcpy(hash.data() + seed * sizeof(h), &h, sizeof(h));
+    }
+    return hash;
+  }
+
+  /// Same as twox256PerSeed for 2 seeds
+  std::array<uint64_t, 2> twox128PerSeed(const Buffer &data) {
+    return {XXH64(data.data(), data.size(), 0),
+            XXH64(data.data(), data.size(), 1)};
+  }
+
+  Buffer makeData(size_t size) {
+    Buffer data(size, 0);
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+    return data;
+  }
+
+  void Twox128_PerSeed(benchmark::State &state) {
+    auto data = makeData(state.range(0));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(twox128PerSeed(data));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+  }
+
+  void Twox128_OnePass(benchmark::State &state) {
+    auto data = makeData(state.range(0));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(make_twox128(data));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+  }
+
+  void Twox256_PerSeed(benchmark::State &state) {
+    auto data = makeData(state.range(0));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(twox256PerSeed(data));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+  }
+
+  void Twox256_OnePass(benchmark::State &state) {
+    auto data = makeData(state.range(0));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(make_twox256(data));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+  }
+
+}  // namespace
+
+// from storage keys to runtime code
+BENCHMARK(Twox128_PerSeed)->Range(16, 2 << 20);
+BENCHMARK(Twox128_OnePass)->Range(16, 2 << 20);
+
+BENCHMARK(Twox256_PerSeed)->Range(16, 2 << 20);
+BENCHMARK(Twox256_OnePass)->Range(16, 2 << 20);
@@ -0,0 +1,167 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "mock/core/host_api/host_api_factory_mock.hpp"
+#include "mock/core/host_api/host_api_mock.hpp"
+#include "mock/core/runtime/binaryen_wasm_memory_factory_mock.hpp"
+#include "mock/core/runtime/trie_storage_provider_mock.hpp"
+#include "runtime/binaryen/runtime_external_interface.hpp"
+
+using kagome::host_api::HostApi;
+using kagome::host_api::HostApiFactoryMock;
+using kagome::host_api::HostApiMock;
+using kagome::runtime::TrieStorageProviderMock;
+using kagome::runtime::WasmOffset;
+using kagome::runtime::WasmSpan;
+using kagome::runtime::binaryen::BinaryenWasmMemoryFactoryMock;
+using kagome::runtime::binaryen::RuntimeExternalInterface;
+using testing::_;
+using testing::ByMove;
+using testing::NiceMock;
+using testing::Return;
+
+namespace {
+
+  /**
+   * Host API which storage functions do nothing, so that only the cost of
+   * getting from the runtime to the host function is measured
+   */
+  class NoopHostApi final : public HostApiMock {
+   public:
+    WasmSpan ext_storage_get_version_1(WasmSpan key) override {
+      return key;
+    }
+
+    WasmSpan ext_storage_read_version_1(WasmSpan key,
+                                        WasmSpan value_out,
+                                        WasmOffset offset) override {
+      return key + value_out + offset;
+    }
+  };
+
+  struct Fixture {
+    Fixture() {
+      auto host_api = std::make_unique<NoopHostApi>();
+      api = host_api.get();
+      auto host_api_factory = std::make_shared<HostApiFactoryMock>();
+      EXPECT_CALL(*host_api_factory, make(_, _, _, _))
+          .WillOnce(Return(ByMove(std::move(host_api))));
+      rei = std::make_unique<RuntimeExternalInterface>(
+          nullptr,
+          nullptr,
+          std::make_shared<NiceMock<BinaryenWasmMemoryFactoryMock>>(),
+          host_api_factory,
+          std::make_shared<NiceMock<TrieStorageProviderMock>>());
+    }
+
+    static wasm::Function import(const char *name) {
+      wasm::Function function;
+      function.module = "env";
+      function.base = name;
+      return function;
+    }
+
+    HostApi *api;
+    std::unique_ptr<RuntimeExternalInterface> rei;
+  };
+
+  /// Names in the order RuntimeExternalInterface used to compare imports
+  /// with, before ext_storage_get_version_1
+  const std::vector<wasm::Name> kNameChain = [] {
+    std::vector<wasm::Name> names;
+    for (auto name :
+         {"ext_malloc", "ext_free", "ext_clear_prefix", "ext_clear_storage",
+          "ext_exists_storage", "ext_get_allocated_storage",
+          "ext_get_storage_into", "ext_storage_read_version_1",
+          "ext_set_storage", "ext_blake2_256_enumerated_trie_root",
+          "ext_storage_changes_root", "ext_storage_root", "ext_print_hex",
+          "ext_logging_log_version_1", "ext_logging_max_level_version_1",
+          "ext_print_num", "ext_print_utf8", "ext_blake2_128",
+          "ext_blake2_256", "ext_keccak_256", "ext_start_batch_verify",
+          "ext_finish_batch_verify", "ext_ed25519_verify",
+          "ext_sr25519_verify", "ext_twox_64", "ext_twox_128",
+          "ext_twox_256", "ext_chain_id",
+          "ext_crypto_start_batch_verify_version_1",
+          "ext_crypto_finish_batch_verify_version_1",
+          "ext_crypto_ed25519_public_keys_version_1",
+          "ext_crypto_ed25519_generate_version_1",
+          "ext_crypto_ed25519_sign_version_1",
+          "ext_crypto_ed25519_verify_version_1",
+          "ext_crypto_sr25519_public_keys_version_1",
+          "ext_crypto_sr25519_generate_version_1",
+          "ext_crypto_sr25519_sign_version_1",
+          "ext_crypto_sr25519_verify_version_1",
+          "ext_crypto_sr25519_verify_version_2",
+          "ext_crypto_secp256k1_ecdsa_recover_version_1",
+          "ext_crypto_secp256k1_ecdsa_recover_compressed_version_1",
+          "ext_hashing_keccak_256_version_1",
+          "ext_hashing_sha2_256_version_1",
+          "ext_hashing_blake2_128_version_1",
+          "ext_hashing_blake2_256_version_1",
+          "ext_hashing_twox_256_version_1", "ext_hashing_twox_128_version_1",
+          "ext_hashing_twox_64_version_1", "ext_allocator_malloc_version_1",
+          "ext_allocator_free_version_1",
+          "ext_storage_set_version_1", "ext_storage_get_version_1"}) {
+      names.emplace_back(name);
+    }
+    return names;
+  }();
+
+  /// Lower bound: virtual call of the host function with unpacked arguments
+  void DirectCall(benchmark::State &state) {
+    Fixture fixture;
+    wasm::LiteralList arguments{wasm::Literal(uint64_t{42})};
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(fixture.api->ext_storage_get_version_1(
+          arguments[0].geti64()));
+    }
+  }
+
+  /// Baseline: the import is found by comparing its name with the names of
+  /// all the host functions preceding it, then called
+  void NameChain(benchmark::State &state) {
+    Fixture fixture;
+    auto import = Fixture::import("ext_storage_get_version_1");
+    wasm::LiteralList arguments{wasm::Literal(uint64_t{42})};
+    for (auto _ : state) {
+      size_t index = 0;
+      while (not(import.base == kNameChain[index])) {
+        ++index;
+      }
+      benchmark::DoNotOptimize(index);
+      benchmark::DoNotOptimize(fixture.api->ext_storage_get_version_1(
+          arguments.at(0).geti64()));
+    }
+  }
+
+  void CallImport(benchmark::State &state, const char *name, size_t arity) {
+    Fixture fixture;
+    auto import = Fixture::import(name);
+    wasm::LiteralList arguments;
+    for (size_t i = 0; i < arity; ++i) {
+      arguments.push_back(i + 1 == 3 ? wasm::Literal(uint32_t{1})
+                                     : wasm::Literal(uint64_t{42}));
+    }
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(fixture.rei->callImport(&import, arguments));
+    }
+  }
+
+  void CallImport_StorageGet(benchmark::State &state) {
+    CallImport(state, "ext_storage_get_version_1", 1);
+  }
+
+  void CallImport_StorageRead(benchmark::State &state) {
+    CallImport(state, "ext_storage_read_version_1", 3);
+  }
+
+}  // namespace
+
+BENCHMARK(DirectCall);
+BENCHMARK(NameChain);
+BENCHMARK(CallImport_StorageGet);
+BENCHMARK(CallImport_StorageRead);
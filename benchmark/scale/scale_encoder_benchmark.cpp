@@ -0,0 +1,234 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <deque>
+
+#include <benchmark/benchmark.h>
+
+#include "primitives/block.hpp"
+#include "scale/scale.hpp"
+
+using kagome::common::Buffer;
+using kagome::primitives::Block;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::Consensus;
+using kagome::primitives::Extrinsic;
+using kagome::primitives::kBabeEngineId;
+using kagome::primitives::kGrandpaEngineId;
+using kagome::primitives::PreRuntime;
+using kagome::primitives::Seal;
+using kagome::scale::ByteArray;
+using kagome::scale::CompactInteger;
+using kagome::scale::ScaleEncoderStream;
+
+namespace {
+
+  /**
+   * Encoder which works the way ScaleEncoderStream used to: every byte is
+   * appended to a deque separately and collected to a vector in the end.
+   * Serves as a baseline
+   */
+  class DequeEncoderStream {
+   public:
+    static constexpr auto is_encoder_stream = true;
+
+    ByteArray data() const {
+      return {stream_.begin(), stream_.end()};
+    }
+
+    template <class F, class S>
+    DequeEncoderStream &operator<<(const std::pair<F, S> &p) {
+      return *this << p.first << p.second;
+    }
+
+    template <class... T>
+    DequeEncoderStream &operator<<(const boost::variant<T...> &v) {
+      encodeVariant<0>(v);
+      return *this;
+    }
+
+    template <class T>
+    DequeEncoderStream &operator<<(const std::vector<T> &c) {
+      *this << CompactInteger{c.size()};
+      for (const auto &item : c) {
+        *this << item;
+      }
+      return *this;
+    }
+
+    template <class T>
+    DequeEncoderStream &operator<<(const boost::optional<T> &v) {
+      if (not v.has_value()) {
+        return *this << uint8_t{0};
+      }
+      return *this << uint8_t{1} << *v;
+    }
+
+    template <typename T, size_t size>
+    DequeEncoderStream &operator<<(const std::array<T, size> &a) {
+      for (const auto &item : a) {
+        *this << item;
+      }
+      return *this;
+    }
+
+    template <typename T,
+              typename I = std::decay_t<T>,
+              typename = std::enable_if_t<std::is_integral<I>::value>>
+    DequeEncoderStream &operator<<(T &&v) {
+      if constexpr (sizeof(I) == 1u) {
+        stream_.push_back(static_cast<uint8_t>(v));
+      } else {
+        for (size_t i = 0; i < sizeof(I); ++i) {
+          stream_.push_back(static_cast<uint8_t>(v >> (i * 8)));
+        }
+      }
+      return *this;
+    }
+
+    DequeEncoderStream &operator<<(const CompactInteger &v) {
+      for (auto byte : kagome::scale::encode(v).value()) {
+        stream_.push_back(byte);
+      }
+      return *this;
+    }
+
+   private:
+    template <uint8_t I, class... Ts>
+    void encodeVariant(const boost::variant<Ts...> &v) {
+      using T = std::tuple_element_t<I, std::tuple<Ts...>>;
+      if (v.type() == typeid(T)) {
+        *this << I << boost::get<T>(v);
+        return;
+      }
+      if constexpr (sizeof...(Ts) > I + 1) {
+        encodeVariant<I + 1>(v);
+      }
+    }
+
+    std::deque<uint8_t> stream_;
+  };
+
+  /// Header with the digest of a typical BABE block
+  BlockHeader makeHeader() {
+    BlockHeader header;
+    header.parent_hash.fill(1);
+    header.number = 1234567;
+    header.state_root.fill(2);
+    header.extrinsics_root.fill(3);
+    PreRuntime pre_runtime;
+    pre_runtime.consensus_engine_id = kBabeEngineId;
+    pre_runtime.data = Buffer(20, 4);
+    Consensus consensus;
+    consensus.consensus_engine_id = kGrandpaEngineId;
+    consensus.data = Buffer(40, 5);
+    Seal seal;
+    seal.consensus_engine_id = kBabeEngineId;
+    seal.data = Buffer(64, 6);
+    header.digest = {pre_runtime, consensus, seal};
+    return header;
+  }
+
+  /// Extrinsics of typical transfer size
+  std::vector<Extrinsic> makeExtrinsics(size_t count) {
+    return std::vector<Extrinsic>(count, Extrinsic{Buffer(140, 7)});
+  }
+
+  template <class T>
+  void encodeWithDeque(benchmark::State &state, const T &value) {
+    for (auto _ : state) {
+      DequeEncoderStream s;
+      s << value;
+      benchmark::DoNotOptimize(s.data());
+    }
+  }
+
+  template <class T>
+  void encodeWithGrowth(benchmark::State &state, const T &value) {
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(kagome::scale::encode(value).value());
+    }
+  }
+
+  template <class T>
+  void encodeWithSizePrepass(benchmark::State &state, const T &value) {
+    for (auto _ : state) {
+      ByteArray out;
+      kagome::scale::encodeTo(out, value).value();
+      benchmark::DoNotOptimize(out);
+    }
+  }
+
+  template <class T>
+  void encodeToReusedBuffer(benchmark::State &state, const T &value) {
+    ByteArray out;
+    for (auto _ : state) {
+      out.clear();
+      ScaleEncoderStream s{std::move(out)};
+      s << value;
+      out = std::move(s).data();
+      benchmark::DoNotOptimize(out);
+    }
+  }
+
+  void Header_Deque(benchmark::State &state) {
+    encodeWithDeque(state, makeHeader());
+  }
+  void Header_Growth(benchmark::State &state) {
+    encodeWithGrowth(state, makeHeader());
+  }
+  void Header_SizePrepass(benchmark::State &state) {
+    encodeWithSizePrepass(state, makeHeader());
+  }
+  void Header_ReusedBuffer(benchmark::State &state) {
+    encodeToReusedBuffer(state, makeHeader());
+  }
+
+  void Extrinsics_Deque(benchmark::State &state) {
+    encodeWithDeque(state, makeExtrinsics(state.range(0)));
+  }
+  void Extrinsics_Growth(benchmark::State &state) {
+    encodeWithGrowth(state, makeExtrinsics(state.range(0)));
+  }
+  void Extrinsics_SizePrepass(benchmark::State &state) {
+    encodeWithSizePrepass(state, makeExtrinsics(state.range(0)));
+  }
+  void Extrinsics_ReusedBuffer(benchmark::State &state) {
+    encodeToReusedBuffer(state, makeExtrinsics(state.range(0)));
+  }
+
+  Block makeBlock(size_t extrinsics) {
+    return Block{makeHeader(), makeExtrinsics(extrinsics)};
+  }
+
+  void Block_Deque(benchmark::State &state) {
+    encodeWithDeque(state, makeBlock(state.range(0)));
+  }
+  void Block_Growth(benchmark::State &state) {
+    encodeWithGrowth(state, makeBlock(state.range(0)));
+  }
+  void Block_SizePrepass(benchmark::State &state) {
+    encodeWithSizePrepass(state, makeBlock(state.range(0)));
+  }
+  void Block_ReusedBuffer(benchmark::State &state) {
+    encodeToReusedBuffer(state, makeBlock(state.range(0)));
+  }
+
+}  // namespace
+
+BENCHMARK(Header_Deque);
+BENCHMARK(Header_Growth);
+BENCHMARK(Header_SizePrepass);
+BENCHMARK(Header_ReusedBuffer);
+
+BENCHMARK(Extrinsics_Deque)->Range(8, 4096);
+BENCHMARK(Extrinsics_Growth)->Range(8, 4096);
+BENCHMARK(Extrinsics_SizePrepass)->Range(8, 4096);
+BENCHMARK(Extrinsics_ReusedBuffer)->Range(8, 4096);
+
+BENCHMARK(Block_Deque)->Range(8, 4096);
+BENCHMARK(Block_Growth)->Range(8, 4096);
+BENCHMARK(Block_SizePrepass)->Range(8, 4096);
+BENCHMARK(Block_ReusedBuffer)->Range(8, 4096);
@@ -0,0 +1,102 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "storage/trie/polkadot_trie/polkadot_trie_impl.hpp"
+#include "storage/trie/serialization/ordered_trie_hash.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+
+using kagome::common::Buffer;
+using kagome::scale::CompactInteger;
+using kagome::storage::trie::calculateOrderedTrieHash;
+using kagome::storage::trie::calculateTrieHash;
+using kagome::storage::trie::PolkadotCodec;
+using kagome::storage::trie::PolkadotTrieImpl;
+
+namespace {
+
+  using Pairs = std::vector<std::pair<Buffer, Buffer>>;
+
+  /**
+   * Calculates the root the way calculateOrderedTrieHash used to: fills a
+   * trie of nodes and encodes it recursively. Serves as a baseline
+   */
+  Buffer orderedTrieRoot(const std::vector<Buffer> &values) {
+    PolkadotTrieImpl trie;
+    PolkadotCodec codec;
+    CompactInteger key = 0;
+    for (auto &value : values) {
+      trie.put(Buffer{kagome::scale::encode(key++).value()}, value).value();
+    }
+    return Buffer{codec.hash256(codec.encodeNode(*trie.getRoot()).value())};
+  }
+
+  /// Same as orderedTrieRoot for arbitrary keys
+  Buffer trieRoot(const Pairs &pairs) {
+    PolkadotTrieImpl trie;
+    PolkadotCodec codec;
+    for (auto &[key, value] : pairs) {
+      trie.put(key, value).value();
+    }
+    return Buffer{codec.hash256(codec.encodeNode(*trie.getRoot()).value())};
+  }
+
+  /// Extrinsics of typical transfer size
+  std::vector<Buffer> makeExtrinsics(size_t count) {
+    std::vector<Buffer> extrinsics;
+    for (size_t i = 0; i < count; ++i) {
+      extrinsics.emplace_back(140, static_cast<uint8_t>(i));
+    }
+    return extrinsics;
+  }
+
+  /// Storage-like pairs: 32-byte keys under a few common prefixes
+  Pairs makePairs(size_t count) {
+    Pairs pairs;
+    for (size_t i = 0; i < count; ++i) {
+      Buffer key(16, static_cast<uint8_t>(i % 4));
+      key.putUint64(i * 0x9e3779b97f4a7c15).putUint64(i);
+      pairs.emplace_back(std::move(key), Buffer(40, static_cast<uint8_t>(i)));
+    }
+    return pairs;
+  }
+
+  void Ordered_Trie(benchmark::State &state) {
+    auto extrinsics = makeExtrinsics(state.range(0));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(orderedTrieRoot(extrinsics));
+    }
+  }
+
+  void Ordered_Streaming(benchmark::State &state) {
+    auto extrinsics = makeExtrinsics(state.range(0));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(calculateOrderedTrieHash(extrinsics).value());
+    }
+  }
+
+  void Pairs_Trie(benchmark::State &state) {
+    auto pairs = makePairs(state.range(0));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(trieRoot(pairs));
+    }
+  }
+
+  void Pairs_Streaming(benchmark::State &state) {
+    auto pairs = makePairs(state.range(0));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(
+          calculateTrieHash(pairs.begin(), pairs.end()).value());
+    }
+  }
+
+}  // namespace
+
+BENCHMARK(Ordered_Trie)->Range(8, 8192);
+BENCHMARK(Ordered_Streaming)->Range(8, 8192);
+
+BENCHMARK(Pairs_Trie)->Range(8, 8192);
+BENCHMARK(Pairs_Streaming)->Range(8, 8192);
@@ -0,0 +1,126 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "mock/core/blockchain/block_header_repository_mock.hpp"
+#include "mock/core/transaction_pool/pool_moderator_mock.hpp"
+#include "transaction_pool/impl/transaction_pool_impl.hpp"
+
+using kagome::blockchain::BlockHeaderRepositoryMock;
+using kagome::common::Hash256;
+using kagome::primitives::Transaction;
+using kagome::primitives::events::ExtrinsicSubscriptionEngine;
+using kagome::subscription::ExtrinsicEventKeyRepository;
+using kagome::transaction_pool::PoolModeratorMock;
+using kagome::transaction_pool::TransactionPoolImpl;
+using testing::NiceMock;
+
+namespace {
+
+  /// Number of transactions in a chain of dependent ones, like nonces of an
+  /// account
+  constexpr size_t kChainLength = 100;
+
+  std::shared_ptr<TransactionPoolImpl> makePool(size_t capacity) {
+    return std::make_shared<TransactionPoolImpl>(
+        std::make_unique<NiceMock<PoolModeratorMock>>(),
+        std::make_unique<BlockHeaderRepositoryMock>(),
+        std::make_unique<ExtrinsicSubscriptionEngine>(),
+        std::make_unique<ExtrinsicEventKeyRepository>(),
+        TransactionPoolImpl::Limits{capacity, capacity});
+  }
+
+  Transaction::Tag tag(size_t chain, size_t nonce) {
+    return Transaction::Tag{static_cast<uint8_t>(chain >> 8),
+                            static_cast<uint8_t>(chain),
+                            static_cast<uint8_t>(nonce)};
+  }
+
+  Hash256 hash(size_t chain, size_t nonce) {
+    Hash256 hash;
+    auto index = chain * kChainLength + nonce;
+    hash[0] = static_cast<uint8_t>(index >> 16);
+    hash[1] = static_cast<uint8_t>(index >> 8);
+    hash[2] = static_cast<uint8_t>(index);
+    return hash;
+  }
+
+  /**
+   * Makes chains of dependent transactions in order opposite to dependencies,
+   * so that the whole chain becomes ready only when its first transaction is
+   * imported
+   */
+  std::vector<Transaction> makeTransactions(size_t chains) {
+    std::vector<Transaction> txs;
+    txs.reserve(chains * kChainLength);
+    for (size_t nonce = kChainLength; nonce-- > 0;) {
+      for (size_t chain = 0; chain < chains; ++chain) {
+        Transaction tx;
+        tx.hash = hash(chain, nonce);
+        tx.provides = {tag(chain, nonce)};
+        if (nonce != 0) {
+          tx.requires = {tag(chain, nonce - 1)};
+        }
+        tx.priority = chain % 16;
+        tx.valid_till = 10000;
+        txs.emplace_back(std::move(tx));
+      }
+    }
+    return txs;
+  }
+
+  void Submit(benchmark::State &state) {
+    const size_t chains = state.range(0);
+    for (auto _ : state) {
+      state.PauseTiming();
+      auto pool = makePool(chains * kChainLength);
+      auto txs = makeTransactions(chains);
+      state.ResumeTiming();
+      pool->submit(std::move(txs)).value();
+    }
+    state.SetItemsProcessed(state.iterations() * chains * kChainLength);
+  }
+
+  void VisitReady(benchmark::State &state) {
+    const size_t chains = state.range(0);
+    auto pool = makePool(chains * kChainLength);
+    pool->submit(makeTransactions(chains)).value();
+    for (auto _ : state) {
+      size_t visited = 0;
+      pool->forEachReadyTransaction([&visited](const auto &tx) {
+        benchmark::DoNotOptimize(tx->priority);
+        ++visited;
+        return true;
+      });
+      benchmark::DoNotOptimize(visited);
+    }
+    state.SetItemsProcessed(state.iterations() * chains * kChainLength);
+  }
+
+  /// Removes transactions from the ends of chains, so that the rest of each
+  /// chain stays ready
+  void RemoveOne(benchmark::State &state) {
+    const size_t chains = state.range(0);
+    for (auto _ : state) {
+      state.PauseTiming();
+      auto pool = makePool(chains * kChainLength);
+      pool->submit(makeTransactions(chains)).value();
+      state.ResumeTiming();
+      for (size_t nonce = kChainLength; nonce-- > 0;) {
+        for (size_t chain = 0; chain < chains; ++chain) {
+          pool->removeOne(hash(chain, nonce)).value();
+        }
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * chains * kChainLength);
+  }
+
+}  // namespace
+
+// from a thousand to a hundred thousand transactions
+BENCHMARK(Submit)->RangeMultiplier(10)->Range(10, 1000);
+BENCHMARK(VisitReady)->RangeMultiplier(10)->Range(10, 1000);
+BENCHMARK(RemoveOne)->RangeMultiplier(10)->Range(10, 1000);
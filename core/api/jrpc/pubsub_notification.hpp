@@ -0,0 +1,62 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_API_JRPC_PUBSUB_NOTIFICATION_HPP
+#define KAGOME_API_JRPC_PUBSUB_NOTIFICATION_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace kagome::api {
+
+  /**
+   * Pub-sub notification serialized around the subscription id, which is the
+   * only part of a notification that differs between subscribed sessions.
+   * Has the same layout as the one JRpcServer::processJsonData produces:
+   * {"jsonrpc":"2.0","method":<method>,"id":0,
+   *  "params":{"result":<result>,"subscription":<id>}}
+   */
+  struct PreparedNotification {
+    std::string prefix;
+    std::string suffix;
+
+    /**
+     * Builds the envelope around an already serialized result
+     * @param method_name notification method, must not need json escaping
+     * @param result json representation of the notification result
+     */
+    static PreparedNotification make(std::string_view method_name,
+                                     std::string_view result) {
+      constexpr std::string_view kHead = R"({"jsonrpc":"2.0","method":")";
+      constexpr std::string_view kParams = R"(","id":0,"params":{"result":)";
+      constexpr std::string_view kSubscription = R"(,"subscription":)";
+
+      PreparedNotification notification;
+      notification.prefix.reserve(kHead.size() + method_name.size()
+                                  + kParams.size() + result.size()
+                                  + kSubscription.size());
+      notification.prefix.append(kHead)
+          .append(method_name)
+          .append(kParams)
+          .append(result)
+          .append(kSubscription);
+      notification.suffix = "}}";
+      return notification;
+    }
+
+    /// @return notification for the subscription with the given id
+    std::string withSetId(uint32_t set_id) const {
+      const auto id = std::to_string(set_id);
+      std::string message;
+      message.reserve(prefix.size() + id.size() + suffix.size());
+      message.append(prefix).append(id).append(suffix);
+      return message;
+    }
+  };
+
+}  // namespace kagome::api
+
+#endif  // KAGOME_API_JRPC_PUBSUB_NOTIFICATION_HPP
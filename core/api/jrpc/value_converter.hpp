@@ -21,6 +21,7 @@
 #include "primitives/extrinsic.hpp"
 #include "primitives/rpc_methods.hpp"
 #include "primitives/runtime_dispatch_info.hpp"
+#include "primitives/storage_change_set.hpp"
 #include "primitives/version.hpp"
 #include "scale/scale.hpp"
 
@@ -65,6 +66,7 @@ namespace kagome::api {
   inline jsonrpc::Value makeValue(const primitives::Version &);
   inline jsonrpc::Value makeValue(const primitives::Justification &);
   inline jsonrpc::Value makeValue(const primitives::RpcMethods &);
+  inline jsonrpc::Value makeValue(const primitives::StorageChangeSet &);
 
   inline jsonrpc::Value makeValue(const uint32_t &val) {
     return static_cast<int64_t>(val);
@@ -214,6 +216,13 @@ namespace kagome::api {
     return res;
   }
 
+  inline jsonrpc::Value makeValue(const primitives::StorageChangeSet &val) {
+    jStruct res;
+    res["block"] = makeValue(val.block);
+    res["changes"] = makeValue(val.changes);
+    return res;
+  }
+
   inline jsonrpc::Value makeValue(const primitives::BlockData &val) {
     jStruct block;
     block["extrinsics"] = makeValue(val.body);
@@ -138,7 +138,7 @@ namespace kagome::api {
 
   outcome::result<std::vector<primitives::Extrinsic>>
   AuthorApiImpl::pendingExtrinsics() {
-    auto &pending_txs = pool_->getPendingTransactions();
+    auto pending_txs = pool_->getPendingTransactions();
 
     std::vector<primitives::Extrinsic> result;
     result.reserve(pending_txs.size());
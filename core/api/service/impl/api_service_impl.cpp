@@ -5,8 +5,11 @@
 
 #include "api/service/impl/api_service_impl.hpp"
 
+#include <chrono>
+
 #include <boost/algorithm/string/replace.hpp>
 
+#include "api/jrpc/custom_json_writer.hpp"
 #include "api/jrpc/jrpc_processor.hpp"
 #include "api/jrpc/jrpc_server.hpp"
 #include "api/jrpc/value_converter.hpp"
@@ -14,6 +17,7 @@
 #include "application/app_state_manager.hpp"
 #include "blockchain/block_tree.hpp"
 #include "common/hexutil.hpp"
+#include "metrics/timing.hpp"
 #include "primitives/common.hpp"
 #include "primitives/transaction.hpp"
 #include "storage/trie/trie_storage.hpp"
@@ -45,6 +49,15 @@ namespace {
     }
   } threaded_info;
 
+  constexpr const char *kSerializedCounterName =
+      "kagome_rpc_notifications_serialized_total";
+  constexpr const char *kSentCounterName =
+      "kagome_rpc_notifications_sent_total";
+  constexpr const char *kSerializationHistogramName =
+      "kagome_rpc_notification_serialization_seconds";
+  constexpr const char *kFanoutHistogramName =
+      "kagome_rpc_notification_fanout_seconds";
+
   template <typename Func>
   auto withThisSession(Func &&f) {
     if (auto session_id = threaded_info.fetchSessionId(); session_id)
@@ -107,9 +120,27 @@ namespace {
                 name,
                 std::move(value),
                 [session{std::move(session)}](const auto &response) {
-                  session->respond(response);
+                  session->notify(response, {});
                 });
   }
+
+  /**
+   * Prepares pub-sub notification around the json representation of the
+   * event value
+   * @return none if the value could not be formatted
+   */
+  boost::optional<PreparedNotification> prepareNotification(
+      std::string_view name, const jsonrpc::Value &value) {
+    JsonWriter writer;
+    try {
+      value.Write(writer);
+    } catch (const jsonrpc::Fault &) {
+      return boost::none;
+    }
+    auto data = writer.GetData();
+    return PreparedNotification::make(
+        name, std::string_view(data->GetData(), data->GetSize()));
+  }
 }  // namespace
 
 namespace kagome::api {
@@ -164,6 +195,28 @@ namespace kagome::api {
     BOOST_ASSERT(subscription_engines_.storage);
     BOOST_ASSERT(subscription_engines_.ext);
     BOOST_ASSERT(extrinsic_event_key_repo_);
+
+    // initialize metrics
+    registry_->registerCounterFamily(
+        kSerializedCounterName,
+        "Number of pubsub notifications serialized to json");
+    notifications_serialized_ =
+        registry_->registerCounterMetric(kSerializedCounterName);
+    registry_->registerCounterFamily(
+        kSentCounterName, "Number of pubsub notifications sent to sessions");
+    notifications_sent_ = registry_->registerCounterMetric(kSentCounterName);
+    registry_->registerHistogramFamily(
+        kSerializationHistogramName,
+        "Time taken to serialize an event to a pubsub notification");
+    serialization_time_ = registry_->registerHistogramMetric(
+        kSerializationHistogramName,
+        {0.00001, 0.00005, 0.0001, 0.0005, 0.001, 0.005, 0.01, 0.05});
+    registry_->registerHistogramFamily(
+        kFanoutHistogramName,
+        "Time taken to hand a pubsub notification over to a session");
+    fanout_time_ = registry_->registerHistogramMetric(
+        kFanoutHistogramName,
+        {0.000001, 0.00001, 0.0001, 0.001, 0.01, 0.1});
   }
 
   jsonrpc::Value ApiServiceImpl::createStateStorageEvent(
@@ -206,6 +259,9 @@ namespace kagome::api {
                   UNWRAP_WEAK_PTR(onExtrinsicEvent));
             }
 
+            // requests are processed on the strand of the session, so that
+            // its responses keep the order of the requests and a session
+            // does not take more than one thread of the pool
             session->connectOnRequest(UNWRAP_WEAK_PTR(onSessionRequest));
             session->connectOnCloseHandler(UNWRAP_WEAK_PTR(onSessionClose));
           };
@@ -502,12 +558,15 @@ namespace kagome::api {
                                       const Buffer &key,
                                       const Buffer &data,
                                       const common::Hash256 &block) {
-    sendEvent(server_,
-              session,
-              logger_,
-              set_id,
-              kRpcEventSubscribeStorage,
-              createStateStorageEvent(key, data, block));
+    // a newer change of the key supersedes the queued one
+    const auto coalescing_key = std::to_string(set_id) + ":" + key.toHex();
+    sendNotification(last_storage_notification_,
+                     std::tie(key, data, block),
+                     kRpcEventSubscribeStorage,
+                     set_id,
+                     session,
+                     [&] { return createStateStorageEvent(key, data, block); },
+                     coalescing_key);
   }
 
   void ApiServiceImpl::onChainEvent(
@@ -515,24 +574,43 @@ namespace kagome::api {
       SessionPtr &session,
       primitives::events::ChainEventType event_type,
       const primitives::events::ChainEventParams &event_params) {
-    std::string_view name;
+    using primitives::events::ref_t;
+    auto make_value = [&] { return api::makeValue(event_params); };
+    auto header =
+        boost::get<ref_t<const primitives::BlockHeader>>(&event_params);
+    auto version = boost::get<ref_t<primitives::Version>>(&event_params);
     switch (event_type) {
       case primitives::events::ChainEventType::kNewHeads: {
-        name = kRpcEventNewHeads;
+        BOOST_ASSERT(header);
+        sendNotification(last_new_head_notification_,
+                         header->get(),
+                         kRpcEventNewHeads,
+                         set_id,
+                         session,
+                         make_value);
       } break;
       case primitives::events::ChainEventType::kFinalizedHeads: {
-        name = kRpcEventFinalizedHeads;
+        BOOST_ASSERT(header);
+        sendNotification(last_finalized_head_notification_,
+                         header->get(),
+                         kRpcEventFinalizedHeads,
+                         set_id,
+                         session,
+                         make_value);
       } break;
       case primitives::events::ChainEventType::kRuntimeVersion: {
-        name = kRpcEventRuntimeVersion;
+        BOOST_ASSERT(version);
+        sendNotification(last_runtime_version_notification_,
+                         version->get(),
+                         kRpcEventRuntimeVersion,
+                         set_id,
+                         session,
+                         make_value);
       } break;
       default:
+        BOOST_ASSERT_MSG(false, "Unexpected chain event type");
         break;
     }
-
-    BOOST_ASSERT(!name.empty());
-    sendEvent(
-        server_, session, logger_, set_id, name, api::makeValue(event_params));
   }
 
   void ApiServiceImpl::onExtrinsicEvent(
@@ -548,4 +626,39 @@ namespace kagome::api {
               api::makeValue(params));
   }
 
+  template <typename Event, typename EventRef, typename MakeValue>
+  void ApiServiceImpl::sendNotification(LastNotification<Event> &last,
+                                        const EventRef &event,
+                                        std::string_view name,
+                                        SubscriptionSetId set_id,
+                                        const SessionPtr &session,
+                                        const MakeValue &make_value,
+                                        std::string_view coalescing_key) {
+    auto start = std::chrono::steady_clock::now();
+    std::string message;
+    {
+      std::lock_guard lock(last.mutex);
+      if (not last.event or not(*last.event == event)) {
+        last.event.emplace(event);
+        last.notification = prepareNotification(name, make_value());
+        if (not last.notification) {
+          logger_->error("format of {} notification failed", name);
+        }
+        notifications_serialized_->inc();
+        serialization_time_->observe(metrics::secondsSince(start));
+      }
+      if (last.notification) {
+        message = last.notification->withSetId(set_id);
+      }
+    }
+    if (not message.empty()) {
+      session->notify(message, coalescing_key);
+    } else {
+      // event could not be prepared, so it is serialized for this session
+      sendEvent(server_, session, logger_, set_id, name, make_value());
+    }
+    notifications_sent_->inc();
+    fanout_time_->observe(metrics::secondsSince(start));
+  }
+
 }  // namespace kagome::api
@@ -10,16 +10,21 @@
 
 #include <functional>
 #include <mutex>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
 
+#include <boost/optional.hpp>
 #include <jsonrpc-lean/fault.h>
 
+#include "api/jrpc/pubsub_notification.hpp"
 #include "api/transport/rpc_thread_pool.hpp"
 #include "api/transport/session.hpp"
 #include "common/buffer.hpp"
 #include "containers/objects_cache.hpp"
 #include "log/logger.hpp"
+#include "metrics/metrics.hpp"
+#include "primitives/block_header.hpp"
 #include "primitives/block_id.hpp"
 #include "primitives/event_types.hpp"
 #include "subscription/subscription_engine.hpp"
@@ -107,6 +112,19 @@ namespace kagome::api {
       CachedAdditionMessagesList messages;
     };
 
+    /**
+     * Notification prepared for the last event of a kind. Sessions subscribed
+     * to the same event are notified one after another, so only the first
+     * of them serializes the event
+     * @tparam Event copy of the event content the notification is made of
+     */
+    template <typename Event>
+    struct LastNotification {
+      std::mutex mutex;
+      boost::optional<Event> event;
+      boost::optional<PreparedNotification> notification;
+    };
+
    public:
     template <class T>
     using sptr = std::shared_ptr<T>;
@@ -208,6 +226,23 @@ namespace kagome::api {
         primitives::events::SubscribedExtrinsicId id,
         const primitives::events::ExtrinsicLifecycleEvent &params);
 
+    /**
+     * Sends notification to the session, serializing the event only if it
+     * differs from the one the last notification was prepared for
+     * @param last notification prepared for the last event of this kind
+     * @param event content of the event
+     * @param make_value converts the event to json value
+     * @param coalescing_key key of notifications superseding each other
+     */
+    template <typename Event, typename EventRef, typename MakeValue>
+    void sendNotification(LastNotification<Event> &last,
+                          const EventRef &event,
+                          std::string_view name,
+                          SubscriptionSetId set_id,
+                          const SessionPtr &session,
+                          const MakeValue &make_value,
+                          std::string_view coalescing_key = {});
+
     template <typename Func>
     auto withSession(kagome::api::Session::SessionId id, Func &&f) {
       if (auto session_context = findSessionById(id)) {
@@ -254,6 +289,20 @@ namespace kagome::api {
     } subscription_engines_;
     std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
         extrinsic_event_key_repo_;
+
+    LastNotification<std::tuple<Buffer, Buffer, primitives::BlockHash>>
+        last_storage_notification_;
+    LastNotification<primitives::BlockHeader> last_new_head_notification_;
+    LastNotification<primitives::BlockHeader>
+        last_finalized_head_notification_;
+    LastNotification<primitives::Version> last_runtime_version_notification_;
+
+    // metrics
+    metrics::RegistryPtr registry_ = metrics::createRegistry();
+    metrics::Counter *notifications_serialized_;
+    metrics::Counter *notifications_sent_;
+    metrics::Histogram *serialization_time_;
+    metrics::Histogram *fanout_time_;
   };
 }  // namespace kagome::api
 
@@ -6,23 +6,60 @@
 #include "api/service/state/impl/state_api_impl.hpp"
 #include "common/hexutil.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <utility>
 
 #include <jsonrpc-lean/fault.h>
 
+#include "storage/trie/polkadot_trie/trie_error.hpp"
+
+OUTCOME_CPP_DEFINE_CATEGORY(kagome::api, StateApiImpl::Error, e) {
+  using E = kagome::api::StateApiImpl::Error;
+  switch (e) {
+    case E::MAX_BLOCK_RANGE_EXCEEDED:
+      return "Maximum block range size ("
+             + std::to_string(kagome::api::StateApiImpl::kMaxBlockRange)
+             + " blocks) exceeded";
+    case E::MAX_KEY_SET_SIZE_EXCEEDED:
+      return "Maximum key set size ("
+             + std::to_string(kagome::api::StateApiImpl::kMaxKeySetSize)
+             + " keys) exceeded";
+    case E::MAX_RESPONSE_SIZE_EXCEEDED:
+      return "Maximum response size ("
+             + std::to_string(
+                 kagome::api::StateApiImpl::kMaxPairsResponseSize)
+             + " bytes) exceeded, request the entries by pages";
+  }
+  return "Unknown error";
+}
+
 namespace kagome::api {
 
+  namespace {
+    /// Keys in lexicographical order without duplicates
+    std::vector<common::Buffer> sortedKeys(
+        const std::vector<common::Buffer> &keys) {
+      std::vector<common::Buffer> sorted{keys};
+      std::sort(sorted.begin(), sorted.end());
+      sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+      return sorted;
+    }
+  }  // namespace
+
   StateApiImpl::StateApiImpl(
       std::shared_ptr<blockchain::BlockHeaderRepository> block_repo,
       std::shared_ptr<const storage::trie::TrieStorage> trie_storage,
       std::shared_ptr<blockchain::BlockTree> block_tree,
       std::shared_ptr<runtime::Core> runtime_core,
-      std::shared_ptr<runtime::Metadata> metadata)
+      std::shared_ptr<runtime::Metadata> metadata,
+      std::shared_ptr<clock::SteadyClock> clock)
       : block_repo_{std::move(block_repo)},
         storage_{std::move(trie_storage)},
         block_tree_{std::move(block_tree)},
         runtime_core_{std::move(runtime_core)},
-        metadata_{std::move(metadata)} {
+        metadata_{std::move(metadata)},
+        cursor_cache_{std::make_unique<StorageCursorCache>(std::move(clock))} {
     BOOST_ASSERT(nullptr != block_repo_);
     BOOST_ASSERT(nullptr != storage_);
     BOOST_ASSERT(nullptr != block_tree_);
@@ -36,47 +73,132 @@ namespace kagome::api {
     api_service_ = api_service;
   }
 
-  outcome::result<std::vector<common::Buffer>> StateApiImpl::getKeysPaged(
-      const boost::optional<common::Buffer> &prefix_opt,
-      uint32_t keys_amount,
+  outcome::result<void> StateApiImpl::iterateEntries(
+      const common::Buffer &prefix,
+      uint32_t amount,
       const boost::optional<common::Buffer> &prev_key_opt,
-      const boost::optional<primitives::BlockHash> &block_hash_opt) const {
-    const auto &prefix = prefix_opt.value_or(common::Buffer{});
+      const boost::optional<primitives::BlockHash> &block_hash_opt,
+      const EntryHandler &on_entry) const {
     const auto &prev_key = prev_key_opt.value_or(prefix);
-    const auto &block_hash =
-        block_hash_opt.value_or(block_tree_->getLastFinalized().hash);
-
-    OUTCOME_TRY(header, block_repo_->getBlockHeader(block_hash));
-    OUTCOME_TRY(initial_trie_reader,
-                storage_->getEphemeralBatchAt(header.state_root));
-    auto cursor = initial_trie_reader->trieCursor();
+    const auto &block_hash = block_hash_opt
+                                 ? block_hash_opt.value()
+                                 : block_tree_->getLastFinalized().hash;
 
-    // if prev_key is bigger than prefix, then set cursor to the next key after
-    // prev_key
+    // cursor of the previous page already points to the key next to prev_key
+    boost::optional<StorageCursorCache::Cursor> cached;
     if (prev_key > prefix) {
-      OUTCOME_TRY(cursor->seekUpperBound(prev_key));
+      cached = cursor_cache_->take({block_hash, prefix, prev_key});
     }
-    // otherwise set cursor to key that is next to or equal to prefix
-    else {
-      OUTCOME_TRY(cursor->seekLowerBound(prefix));
+    StorageCursorCache::Cursor state;
+    if (cached) {
+      state = std::move(cached.value());
+    } else {
+      OUTCOME_TRY(header, block_repo_->getBlockHeader(block_hash));
+      OUTCOME_TRY(initial_trie_reader,
+                  storage_->getEphemeralBatchAt(header.state_root));
+      auto cursor = initial_trie_reader->trieCursor();
+
+      // if prev_key is bigger than prefix, then set cursor to the next key
+      // after prev_key
+      if (prev_key > prefix) {
+        OUTCOME_TRY(cursor->seekUpperBound(prev_key));
+      }
+      // otherwise set cursor to key that is next to or equal to prefix
+      else {
+        OUTCOME_TRY(cursor->seekLowerBound(prefix));
+      }
+      state = {std::move(initial_trie_reader), std::move(cursor)};
     }
 
-    std::vector<common::Buffer> result{};
-    result.reserve(keys_amount);
-    for (uint32_t i = 0; i < keys_amount && cursor->isValid(); ++i) {
-      auto key = cursor->key();
+    auto &cursor = *state.cursor;
+    boost::optional<common::Buffer> last_key;
+    for (uint32_t i = 0; i < amount; ++i) {
+      if (not cursor.isValid()) {
+        return outcome::success();
+      }
+      auto key = cursor.key();
       BOOST_ASSERT(key.has_value());
 
       // make sure our key begins with prefix
-      auto min_size = std::min(prefix.size(), key->size());
-      if (not std::equal(
-              prefix.begin(), prefix.begin() + min_size, key.value().begin())) {
-        break;
+      if (key->size() < prefix.size()
+          or not std::equal(prefix.begin(), prefix.end(), key->begin())) {
+        return outcome::success();
+      }
+      last_key = key;
+      if (not on_entry(std::move(key.value()), cursor)) {
+        return outcome::success();
       }
-      result.push_back(cursor->key().value());
-      OUTCOME_TRY(cursor->next());
+      OUTCOME_TRY(cursor.next());
+    }
+
+    if (last_key and last_key.value() > prefix and cursor.isValid()) {
+      cursor_cache_->put({block_hash, prefix, std::move(last_key.value())},
+                         std::move(state));
     }
+    return outcome::success();
+  }
 
+  outcome::result<std::vector<common::Buffer>> StateApiImpl::getKeysPaged(
+      const boost::optional<common::Buffer> &prefix_opt,
+      uint32_t keys_amount,
+      const boost::optional<common::Buffer> &prev_key_opt,
+      const boost::optional<primitives::BlockHash> &block_hash_opt) const {
+    std::vector<common::Buffer> result{};
+    result.reserve(keys_amount);
+    OUTCOME_TRY(iterateEntries(
+        prefix_opt.value_or(common::Buffer{}),
+        keys_amount,
+        prev_key_opt,
+        block_hash_opt,
+        [&result](common::Buffer key, const auto &) {
+          result.emplace_back(std::move(key));
+          return true;
+        }));
+    return result;
+  }
+
+  outcome::result<StateApi::KeyValuePairs> StateApiImpl::getPairs(
+      const common::Buffer &prefix,
+      const boost::optional<primitives::BlockHash> &at) const {
+    KeyValuePairs result{};
+    size_t response_size = 0;
+    bool too_large = false;
+    OUTCOME_TRY(iterateEntries(
+        prefix,
+        std::numeric_limits<uint32_t>::max(),
+        boost::none,
+        at,
+        [&](common::Buffer key, const auto &cursor) {
+          auto value = cursor.value().value();
+          response_size += key.size() + value.size();
+          if (response_size > kMaxPairsResponseSize) {
+            too_large = true;
+            return false;
+          }
+          result.emplace_back(std::move(key), std::move(value));
+          return true;
+        }));
+    if (too_large) {
+      return Error::MAX_RESPONSE_SIZE_EXCEEDED;
+    }
+    return result;
+  }
+
+  outcome::result<StateApi::KeyValuePairs> StateApiImpl::getPairsPaged(
+      const boost::optional<common::Buffer> &prefix_opt,
+      uint32_t pairs_amount,
+      const boost::optional<common::Buffer> &prev_key_opt,
+      const boost::optional<primitives::BlockHash> &block_hash_opt) const {
+    KeyValuePairs result{};
+    OUTCOME_TRY(iterateEntries(
+        prefix_opt.value_or(common::Buffer{}),
+        pairs_amount,
+        prev_key_opt,
+        block_hash_opt,
+        [&result](common::Buffer key, const auto &cursor) {
+          result.emplace_back(std::move(key), cursor.value().value());
+          return true;
+        }));
     return result;
   }
 
@@ -93,6 +215,94 @@ namespace kagome::api {
     return trie_reader->get(key);
   }
 
+  outcome::result<std::vector<boost::optional<common::Buffer>>>
+  StateApiImpl::readValues(const std::vector<common::Buffer> &sorted_keys,
+                           const storage::trie::RootHash &state_root) const {
+    OUTCOME_TRY(trie_reader, storage_->getEphemeralBatchAt(state_root));
+    std::vector<boost::optional<common::Buffer>> values;
+    values.reserve(sorted_keys.size());
+    for (auto &key : sorted_keys) {
+      auto value_res = trie_reader->get(key);
+      if (value_res) {
+        values.emplace_back(std::move(value_res.value()));
+      } else if (value_res.error() == storage::trie::TrieError::NO_VALUE) {
+        values.emplace_back(boost::none);
+      } else {
+        return value_res.as_failure();
+      }
+    }
+    return values;
+  }
+
+  outcome::result<std::vector<primitives::StorageChangeSet>>
+  StateApiImpl::queryStorage(
+      const std::vector<common::Buffer> &keys,
+      const primitives::BlockHash &from,
+      const boost::optional<primitives::BlockHash> &to_opt) const {
+    if (keys.size() > kMaxKeySetSize) {
+      return Error::MAX_KEY_SET_SIZE_EXCEEDED;
+    }
+    auto to = to_opt ? to_opt.value() : block_tree_->deepestLeaf().hash;
+    OUTCOME_TRY(from_number, block_repo_->getNumberByHash(from));
+    OUTCOME_TRY(to_number, block_repo_->getNumberByHash(to));
+    if (to_number >= from_number
+        and to_number - from_number >= kMaxBlockRange) {
+      return Error::MAX_BLOCK_RANGE_EXCEEDED;
+    }
+    // blocks in the chronological order
+    OUTCOME_TRY(range, block_tree_->getChainByBlocks(from, to));
+
+    // values are read at each state and compared with the previous ones,
+    // see the comment of the declaration
+    auto sorted_keys = sortedKeys(keys);
+    std::vector<primitives::StorageChangeSet> change_sets;
+    boost::optional<storage::trie::RootHash> prev_root;
+    std::vector<boost::optional<common::Buffer>> prev_values;
+    for (auto &block : range) {
+      OUTCOME_TRY(header, block_repo_->getBlockHeader(block));
+      // same state as in the previous block, nothing could change
+      if (prev_root == header.state_root) {
+        continue;
+      }
+      OUTCOME_TRY(values, readValues(sorted_keys, header.state_root));
+
+      primitives::StorageChangeSet change_set{block, {}};
+      for (size_t i = 0; i < sorted_keys.size(); ++i) {
+        if (not prev_root or values[i] != prev_values[i]) {
+          change_set.changes.emplace_back(sorted_keys[i], values[i]);
+        }
+      }
+      if (not prev_root or not change_set.changes.empty()) {
+        change_sets.emplace_back(std::move(change_set));
+      }
+      prev_root = header.state_root;
+      prev_values = std::move(values);
+    }
+    return change_sets;
+  }
+
+  outcome::result<std::vector<primitives::StorageChangeSet>>
+  StateApiImpl::queryStorageAt(
+      const std::vector<common::Buffer> &keys,
+      const boost::optional<primitives::BlockHash> &at_opt) const {
+    if (keys.size() > kMaxKeySetSize) {
+      return Error::MAX_KEY_SET_SIZE_EXCEEDED;
+    }
+    auto at = at_opt ? at_opt.value() : block_tree_->getLastFinalized().hash;
+    OUTCOME_TRY(header, block_repo_->getBlockHeader(at));
+
+    auto sorted_keys = sortedKeys(keys);
+    OUTCOME_TRY(values, readValues(sorted_keys, header.state_root));
+
+    primitives::StorageChangeSet change_set{at, {}};
+    change_set.changes.reserve(sorted_keys.size());
+    for (size_t i = 0; i < sorted_keys.size(); ++i) {
+      change_set.changes.emplace_back(std::move(sorted_keys[i]),
+                                      std::move(values[i]));
+    }
+    return std::vector{std::move(change_set)};
+  }
+
   outcome::result<primitives::Version> StateApiImpl::getRuntimeVersion(
       const boost::optional<primitives::BlockHash> &at) const {
     return runtime_core_->version(at);
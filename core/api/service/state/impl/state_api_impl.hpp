@@ -6,6 +6,9 @@
 #ifndef KAGOME_STATE_API_IMPL_HPP
 #define KAGOME_STATE_API_IMPL_HPP
 
+#include <functional>
+
+#include "api/service/state/impl/storage_cursor_cache.hpp"
 #include "api/service/state/state_api.hpp"
 #include "blockchain/block_header_repository.hpp"
 #include "blockchain/block_tree.hpp"
@@ -17,11 +20,26 @@ namespace kagome::api {
 
   class StateApiImpl final : public StateApi {
    public:
+    enum class Error {
+      MAX_BLOCK_RANGE_EXCEEDED = 1,
+      MAX_KEY_SET_SIZE_EXCEEDED,
+      MAX_RESPONSE_SIZE_EXCEEDED,
+    };
+
+    /// Max number of blocks a single state_queryStorage call may span
+    static constexpr size_t kMaxBlockRange = 256;
+    /// Max number of keys a single storage query may request
+    static constexpr size_t kMaxKeySetSize = 1000;
+    /// Max total size of keys and values a single state_getPairs call may
+    /// return; larger sets are to be requested by pages
+    static constexpr size_t kMaxPairsResponseSize = 16 * 1024 * 1024;
+
     StateApiImpl(std::shared_ptr<blockchain::BlockHeaderRepository> block_repo,
                  std::shared_ptr<const storage::trie::TrieStorage> trie_storage,
                  std::shared_ptr<blockchain::BlockTree> block_tree,
                  std::shared_ptr<runtime::Core> runtime_core,
-                 std::shared_ptr<runtime::Metadata> metadata);
+                 std::shared_ptr<runtime::Metadata> metadata,
+                 std::shared_ptr<clock::SteadyClock> clock);
 
     void setApiService(
         std::shared_ptr<api::ApiService> const &api_service) override;
@@ -33,12 +51,39 @@ namespace kagome::api {
         const boost::optional<primitives::BlockHash> &block_hash_opt)
         const override;
 
+    outcome::result<KeyValuePairs> getPairs(
+        const common::Buffer &prefix,
+        const boost::optional<primitives::BlockHash> &at) const override;
+
+    outcome::result<KeyValuePairs> getPairsPaged(
+        const boost::optional<common::Buffer> &prefix,
+        uint32_t pairs_amount,
+        const boost::optional<common::Buffer> &prev_key,
+        const boost::optional<primitives::BlockHash> &block_hash_opt)
+        const override;
+
     outcome::result<common::Buffer> getStorage(
         const common::Buffer &key) const override;
     outcome::result<common::Buffer> getStorage(
         const common::Buffer &key,
         const primitives::BlockHash &at) const override;
 
+    /**
+     * The node keeps no record of keys changed by a block (changes tries are
+     * not maintained), and the trie storage does not expose nodes to compare
+     * subtrees of two states. So the keys are read at every distinct state of
+     * the range and compared with the values at the previous one. Blocks which
+     * do not change the state root are skipped without reading. The cost is
+     * bounded by kMaxKeySetSize reads for each of kMaxBlockRange blocks
+     */
+    outcome::result<std::vector<primitives::StorageChangeSet>> queryStorage(
+        const std::vector<common::Buffer> &keys,
+        const primitives::BlockHash &from,
+        const boost::optional<primitives::BlockHash> &to) const override;
+    outcome::result<std::vector<primitives::StorageChangeSet>> queryStorageAt(
+        const std::vector<common::Buffer> &keys,
+        const boost::optional<primitives::BlockHash> &at) const override;
+
     outcome::result<uint32_t> subscribeStorage(
         const std::vector<common::Buffer> &keys) override;
     outcome::result<bool> unsubscribeStorage(
@@ -55,6 +100,33 @@ namespace kagome::api {
         std::string_view hex_block_hash) override;
 
    private:
+    /// Returns false to stop the iteration
+    using EntryHandler = std::function<bool(
+        common::Buffer key, const storage::trie::PolkadotTrieCursor &cursor)>;
+
+    /**
+     * Passes up to \param amount storage entries which keys start with
+     * \param prefix and follow \param prev_key to \param on_entry. If the
+     * iteration is not over, its cursor is kept, so that the request for the
+     * next page continues with it instead of seeking the trie again
+     */
+    outcome::result<void> iterateEntries(
+        const common::Buffer &prefix,
+        uint32_t amount,
+        const boost::optional<common::Buffer> &prev_key,
+        const boost::optional<primitives::BlockHash> &block_hash_opt,
+        const EntryHandler &on_entry) const;
+
+    /**
+     * Reads values of the keys from the state of the block with provided
+     * state root; all the keys are looked up in the same trie batch, so that
+     * nodes of their common paths are loaded only once
+     * @param sorted_keys keys in lexicographical order
+     */
+    outcome::result<std::vector<boost::optional<common::Buffer>>> readValues(
+        const std::vector<common::Buffer> &sorted_keys,
+        const storage::trie::RootHash &state_root) const;
+
     std::shared_ptr<blockchain::BlockHeaderRepository> block_repo_;
     std::shared_ptr<const storage::trie::TrieStorage> storage_;
     std::shared_ptr<blockchain::BlockTree> block_tree_;
@@ -62,8 +134,11 @@ namespace kagome::api {
 
     std::weak_ptr<api::ApiService> api_service_;
     std::shared_ptr<runtime::Metadata> metadata_;
+    std::unique_ptr<StorageCursorCache> cursor_cache_;
   };
 
 }  // namespace kagome::api
 
+OUTCOME_HPP_DECLARE_ERROR(kagome::api, StateApiImpl::Error);
+
 #endif  // KAGOME_STATE_API_IMPL_HPP
@@ -0,0 +1,55 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/service/state/impl/storage_cursor_cache.hpp"
+
+#include <algorithm>
+
+namespace kagome::api {
+
+  StorageCursorCache::StorageCursorCache(
+      std::shared_ptr<clock::SteadyClock> clock)
+      : clock_{std::move(clock)} {
+    BOOST_ASSERT(clock_ != nullptr);
+    entries_.reserve(kMaxCursors);
+  }
+
+  boost::optional<StorageCursorCache::Cursor> StorageCursorCache::take(
+      const Position &position) {
+    std::lock_guard lock{mutex_};
+    removeExpired(clock_->now());
+    auto it = std::find_if(
+        entries_.begin(), entries_.end(), [&position](const Entry &entry) {
+          return entry.position == position;
+        });
+    if (it == entries_.end()) {
+      return boost::none;
+    }
+    auto cursor = std::move(it->cursor);
+    entries_.erase(it);
+    return cursor;
+  }
+
+  void StorageCursorCache::put(Position position, Cursor cursor) {
+    auto now = clock_->now();
+    std::lock_guard lock{mutex_};
+    removeExpired(now);
+    if (entries_.size() == kMaxCursors) {
+      entries_.erase(entries_.begin());
+    }
+    entries_.push_back(
+        Entry{std::move(position), std::move(cursor), now + kTtl});
+  }
+
+  void StorageCursorCache::removeExpired(clock::SteadyClock::TimePoint now) {
+    // expiration times grow with insertion order
+    auto expired_end = std::find_if(
+        entries_.begin(), entries_.end(), [now](const Entry &entry) {
+          return entry.expires_at > now;
+        });
+    entries_.erase(entries_.begin(), expired_end);
+  }
+
+}  // namespace kagome::api
@@ -0,0 +1,90 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_API_STATE_STORAGE_CURSOR_CACHE_HPP
+#define KAGOME_API_STATE_STORAGE_CURSOR_CACHE_HPP
+
+#include <mutex>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "clock/clock.hpp"
+#include "common/buffer.hpp"
+#include "primitives/common.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_cursor.hpp"
+#include "storage/trie/trie_batches.hpp"
+
+namespace kagome::api {
+
+  /**
+   * Keeps trie cursors of paged storage iterations between requests, so that
+   * the next page continues from where the previous one stopped instead of
+   * opening the state and seeking the trie again. Cursors not claimed within
+   * TTL are dropped
+   */
+  class StorageCursorCache {
+   public:
+    /// Time a cursor is kept waiting for the next page request
+    static constexpr std::chrono::seconds kTtl{30};
+    /// Max number of cursors kept at once; the oldest one is dropped first
+    static constexpr size_t kMaxCursors = 64;
+
+    /**
+     * Identifies iteration: a cursor may be reused by a request for the same
+     * block and prefix which continues after the last returned key
+     */
+    struct Position {
+      primitives::BlockHash block;
+      common::Buffer prefix;
+      common::Buffer last_key;
+
+      bool operator==(const Position &other) const {
+        return block == other.block and prefix == other.prefix
+               and last_key == other.last_key;
+      }
+    };
+
+    /**
+     * Cursor together with the batch owning the trie it walks over. The
+     * cursor points to the entry following the last returned one
+     */
+    struct Cursor {
+      std::unique_ptr<storage::trie::EphemeralTrieBatch> batch;
+      std::unique_ptr<storage::trie::PolkadotTrieCursor> cursor;
+    };
+
+    explicit StorageCursorCache(std::shared_ptr<clock::SteadyClock> clock);
+
+    /**
+     * Extracts the cursor continuing the iteration at \param position, if it
+     * is kept and not expired
+     */
+    boost::optional<Cursor> take(const Position &position);
+
+    /**
+     * Keeps the cursor to continue the iteration at \param position
+     */
+    void put(Position position, Cursor cursor);
+
+   private:
+    struct Entry {
+      Position position;
+      Cursor cursor;
+      clock::SteadyClock::TimePoint expires_at;
+    };
+
+    /// should be called with the mutex locked
+    void removeExpired(clock::SteadyClock::TimePoint now);
+
+    std::shared_ptr<clock::SteadyClock> clock_;
+    std::mutex mutex_;
+    // in order of insertion
+    std::vector<Entry> entries_;
+  };
+
+}  // namespace kagome::api
+
+#endif  // KAGOME_API_STATE_STORAGE_CURSOR_CACHE_HPP
@@ -9,7 +9,7 @@
 
 namespace kagome::api::state::request {
 
-  outcome::result<void> GetKeysPaged::init(
+  outcome::result<void> PagedIterationParams::init(
       const jsonrpc::Request::Parameters &params) {
     if (params.size() > 4 or params.size() <= 1) {
       throw jsonrpc::InvalidParametersFault("Incorrect number of params");
@@ -22,10 +22,10 @@ namespace kagome::api::state::request {
     }
 
     if (param0.IsNil()) {
-      prefix_ = boost::none;    // I suppose none here is better than empty Buffer
+      prefix = boost::none;  // I suppose none here is better than empty Buffer
     } else if (param0.IsString()) {
       OUTCOME_TRY(key, common::unhexWith0x(param0.AsString()));
-      prefix_ = common::Buffer(std::move(key));
+      prefix = common::Buffer(std::move(key));
     } else {
       throw jsonrpc::InvalidParametersFault(
           "Parameter '[prefix]' must be a hex string");
@@ -36,7 +36,7 @@ namespace kagome::api::state::request {
           "Parameter '[key_amount]' must be a uint32_t");
     }
 
-    keys_amount_ = params[1].AsInteger32();
+    amount = params[1].AsInteger32();
     if (params.size() == 2) {
       return outcome::success();
     }
@@ -47,8 +47,8 @@ namespace kagome::api::state::request {
           "Parameter '[prev_key]' must be a hex string representation of an "
           "encoded optional byte sequence");
     }
-    OUTCOME_TRY(prev_key, common::unhexWith0x(params[2].AsString()));
-    prev_key_ = common::Buffer{prev_key};
+    OUTCOME_TRY(prev_key_bytes, common::unhexWith0x(params[2].AsString()));
+    prev_key = common::Buffer{prev_key_bytes};
 
     if (params.size() == 3) {
       return outcome::success();
@@ -61,14 +61,20 @@ namespace kagome::api::state::request {
           "optional byte sequence");
     }
     OUTCOME_TRY(at_span, common::unhexWith0x(params[3].AsString()));
-    OUTCOME_TRY(at, primitives::BlockHash::fromSpan(at_span));
-    at_ = at;
+    OUTCOME_TRY(at_hash, primitives::BlockHash::fromSpan(at_span));
+    at = at_hash;
 
     return outcome::success();
   }
 
+  outcome::result<void> GetKeysPaged::init(
+      const jsonrpc::Request::Parameters &params) {
+    return params_.init(params);
+  }
+
   outcome::result<std::vector<common::Buffer>> GetKeysPaged::execute() {
-    return api_->getKeysPaged(prefix_, keys_amount_, prev_key_, at_);
+    return api_->getKeysPaged(
+        params_.prefix, params_.amount, params_.prev_key, params_.at);
   }
 
 }  // namespace kagome::api::state::request
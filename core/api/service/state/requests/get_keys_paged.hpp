@@ -15,6 +15,19 @@
 
 namespace kagome::api::state::request {
 
+  /**
+   * Parameters of a paged storage iteration, shared by state_getKeysPaged and
+   * state_getPairsPaged: [prefix], amount, [prev_key], [at]
+   */
+  struct PagedIterationParams {
+    boost::optional<common::Buffer> prefix;
+    uint32_t amount{};
+    boost::optional<common::Buffer> prev_key;
+    boost::optional<primitives::BlockHash> at;
+
+    outcome::result<void> init(const jsonrpc::Request::Parameters &params);
+  };
+
   /**
    * Request processor for state_GetKeysPaged RPC:
    * https://github.com/w3f/PSPs/blob/psp-rpc-api/psp-002.md#state_getkeyspaged
@@ -39,10 +52,7 @@ namespace kagome::api::state::request {
 
    private:
     std::shared_ptr<StateApi> api_;
-    boost::optional<common::Buffer> prefix_;
-    uint32_t keys_amount_{};
-    boost::optional<common::Buffer> prev_key_;
-    boost::optional<primitives::BlockHash> at_;
+    PagedIterationParams params_;
   };
 
 }  // namespace kagome::api::state::request
@@ -0,0 +1,52 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/service/state/requests/get_pairs.hpp"
+
+namespace kagome::api::state::request {
+
+  outcome::result<void> GetPairs::init(
+      const jsonrpc::Request::Parameters &params) {
+    if (params.size() > 2 or params.empty()) {
+      throw jsonrpc::InvalidParametersFault("Incorrect number of params");
+    }
+    auto &param0 = params[0];
+    if (not param0.IsString()) {
+      throw jsonrpc::InvalidParametersFault(
+          "Parameter 'prefix' must be a hex string");
+    }
+    OUTCOME_TRY(prefix, common::unhexWith0x(param0.AsString()));
+    prefix_ = common::Buffer(std::move(prefix));
+
+    at_.reset();
+    if (params.size() > 1) {
+      auto &param1 = params[1];
+      if (param1.IsString()) {
+        OUTCOME_TRY(at_span, common::unhexWith0x(param1.AsString()));
+        OUTCOME_TRY(at, primitives::BlockHash::fromSpan(at_span));
+        at_ = at;
+      } else if (not param1.IsNil()) {
+        throw jsonrpc::InvalidParametersFault(
+            "Parameter 'at' must be a hex string or null");
+      }
+    }
+    return outcome::success();
+  }
+
+  outcome::result<StateApi::KeyValuePairs> GetPairs::execute() {
+    return api_->getPairs(prefix_, at_);
+  }
+
+  outcome::result<void> GetPairsPaged::init(
+      const jsonrpc::Request::Parameters &params) {
+    return params_.init(params);
+  }
+
+  outcome::result<StateApi::KeyValuePairs> GetPairsPaged::execute() {
+    return api_->getPairsPaged(
+        params_.prefix, params_.amount, params_.prev_key, params_.at);
+  }
+
+}  // namespace kagome::api::state::request
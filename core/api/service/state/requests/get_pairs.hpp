@@ -0,0 +1,75 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_API_SERVICE_STATE_REQUESTS_GET_PAIRS_HPP
+#define KAGOME_CORE_API_SERVICE_STATE_REQUESTS_GET_PAIRS_HPP
+
+#include <jsonrpc-lean/request.h>
+
+#include <boost/optional.hpp>
+
+#include "api/service/state/requests/get_keys_paged.hpp"
+#include "api/service/state/state_api.hpp"
+#include "outcome/outcome.hpp"
+
+namespace kagome::api::state::request {
+
+  /**
+   * Request processor for state_getPairs RPC: all storage entries with the
+   * given key prefix
+   */
+  class GetPairs final {
+   public:
+    GetPairs(GetPairs const &) = delete;
+    GetPairs &operator=(GetPairs const &) = delete;
+
+    GetPairs(GetPairs &&) = default;
+    GetPairs &operator=(GetPairs &&) = default;
+
+    explicit GetPairs(std::shared_ptr<StateApi> api) : api_(std::move(api)) {
+      BOOST_ASSERT(api_);
+    };
+    ~GetPairs() = default;
+
+    outcome::result<void> init(const jsonrpc::Request::Parameters &params);
+
+    outcome::result<StateApi::KeyValuePairs> execute();
+
+   private:
+    std::shared_ptr<StateApi> api_;
+    common::Buffer prefix_;
+    boost::optional<primitives::BlockHash> at_;
+  };
+
+  /**
+   * Request processor for state_getPairsPaged RPC: same as
+   * state_getKeysPaged, but with values of the keys
+   */
+  class GetPairsPaged final {
+   public:
+    GetPairsPaged(GetPairsPaged const &) = delete;
+    GetPairsPaged &operator=(GetPairsPaged const &) = delete;
+
+    GetPairsPaged(GetPairsPaged &&) = default;
+    GetPairsPaged &operator=(GetPairsPaged &&) = default;
+
+    explicit GetPairsPaged(std::shared_ptr<StateApi> api)
+        : api_(std::move(api)) {
+      BOOST_ASSERT(api_);
+    };
+    ~GetPairsPaged() = default;
+
+    outcome::result<void> init(const jsonrpc::Request::Parameters &params);
+
+    outcome::result<StateApi::KeyValuePairs> execute();
+
+   private:
+    std::shared_ptr<StateApi> api_;
+    PagedIterationParams params_;
+  };
+
+}  // namespace kagome::api::state::request
+
+#endif  // KAGOME_CORE_API_SERVICE_STATE_REQUESTS_GET_PAIRS_HPP
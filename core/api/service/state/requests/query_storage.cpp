@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/service/state/requests/query_storage.hpp"
+
+#include <jsonrpc-lean/fault.h>
+
+namespace kagome::api::state::request {
+
+  namespace {
+    outcome::result<std::vector<common::Buffer>> parseKeys(
+        const jsonrpc::Value &param) {
+      if (not param.IsArray()) {
+        throw jsonrpc::InvalidParametersFault(
+            "Parameter 'keys' must be a string array of the storage keys");
+      }
+      std::vector<common::Buffer> keys;
+      keys.reserve(param.AsArray().size());
+      for (auto &key_str : param.AsArray()) {
+        if (not key_str.IsString()) {
+          throw jsonrpc::InvalidParametersFault(
+              "Parameter 'keys' must be a string array of the storage keys");
+        }
+        OUTCOME_TRY(key, common::unhexWith0x(key_str.AsString()));
+        keys.emplace_back(std::move(key));
+      }
+      return keys;
+    }
+
+    outcome::result<boost::optional<primitives::BlockHash>> parseOptionalHash(
+        const jsonrpc::Value &param, std::string_view name) {
+      if (param.IsNil()) {
+        return boost::none;
+      }
+      if (not param.IsString()) {
+        throw jsonrpc::InvalidParametersFault(
+            "Parameter '" + std::string{name}
+            + "' must be a hex string or null");
+      }
+      OUTCOME_TRY(hash_span, common::unhexWith0x(param.AsString()));
+      OUTCOME_TRY(hash, primitives::BlockHash::fromSpan(hash_span));
+      return hash;
+    }
+  }  // namespace
+
+  outcome::result<void> QueryStorage::init(
+      const jsonrpc::Request::Parameters &params) {
+    if (params.size() > 3 or params.size() < 2) {
+      throw jsonrpc::InvalidParametersFault("Incorrect number of params");
+    }
+    OUTCOME_TRY(keys, parseKeys(params[0]));
+    keys_ = std::move(keys);
+
+    OUTCOME_TRY(from, parseOptionalHash(params[1], "from"));
+    if (not from) {
+      throw jsonrpc::InvalidParametersFault(
+          "Parameter 'from' must be a hex string");
+    }
+    from_ = from.value();
+
+    if (params.size() > 2) {
+      OUTCOME_TRY(to, parseOptionalHash(params[2], "to"));
+      to_ = to;
+    } else {
+      to_.reset();
+    }
+    return outcome::success();
+  }
+
+  outcome::result<std::vector<primitives::StorageChangeSet>>
+  QueryStorage::execute() {
+    return api_->queryStorage(keys_, from_, to_);
+  }
+
+  outcome::result<void> QueryStorageAt::init(
+      const jsonrpc::Request::Parameters &params) {
+    if (params.size() > 2 or params.empty()) {
+      throw jsonrpc::InvalidParametersFault("Incorrect number of params");
+    }
+    OUTCOME_TRY(keys, parseKeys(params[0]));
+    keys_ = std::move(keys);
+
+    if (params.size() > 1) {
+      OUTCOME_TRY(at, parseOptionalHash(params[1], "at"));
+      at_ = at;
+    } else {
+      at_.reset();
+    }
+    return outcome::success();
+  }
+
+  outcome::result<std::vector<primitives::StorageChangeSet>>
+  QueryStorageAt::execute() {
+    return api_->queryStorageAt(keys_, at_);
+  }
+
+}  // namespace kagome::api::state::request
@@ -0,0 +1,74 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_API_REQUEST_QUERY_STORAGE
+#define KAGOME_API_REQUEST_QUERY_STORAGE
+
+#include <jsonrpc-lean/request.h>
+
+#include <boost/optional.hpp>
+
+#include "api/service/state/state_api.hpp"
+#include "common/buffer.hpp"
+#include "outcome/outcome.hpp"
+#include "primitives/storage_change_set.hpp"
+
+namespace kagome::api::state::request {
+
+  /**
+   * Request state_queryStorage: values of the keys in every block of the range
+   * where they have changed
+   */
+  class QueryStorage final {
+   public:
+    QueryStorage(QueryStorage const &) = delete;
+    QueryStorage &operator=(QueryStorage const &) = delete;
+
+    QueryStorage(QueryStorage &&) = default;
+    QueryStorage &operator=(QueryStorage &&) = default;
+
+    explicit QueryStorage(std::shared_ptr<StateApi> api)
+        : api_(std::move(api)){};
+    ~QueryStorage() = default;
+
+    outcome::result<void> init(const jsonrpc::Request::Parameters &params);
+
+    outcome::result<std::vector<primitives::StorageChangeSet>> execute();
+
+   private:
+    std::shared_ptr<StateApi> api_;
+    std::vector<common::Buffer> keys_;
+    primitives::BlockHash from_;
+    boost::optional<primitives::BlockHash> to_;
+  };
+
+  /**
+   * Request state_queryStorageAt: values of the keys at the given block
+   */
+  class QueryStorageAt final {
+   public:
+    QueryStorageAt(QueryStorageAt const &) = delete;
+    QueryStorageAt &operator=(QueryStorageAt const &) = delete;
+
+    QueryStorageAt(QueryStorageAt &&) = default;
+    QueryStorageAt &operator=(QueryStorageAt &&) = default;
+
+    explicit QueryStorageAt(std::shared_ptr<StateApi> api)
+        : api_(std::move(api)){};
+    ~QueryStorageAt() = default;
+
+    outcome::result<void> init(const jsonrpc::Request::Parameters &params);
+
+    outcome::result<std::vector<primitives::StorageChangeSet>> execute();
+
+   private:
+    std::shared_ptr<StateApi> api_;
+    std::vector<common::Buffer> keys_;
+    boost::optional<primitives::BlockHash> at_;
+  };
+
+}  // namespace kagome::api::state::request
+
+#endif  // KAGOME_API_REQUEST_QUERY_STORAGE
@@ -12,12 +12,16 @@
 #include "common/buffer.hpp"
 #include "outcome/outcome.hpp"
 #include "primitives/common.hpp"
+#include "primitives/storage_change_set.hpp"
 #include "primitives/version.hpp"
 
 namespace kagome::api {
 
   class StateApi {
    public:
+    using KeyValuePairs =
+        std::vector<std::pair<common::Buffer, common::Buffer>>;
+
     virtual ~StateApi() = default;
 
     virtual void setApiService(
@@ -29,11 +33,46 @@ namespace kagome::api {
         const boost::optional<common::Buffer> &prev_key,
         const boost::optional<primitives::BlockHash> &block_hash_opt) const = 0;
 
+    /**
+     * All storage entries which keys start with \param prefix at block
+     * \param at (the last finalized block if not set)
+     */
+    virtual outcome::result<KeyValuePairs> getPairs(
+        const common::Buffer &prefix,
+        const boost::optional<primitives::BlockHash> &at) const = 0;
+
+    /**
+     * Same as getKeysPaged, but returns values together with the keys
+     */
+    virtual outcome::result<KeyValuePairs> getPairsPaged(
+        const boost::optional<common::Buffer> &prefix,
+        uint32_t pairs_amount,
+        const boost::optional<common::Buffer> &prev_key,
+        const boost::optional<primitives::BlockHash> &block_hash_opt) const = 0;
+
     virtual outcome::result<common::Buffer> getStorage(
         const common::Buffer &key) const = 0;
     virtual outcome::result<common::Buffer> getStorage(
         const common::Buffer &key, const primitives::BlockHash &at) const = 0;
 
+    /**
+     * Values of the given keys in every block of the range from \param from
+     * to \param to (the best block if not set). The first block reports all
+     * the keys, the following ones only those whose value has changed
+     */
+    virtual outcome::result<std::vector<primitives::StorageChangeSet>>
+    queryStorage(const std::vector<common::Buffer> &keys,
+                 const primitives::BlockHash &from,
+                 const boost::optional<primitives::BlockHash> &to) const = 0;
+
+    /**
+     * Values of the given keys at block \param at (the last finalized block
+     * if not set)
+     */
+    virtual outcome::result<std::vector<primitives::StorageChangeSet>>
+    queryStorageAt(const std::vector<common::Buffer> &keys,
+                   const boost::optional<primitives::BlockHash> &at) const = 0;
+
     virtual outcome::result<uint32_t> subscribeStorage(
         const std::vector<common::Buffer> &keys) = 0;
     virtual outcome::result<bool> unsubscribeStorage(
@@ -8,8 +8,10 @@
 #include "api/jrpc/jrpc_method.hpp"
 #include "api/service/state/requests/get_keys_paged.hpp"
 #include "api/service/state/requests/get_metadata.hpp"
+#include "api/service/state/requests/get_pairs.hpp"
 #include "api/service/state/requests/get_runtime_version.hpp"
 #include "api/service/state/requests/get_storage.hpp"
+#include "api/service/state/requests/query_storage.hpp"
 #include "api/service/state/requests/subscribe_runtime_version.hpp"
 #include "api/service/state/requests/subscribe_storage.hpp"
 #include "api/service/state/requests/unsubscribe_runtime_version.hpp"
@@ -31,6 +33,12 @@ namespace kagome::api::state {
     server_->registerHandler("state_getKeysPaged",
                              Handler<request::GetKeysPaged>(api_));
 
+    server_->registerHandler("state_getPairs",
+                             Handler<request::GetPairs>(api_));
+
+    server_->registerHandler("state_getPairsPaged",
+                             Handler<request::GetPairsPaged>(api_));
+
     server_->registerHandler("state_getStorage",
                              Handler<request::GetStorage>(api_));
 
@@ -39,6 +47,12 @@ namespace kagome::api::state {
     server_->registerHandler("state_getStorageAt",
                              Handler<request::GetStorage>(api_));
 
+    server_->registerHandler("state_queryStorage",
+                             Handler<request::QueryStorage>(api_));
+
+    server_->registerHandler("state_queryStorageAt",
+                             Handler<request::QueryStorageAt>(api_));
+
     server_->registerHandler("state_getRuntimeVersion",
                              Handler<request::GetRuntimeVersion>(api_));
 
@@ -21,13 +21,15 @@ namespace kagome::api {
       std::shared_ptr<network::PeerManager> peer_manager,
       std::shared_ptr<runtime::AccountNonceApi> account_nonce_api,
       std::shared_ptr<transaction_pool::TransactionPool> transaction_pool,
-      std::shared_ptr<crypto::Hasher> hasher)
+      std::shared_ptr<crypto::Hasher> hasher,
+      std::shared_ptr<runtime::RuntimeProfiler> runtime_profiler)
       : config_(std::move(config)),
         babe_(std::move(babe)),
         peer_manager_(std::move(peer_manager)),
         account_nonce_api_(std::move(account_nonce_api)),
         transaction_pool_(std::move(transaction_pool)),
-        hasher_{std::move(hasher)} {
+        hasher_{std::move(hasher)},
+        runtime_profiler_{std::move(runtime_profiler)} {
     BOOST_ASSERT(config_ != nullptr);
     BOOST_ASSERT(babe_ != nullptr);
     BOOST_ASSERT(peer_manager_ != nullptr);
@@ -56,6 +58,11 @@ namespace kagome::api {
     return adjustNonce(account_id, nonce);
   }
 
+  std::shared_ptr<runtime::RuntimeProfiler> SystemApiImpl::getRuntimeProfiler()
+      const {
+    return runtime_profiler_;
+  }
+
   primitives::AccountNonce SystemApiImpl::adjustNonce(
       const primitives::AccountId &account_id,
       primitives::AccountNonce current_nonce) const {
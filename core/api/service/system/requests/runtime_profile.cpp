@@ -0,0 +1,68 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/service/system/requests/runtime_profile.hpp"
+
+#include "api/jrpc/value_converter.hpp"
+#include "api/service/system/system_api.hpp"
+#include "metrics/timing.hpp"
+
+namespace kagome::api::system::request {
+
+  namespace {
+    jsonrpc::Value::Array makeStats(
+        const std::vector<runtime::RuntimeProfiler::CallStats> &stats) {
+      jsonrpc::Value::Array result;
+      result.reserve(stats.size());
+      for (const auto &s : stats) {
+        jsonrpc::Value::Struct item;
+        item["name"] = makeValue(s.name);
+        item["calls"] = makeValue(s.calls);
+        item["seconds"] = makeValue(metrics::toSeconds(s.time));
+        item["bytes"] = makeValue(s.bytes);
+        result.emplace_back(std::move(item));
+      }
+      return result;
+    }
+  }  // namespace
+
+  RuntimeProfile::RuntimeProfile(std::shared_ptr<SystemApi> api)
+      : api_(std::move(api)) {
+    BOOST_ASSERT(api_ != nullptr);
+  }
+
+  outcome::result<void> RuntimeProfile::init(
+      const jsonrpc::Request::Parameters &params) {
+    if (params.size() > 1) {
+      throw jsonrpc::InvalidParametersFault("Incorrect number of params");
+    }
+    if (not params.empty()) {
+      if (not params[0].IsBoolean()) {
+        throw jsonrpc::InvalidParametersFault(
+            "Parameter 'reset' must be a boolean");
+      }
+      reset_ = params[0].AsBoolean();
+    }
+    return outcome::success();
+  }
+
+  outcome::result<jsonrpc::Value::Struct> RuntimeProfile::execute() {
+    auto profiler = api_->getRuntimeProfiler();
+    if (profiler == nullptr) {
+      throw jsonrpc::InternalErrorFault(
+          "Runtime profiling is disabled, run the node with --profile-runtime");
+    }
+
+    using CallKind = runtime::RuntimeProfiler::CallKind;
+    jsonrpc::Value::Struct data;
+    data["entryPoints"] = makeStats(profiler->stats(CallKind::ENTRY_POINT));
+    data["hostFunctions"] = makeStats(profiler->stats(CallKind::HOST_FUNCTION));
+    if (reset_) {
+      profiler->reset();
+    }
+    return data;
+  }
+
+}  // namespace kagome::api::system::request
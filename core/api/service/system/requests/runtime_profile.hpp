@@ -0,0 +1,47 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_API_SYSTEM_REQUEST_RUNTIME_PROFILE
+#define KAGOME_API_SYSTEM_REQUEST_RUNTIME_PROFILE
+
+#include <jsonrpc-lean/request.h>
+
+#include "outcome/outcome.hpp"
+
+namespace kagome::api {
+  class SystemApi;
+}
+
+namespace kagome::api::system::request {
+
+  /**
+   * @brief Returns call statistics of runtime entry points and host functions
+   * collected since the start of the node or the last reset. Available when
+   * the node runs with runtime profiling enabled
+   * @param optional boolean, whether to reset the statistics after reading
+   */
+  class RuntimeProfile final {
+   public:
+    RuntimeProfile(const RuntimeProfile &) = delete;
+    RuntimeProfile &operator=(const RuntimeProfile &) = delete;
+
+    RuntimeProfile(RuntimeProfile &&) = default;
+    RuntimeProfile &operator=(RuntimeProfile &&) = default;
+
+    explicit RuntimeProfile(std::shared_ptr<SystemApi> api);
+    ~RuntimeProfile() = default;
+
+    outcome::result<void> init(const jsonrpc::Request::Parameters &params);
+
+    outcome::result<jsonrpc::Value::Struct> execute();
+
+   private:
+    std::shared_ptr<SystemApi> api_;
+    bool reset_ = false;
+  };
+
+}  // namespace kagome::api::system::request
+
+#endif  // KAGOME_API_SYSTEM_REQUEST_RUNTIME_PROFILE
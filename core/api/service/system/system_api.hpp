@@ -10,6 +10,7 @@
 #include "consensus/babe/babe.hpp"
 #include "network/peer_manager.hpp"
 #include "primitives/account.hpp"
+#include "runtime/runtime_profiler.hpp"
 
 namespace kagome::api {
 
@@ -28,6 +29,12 @@ namespace kagome::api {
 
     virtual outcome::result<primitives::AccountNonce> getNonceFor(
         std::string_view account_address) const = 0;
+
+    /**
+     * @return profiler of the runtime calls, nullptr if profiling is disabled
+     */
+    virtual std::shared_ptr<runtime::RuntimeProfiler> getRuntimeProfiler()
+        const = 0;
   };
 
 }  // namespace kagome::api
@@ -17,6 +17,7 @@ namespace kagome::api {
       : context_{std::move(context)},
         config_{std::move(listener_config)},
         session_config_{session_config},
+        session_metrics_{std::make_shared<SessionImpl::Metrics>()},
         max_ws_connections_{config_.ws_max_connections},
         next_session_id_{1ull},
         active_connections_{0},
@@ -72,8 +73,11 @@ namespace kagome::api {
   }
 
   void WsListenerImpl::acceptOnce() {
-    new_session_ = std::make_shared<SessionImpl>(
-        *context_, session_config_, next_session_id_.fetch_add(1ull));
+    new_session_ =
+        std::make_shared<SessionImpl>(*context_,
+                                      session_config_,
+                                      next_session_id_.fetch_add(1ull),
+                                      session_metrics_);
     auto session_stopped_handler = [wp = weak_from_this()] {
       if (auto self = wp.lock()) {
         --self->active_connections_;
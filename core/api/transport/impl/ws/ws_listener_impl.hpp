@@ -52,6 +52,7 @@ namespace kagome::api {
     std::shared_ptr<Context> context_;
     const Configuration config_;
     const SessionImpl::Configuration session_config_;
+    const std::shared_ptr<SessionImpl::Metrics> session_metrics_;
     const uint32_t max_ws_connections_;
 
     std::unique_ptr<Acceptor> acceptor_;
@@ -0,0 +1,88 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/transport/impl/ws/ws_outbound_queue.hpp"
+
+#include <algorithm>
+
+#include <boost/assert.hpp>
+
+namespace kagome::api {
+
+  WsOutboundQueue::WsOutboundQueue(WsOutboundConfig config)
+      : config_{config} {}
+
+  void WsOutboundQueue::pushResponse(std::string message) {
+    bytes_ += message.size();
+    queue_.push_back({std::move(message), false, {}});
+  }
+
+  WsOutboundQueue::PushResult WsOutboundQueue::pushNotification(
+      std::string message, std::string_view coalescing_key) {
+    PushResult result;
+    if (not coalescing_key.empty()
+        and config_.overflow_policy == OverflowPolicy::kCoalesce) {
+      auto it = std::find_if(
+          queue_.begin(), queue_.end(), [&](const Outbound &queued) {
+            return queued.is_notification
+                   and queued.coalescing_key == coalescing_key;
+          });
+      if (it != queue_.end()) {
+        bytes_ -= it->message.size();
+        bytes_ += message.size();
+        it->message = std::move(message);
+        result.coalesced = true;
+        return result;
+      }
+    }
+
+    bytes_ += message.size();
+    queue_.push_back(
+        {std::move(message), true, std::string(coalescing_key)});
+
+    while (queue_.size() > 1 and isOverflown()) {
+      if (config_.overflow_policy == OverflowPolicy::kDisconnect) {
+        clear();
+        result.overflown = true;
+        return result;
+      }
+      auto oldest = std::find_if(
+          queue_.begin(), queue_.end(), [](const Outbound &queued) {
+            return queued.is_notification;
+          });
+      if (oldest == queue_.end()) {
+        break;
+      }
+      bytes_ -= oldest->message.size();
+      queue_.erase(oldest);
+      ++result.dropped;
+    }
+    return result;
+  }
+
+  std::string WsOutboundQueue::pop() {
+    BOOST_ASSERT(not queue_.empty());
+    auto message = std::move(queue_.front().message);
+    queue_.pop_front();
+    bytes_ -= message.size();
+    return message;
+  }
+
+  bool WsOutboundQueue::isOverflown() const {
+    return queue_.size() > config_.max_messages
+           or bytes_ > config_.max_bytes;
+  }
+
+  bool WsOutboundQueue::isFull() const {
+    return queue_.size() >= config_.max_messages
+           or bytes_ >= config_.max_bytes;
+  }
+
+  void WsOutboundQueue::clear() {
+    queue_.clear();
+    bytes_ = 0;
+  }
+
+}  // namespace kagome::api
@@ -0,0 +1,97 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_API_TRANSPORT_IMPL_WS_OUTBOUND_QUEUE_HPP
+#define KAGOME_API_TRANSPORT_IMPL_WS_OUTBOUND_QUEUE_HPP
+
+#include <deque>
+#include <string>
+#include <string_view>
+
+#include "api/transport/ws_outbound_config.hpp"
+
+namespace kagome::api {
+
+  /**
+   * Messages of a websocket session waiting to be written. Keeps the queue
+   * within its limits by the overflow policy, which only applies to
+   * notifications: responses are always queued, and the session is expected
+   * to stop reading requests while the queue is full
+   */
+  class WsOutboundQueue {
+   public:
+    using OverflowPolicy = WsOutboundConfig::OverflowPolicy;
+
+    /// What queueing of a notification has done to fit the limits
+    struct PushResult {
+      /// a queued notification was replaced with the new one
+      bool coalesced = false;
+      /// number of notifications dropped
+      size_t dropped = 0;
+      /// the queue could not be fit and was cleared, the session is to be
+      /// closed
+      bool overflown = false;
+    };
+
+    explicit WsOutboundQueue(WsOutboundConfig config);
+
+    /**
+     * Queues response to a request
+     */
+    void pushResponse(std::string message);
+
+    /**
+     * Queues notification according to the overflow policy
+     * @param coalescing_key key of notifications superseding each other
+     */
+    PushResult pushNotification(std::string message,
+                                std::string_view coalescing_key);
+
+    /**
+     * Takes the oldest message out of the queue
+     */
+    std::string pop();
+
+    bool empty() const {
+      return queue_.empty();
+    }
+
+    /// @return number of messages waiting to be written
+    size_t size() const {
+      return queue_.size();
+    }
+
+    /// @return total size of messages waiting to be written
+    size_t bytes() const {
+      return bytes_;
+    }
+
+    /**
+     * @return true if the queue has reached one of its limits
+     */
+    bool isFull() const;
+
+   private:
+    struct Outbound {
+      std::string message;
+      bool is_notification;
+      std::string coalescing_key;
+    };
+
+    /**
+     * @return true if the queue exceeds one of its limits
+     */
+    bool isOverflown() const;
+
+    void clear();
+
+    WsOutboundConfig config_;
+    std::deque<Outbound> queue_;
+    size_t bytes_ = 0;
+  };
+
+}  // namespace kagome::api
+
+#endif  // KAGOME_API_TRANSPORT_IMPL_WS_OUTBOUND_QUEUE_HPP
@@ -8,16 +8,81 @@
 #include <thread>
 
 #include <boost/asio/dispatch.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/config.hpp>
 
+namespace {
+  constexpr const char *kQueueLengthGaugeName =
+      "kagome_rpc_ws_outbound_queue_length";
+  constexpr const char *kQueueBytesGaugeName =
+      "kagome_rpc_ws_outbound_queue_bytes";
+  constexpr const char *kDroppedCounterName =
+      "kagome_rpc_ws_notifications_dropped_total";
+  constexpr const char *kDisconnectedCounterName =
+      "kagome_rpc_ws_overflow_disconnects_total";
+  constexpr const char *kReadingPausedCounterName =
+      "kagome_rpc_ws_reading_paused_total";
+}  // namespace
+
 namespace kagome::api {
 
-  WsSession::WsSession(Context &context, Configuration config, SessionId id)
+  WsSession::Metrics::Metrics() {
+    registry_->registerGaugeFamily(
+        kQueueLengthGaugeName,
+        "Number of messages in the outbound queue of a session");
+    registry_->registerGaugeFamily(
+        kQueueBytesGaugeName,
+        "Total size of messages in the outbound queue of a session");
+    registry_->registerCounterFamily(
+        kDroppedCounterName,
+        "Number of notifications not sent because of outbound queue overflow");
+    dropped = registry_->registerCounterMetric(kDroppedCounterName,
+                                               {{"reason", "drop"}});
+    coalesced = registry_->registerCounterMetric(kDroppedCounterName,
+                                                 {{"reason", "coalesce"}});
+    registry_->registerCounterFamily(
+        kDisconnectedCounterName,
+        "Number of sessions closed because of outbound queue overflow");
+    disconnected = registry_->registerCounterMetric(kDisconnectedCounterName);
+    registry_->registerCounterFamily(
+        kReadingPausedCounterName,
+        "Number of times a session stopped reading requests until its "
+        "outbound queue is drained");
+    reading_paused =
+        registry_->registerCounterMetric(kReadingPausedCounterName);
+  }
+
+  WsSession::Metrics::SessionMetrics WsSession::Metrics::addSession(
+      SessionId id) {
+    const std::map<std::string, std::string> labels{
+        {"session", std::to_string(id)}};
+    std::lock_guard lock(mutex_);
+    return {registry_->registerGaugeMetric(kQueueLengthGaugeName, labels),
+            registry_->registerGaugeMetric(kQueueBytesGaugeName, labels)};
+  }
+
+  void WsSession::Metrics::removeSession(const SessionMetrics &session) {
+    std::lock_guard lock(mutex_);
+    registry_->removeGaugeMetric(kQueueLengthGaugeName, session.queue_length);
+    registry_->removeGaugeMetric(kQueueBytesGaugeName, session.queue_bytes);
+  }
+
+  WsSession::WsSession(Context &context,
+                       Configuration config,
+                       SessionId id,
+                       std::shared_ptr<Metrics> metrics)
       : strand_(boost::asio::make_strand(context)),
         socket_(strand_),
         config_{config},
         stream_(socket_),
-        id_(id) {}
+        outbound_{config.outbound},
+        id_(id),
+        metrics_{std::move(metrics)},
+        session_metrics_{metrics_->addSession(id_)} {}
+
+  WsSession::~WsSession() {
+    metrics_->removeSession(session_metrics_);
+  }
 
   void WsSession::start() {
     boost::asio::dispatch(stream_.get_executor(),
@@ -66,29 +131,88 @@ namespace kagome::api {
   }
 
   void WsSession::respond(std::string_view response) {
-    pending_responses_.emplace(response);
+    // the queue is owned by the strand, so that notifying thread does not
+    // wait for the session and does not race with its write handlers
+    boost::asio::dispatch(strand_,
+                          [self = shared_from_this(),
+                           response = std::string(response)]() mutable {
+                            // subscriptions respond with more than one
+                            // message to a request
+                            if (self->in_flight_ > 0) {
+                              --self->in_flight_;
+                            }
+                            self->outbound_.pushResponse(std::move(response));
+                            self->updateQueueMetrics();
+                            self->asyncWrite();
+                          });
+  }
+
+  void WsSession::notify(std::string_view message,
+                         std::string_view coalescing_key) {
+    // posted even on the strand, as overflow may close the session, which
+    // must not happen within the notifying call
+    boost::asio::post(strand_,
+                      [self = shared_from_this(),
+                       message = std::string(message),
+                       key = std::string(coalescing_key)]() mutable {
+                        self->enqueueNotification(std::move(message),
+                                                  std::move(key));
+                      });
+  }
+
+  void WsSession::enqueueNotification(std::string message,
+                                      std::string coalescing_key) {
+    auto result =
+        outbound_.pushNotification(std::move(message), coalescing_key);
+    if (result.coalesced) {
+      metrics_->coalesced->inc();
+    }
+    if (result.dropped > 0) {
+      metrics_->dropped->inc(result.dropped);
+    }
+    updateQueueMetrics();
+    if (result.overflown) {
+      SL_WARN(logger_,
+              "Session id = {} does not keep up with notifications, "
+              "outbound queue limits exceeded",
+              id_);
+      metrics_->disconnected->inc();
+      return stop(boost::beast::websocket::close_code::policy_error);
+    }
     asyncWrite();
   }
 
+  void WsSession::updateQueueMetrics() {
+    session_metrics_.queue_length->set(outbound_.size());
+    session_metrics_.queue_bytes->set(outbound_.bytes());
+  }
+
   void WsSession::asyncWrite() {
     bool val = false;
     if (writing_in_progress_.compare_exchange_strong(val, true)) {
-      if (wbuffer_.size() == 0 and not pending_responses_.empty()) {
-        boost::asio::buffer_copy(
-            wbuffer_.prepare(pending_responses_.front().size()),
-            boost::asio::const_buffer(pending_responses_.front().data(),
-                                      pending_responses_.front().size()));
-        wbuffer_.commit(pending_responses_.front().size());
-        stream_.text(true);
-        pending_responses_.pop();
-
-        stream_.async_write(wbuffer_.data(),
-                            boost::beast::bind_front_handler(
-                                &WsSession::onWrite, shared_from_this()));
+      if (wbuffer_.size() == 0 and not outbound_.empty()) {
+        writeNextOutbound();
+      } else {
+        writing_in_progress_ = false;
       }
     }
   }
 
+  void WsSession::writeNextOutbound() {
+    auto message = outbound_.pop();
+    boost::asio::buffer_copy(
+        wbuffer_.prepare(message.size()),
+        boost::asio::const_buffer(message.data(), message.size()));
+    wbuffer_.commit(message.size());
+    stream_.text(true);
+    updateQueueMetrics();
+
+    stream_.async_write(
+        wbuffer_.data(),
+        boost::beast::bind_front_handler(&WsSession::onWrite,
+                                         shared_from_this()));
+  }
+
   void WsSession::onRun() {
     // Set suggested timeout settings for the websocket
     stream_.set_option(boost::beast::websocket::stream_base::timeout::suggested(
@@ -128,11 +252,18 @@ namespace kagome::api {
       return;
     }
 
+    ++in_flight_;
     handleRequest(
         {static_cast<char *>(rbuffer_.data().data()), bytes_transferred});
 
     rbuffer_.consume(bytes_transferred);
 
+    // client which does not read responses is not served new requests
+    if (isBusy()) {
+      reading_paused_ = true;
+      metrics_->reading_paused->inc();
+      return;
+    }
     asyncRead();
   }
 
@@ -149,22 +280,21 @@ namespace kagome::api {
       stream_.async_write(wbuffer_.data(),
                           boost::beast::bind_front_handler(&WsSession::onWrite,
                                                            shared_from_this()));
-    } else if (not pending_responses_.empty()) {
-      boost::asio::buffer_copy(
-          wbuffer_.prepare(pending_responses_.front().size()),
-          boost::asio::const_buffer(pending_responses_.front().data(),
-                                    pending_responses_.front().size()));
-      wbuffer_.commit(pending_responses_.front().size());
-      stream_.text(true);
-      pending_responses_.pop();
-
-      stream_.async_write(wbuffer_.data(),
-                          boost::beast::bind_front_handler(&WsSession::onWrite,
-                                                           shared_from_this()));
-
+    } else if (not outbound_.empty()) {
+      writeNextOutbound();
     } else {
       writing_in_progress_ = false;
     }
+
+    if (reading_paused_ and not isBusy()) {
+      reading_paused_ = false;
+      asyncRead();
+    }
+  }
+
+  bool WsSession::isBusy() const {
+    return in_flight_ + outbound_.size() >= config_.outbound.max_messages
+           or outbound_.isFull();
   }
 
   void WsSession::reportError(boost::system::error_code ec,
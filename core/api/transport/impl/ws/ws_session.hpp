@@ -9,15 +9,17 @@
 #include <chrono>
 #include <cstdlib>
 #include <memory>
-#include <queue>
+#include <mutex>
 
 #include <boost/asio/strand.hpp>
 #include <boost/beast/core/multi_buffer.hpp>
 #include <boost/beast/core/tcp_stream.hpp>
 #include <boost/beast/websocket.hpp>
 
+#include "api/transport/impl/ws/ws_outbound_queue.hpp"
 #include "api/transport/session.hpp"
 #include "log/logger.hpp"
+#include "metrics/metrics.hpp"
 
 namespace kagome::api {
 
@@ -27,23 +29,59 @@ namespace kagome::api {
     using OnWsSessionCloseHandler = std::function<void()>;
 
    public:
+    using OverflowPolicy = WsOutboundConfig::OverflowPolicy;
+
     struct Configuration {
       static constexpr size_t kDefaultRequestSize = 10000u;
       static constexpr Duration kDefaultTimeout = std::chrono::seconds(30);
 
       size_t max_request_size{kDefaultRequestSize};
       Duration operation_timeout{kDefaultTimeout};
+      WsOutboundConfig outbound{};
+    };
+
+    /**
+     * Metrics of outbound queues of the sessions of a listener. Queue depth
+     * is reported per session, labeled by the session id, for as long as the
+     * session exists
+     */
+    class Metrics {
+     public:
+      /// Queue depth gauges of one session
+      struct SessionMetrics {
+        metrics::Gauge *queue_length;
+        metrics::Gauge *queue_bytes;
+      };
+
+      Metrics();
+
+      SessionMetrics addSession(SessionId id);
+      void removeSession(const SessionMetrics &session);
+
+      metrics::Counter *dropped;
+      metrics::Counter *coalesced;
+      metrics::Counter *disconnected;
+      metrics::Counter *reading_paused;
+
+     private:
+      /// sessions are created and destroyed on different threads
+      std::mutex mutex_;
+      metrics::RegistryPtr registry_ = metrics::createRegistry();
     };
 
-    ~WsSession() override = default;
+    ~WsSession() override;
 
     /**
      * @brief constructor
      * @param socket socket instance
      * @param config session configuration
      * @param id session id
+     * @param metrics metrics of outbound queues
      */
-    WsSession(Context &context, Configuration config, SessionId id);
+    WsSession(Context &context,
+              Configuration config,
+              SessionId id,
+              std::shared_ptr<Metrics> metrics);
 
     Socket &socket() override {
       return socket_;
@@ -74,6 +112,14 @@ namespace kagome::api {
      */
     void respond(std::string_view response) override;
 
+    /**
+     * @brief queues notification according to the overflow policy
+     * @param message notification to send
+     * @param coalescing_key key of notifications superseding each other
+     */
+    void notify(std::string_view message,
+                std::string_view coalescing_key) override;
+
     /**
      * @brief Closes the incoming connection with "try again later" response
      */
@@ -110,11 +156,28 @@ namespace kagome::api {
      */
     void asyncRead();
 
+    /**
+     * @brief puts notification to the outbound queue, applies the overflow
+     * policy and starts writing. Must be called on the strand
+     */
+    void enqueueNotification(std::string message, std::string coalescing_key);
+
+    /**
+     * @brief reports depth of the outbound queue
+     */
+    void updateQueueMetrics();
+
     /**
      * @brief asynchronously write
      */
     void asyncWrite();
 
+    /**
+     * @brief moves the first queued message to the write buffer and starts
+     * writing it
+     */
+    void writeNextOutbound();
+
     /**
      * @brief connected callback
      */
@@ -135,6 +198,13 @@ namespace kagome::api {
      */
     void onWrite(boost::system::error_code ec, std::size_t bytes_transferred);
 
+    /**
+     * @return true if requests being processed and messages waiting to be
+     * written reach the limits of the outbound queue, so that no more
+     * requests are to be read
+     */
+    bool isBusy() const;
+
     /**
      * @brief reports error code and message
      * @param ec error code
@@ -153,12 +223,16 @@ namespace kagome::api {
     boost::beast::flat_buffer rbuffer_;  ///< read buffer
     boost::beast::flat_buffer wbuffer_;  ///< write buffer
 
-    std::queue<std::string> pending_responses_;
+    WsOutboundQueue outbound_;     ///< messages waiting to be written
+    bool reading_paused_ = false;  ///< reading waits for outbound to drain
+    size_t in_flight_ = 0;         ///< requests read but not responded yet
 
     std::atomic_bool writing_in_progress_ = false;
 
     SessionId const id_;
     OnWsSessionCloseHandler on_ws_close_;
+    std::shared_ptr<Metrics> metrics_;
+    Metrics::SessionMetrics session_metrics_;
     log::Logger logger_ = log::createLogger("WsSession", "rpc_transport");
   };
 
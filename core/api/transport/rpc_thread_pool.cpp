@@ -9,24 +9,19 @@ namespace kagome::api {
 
   RpcThreadPool::RpcThreadPool(std::shared_ptr<Context> context,
                                const Configuration &configuration)
-      : context_(std::move(context)), config_(configuration) {
+      : context_(std::move(context)),
+        config_(configuration),
+        pool_("rpc", config_.min_thread_number, context_) {
     BOOST_ASSERT(context_);
   }
 
   void RpcThreadPool::start() {
-    threads_.reserve(config_.max_thread_number);
-    // Create a pool of threads to run all of the io_contexts.
-    for (std::size_t i = 0; i < config_.min_thread_number; ++i) {
-      auto thread = std::make_shared<std::thread>(
-          [context = context_] { context->run(); });
-      thread->detach();
-      threads_.emplace_back(std::move(thread));
-    }
+    pool_.start();
     SL_DEBUG(logger_, "Thread pool started");
   }
 
   void RpcThreadPool::stop() {
-    context_->stop();
+    pool_.stop();
     SL_DEBUG(logger_, "Thread pool stopped");
   }
 
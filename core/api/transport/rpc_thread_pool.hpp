@@ -8,10 +8,9 @@
 
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/signal_set.hpp>
-#include <set>
-#include <thread>
 
 #include "api/transport/rpc_io_context.hpp"
+#include "common/thread_pool.hpp"
 #include "log/logger.hpp"
 
 namespace kagome::api {
@@ -47,7 +46,7 @@ namespace kagome::api {
     std::shared_ptr<Context> context_;
     const Configuration config_;
 
-    std::vector<std::shared_ptr<std::thread>> threads_;
+    common::ThreadPool pool_;
 
     log::Logger logger_ = log::createLogger("RpcThreadPool", "rpc_transport");
   };
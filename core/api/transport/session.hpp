@@ -85,6 +85,18 @@ namespace kagome::api {
      */
     virtual void respond(std::string_view message) = 0;
 
+    /**
+     * @brief send pubsub notification. Unlike a response, a notification may
+     * be dropped or superseded by a later one if the client does not keep up
+     * @param message notification message
+     * @param coalescing_key queued notifications with the same non-empty key
+     * may be replaced by the latest of them
+     */
+    virtual void notify(std::string_view message,
+                        std::string_view coalescing_key) {
+      respond(message);
+    }
+
     /**
      * @brief makes `on close` notification to listener
      * @param id session id
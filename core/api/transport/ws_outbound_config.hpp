@@ -0,0 +1,44 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_API_TRANSPORT_WS_OUTBOUND_CONFIG_HPP
+#define KAGOME_API_TRANSPORT_WS_OUTBOUND_CONFIG_HPP
+
+#include <cstddef>
+
+namespace kagome::api {
+
+  /**
+   * Limits of the outbound queue of a websocket RPC session
+   */
+  struct WsOutboundConfig {
+    /**
+     * What to do with a notification which does not fit the outbound queue
+     * of a session. Responses are never dropped, instead the session stops
+     * reading requests until its queue is drained
+     */
+    enum class OverflowPolicy {
+      /// drop the oldest queued notifications
+      kDropOldest,
+      /// replace queued storage notification of the same subscription and
+      /// key with the new one, drop the oldest notifications if it is not
+      /// enough
+      kCoalesce,
+      /// close the connection
+      kDisconnect,
+    };
+
+    /// Max number of messages waiting to be written
+    size_t max_messages = 1024;
+
+    /// Max total size of messages waiting to be written
+    size_t max_bytes = 16 * 1024 * 1024;
+
+    OverflowPolicy overflow_policy = OverflowPolicy::kCoalesce;
+  };
+
+}  // namespace kagome::api
+
+#endif  // KAGOME_API_TRANSPORT_WS_OUTBOUND_CONFIG_HPP
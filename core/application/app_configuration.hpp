@@ -14,6 +14,8 @@
 #include <boost/optional.hpp>
 #include <libp2p/multi/multiaddress.hpp>
 
+#include "api/transport/ws_outbound_config.hpp"
+#include "application/threading_config.hpp"
 #include "crypto/ed25519_types.hpp"
 #include "log/logger.hpp"
 #include "network/peering_config.hpp"
@@ -117,6 +119,11 @@ namespace kagome::application {
      */
     virtual uint32_t maxWsConnections() const = 0;
 
+    /**
+     * @return limits of the outbound queue of a WS RPC session
+     */
+    virtual const api::WsOutboundConfig &wsOutboundConfig() const = 0;
+
     /**
      * @return log level (0-trace, 5-only critical, 6-no logs).
      */
@@ -132,11 +139,22 @@ namespace kagome::application {
      */
     virtual const network::PeeringConfig &peeringConfig() const = 0;
 
+    /**
+     * Amounts of threads of the node's thread pools
+     */
+    virtual const ThreadingConfig &threadingConfig() const = 0;
+
     /**
      * @return true if node allowed to run in development mode
      */
     virtual bool isRunInDevMode() const = 0;
 
+    /**
+     * @return true if calls of runtime entry points and host functions should
+     * be profiled
+     */
+    virtual bool isRuntimeProfilingEnabled() const = 0;
+
     /**
      * @return string representation of human-readable node name.
      * The name of node is going to be used in telemetry, etc.
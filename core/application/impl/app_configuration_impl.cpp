@@ -39,9 +39,11 @@ namespace {
   const uint16_t def_rpc_ws_port = 9944;
   const uint16_t def_openmetrics_http_port = 9615;
   const uint32_t def_ws_max_connections = 500;
+  const std::string def_ws_overflow_policy = "coalesce";
   const uint16_t def_p2p_port = 30363;
   const int def_verbosity = static_cast<int>(kagome::log::Level::INFO);
   const bool def_dev_mode = false;
+  const bool def_runtime_profiling = false;
   const kagome::network::Roles def_roles = [] {
     kagome::network::Roles roles;
     roles.flags.full = 1;
@@ -81,8 +83,10 @@ namespace kagome::application {
         rpc_ws_port_(def_rpc_ws_port),
         openmetrics_http_port_(def_openmetrics_http_port),
         dev_mode_(def_dev_mode),
+        runtime_profiling_(def_runtime_profiling),
         node_name_(randomNodeName()),
-        max_ws_connections_(def_ws_max_connections) {}
+        max_ws_connections_(def_ws_max_connections),
+        ws_overflow_policy_(def_ws_overflow_policy) {}
 
   fs::path AppConfigurationImpl::chainSpecPath() const {
     return chain_spec_path_.native();
@@ -212,6 +216,13 @@ namespace kagome::application {
     load_str(val, "ws-host", rpc_ws_host_);
     load_u16(val, "ws-port", rpc_ws_port_);
     load_u32(val, "ws-max-connections", max_ws_connections_);
+    if (uint32_t limit; load_u32(val, "ws-max-outbound-messages", limit)) {
+      ws_outbound_config_.max_messages = limit;
+    }
+    if (uint32_t limit; load_u32(val, "ws-max-outbound-bytes", limit)) {
+      ws_outbound_config_.max_bytes = limit;
+    }
+    load_str(val, "ws-overflow-policy", ws_overflow_policy_);
     load_str(val, "prometheus-host", openmetrics_http_host_);
     load_u16(val, "prometheus-port", openmetrics_http_port_);
     load_str(val, "name", node_name_);
@@ -220,6 +231,10 @@ namespace kagome::application {
   void AppConfigurationImpl::parse_additional_segment(rapidjson::Value &val) {
     load_u32(val, "max-blocks-in-response", max_blocks_in_response_);
     load_bool(val, "dev", dev_mode_);
+    load_u32(val, "rpc-threads", threading_config_.rpc_threads);
+    load_u32(val, "sync-threads", threading_config_.sync_requests_threads);
+    load_u32(val, "grandpa-threads", threading_config_.grandpa_threads);
+    load_bool(val, "profile-runtime", runtime_profiling_);
   }
 
   bool AppConfigurationImpl::validate_config() {
@@ -270,6 +285,34 @@ namespace kagome::application {
       return false;
     }
 
+    if (ws_outbound_config_.max_messages == 0
+        or ws_outbound_config_.max_bytes == 0) {
+      logger_->error("Limits of WS RPC outbound queue must be positive");
+      return false;
+    }
+
+    using OverflowPolicy = api::WsOutboundConfig::OverflowPolicy;
+    if (ws_overflow_policy_ == "drop-oldest") {
+      ws_outbound_config_.overflow_policy = OverflowPolicy::kDropOldest;
+    } else if (ws_overflow_policy_ == "coalesce") {
+      ws_outbound_config_.overflow_policy = OverflowPolicy::kCoalesce;
+    } else if (ws_overflow_policy_ == "disconnect") {
+      ws_outbound_config_.overflow_policy = OverflowPolicy::kDisconnect;
+    } else {
+      logger_->error(
+          "Unknown WS RPC overflow policy {}, "
+          "please specify drop-oldest, coalesce or disconnect",
+          ws_overflow_policy_);
+      return false;
+    }
+
+    if (threading_config_.rpc_threads == 0
+        or threading_config_.sync_requests_threads == 0
+        or threading_config_.grandpa_threads == 0) {
+      logger_->error("Number of threads of a pool must be positive");
+      return false;
+    }
+
     // pagination page size bounded [kAbsolutMinBlocksInResponse,
     // kAbsolutMaxBlocksInResponse]
     max_blocks_in_response_ = std::clamp(max_blocks_in_response_,
@@ -365,12 +408,27 @@ namespace kagome::application {
         ("ws-host", po::value<std::string>(), "address for RPC over Websocket protocol")
         ("ws-port", po::value<uint16_t>(), "port for RPC over Websocket protocol")
         ("ws-max-connections", po::value<uint32_t>(), "maximum number of WS RPC server connections")
+        ("ws-max-outbound-messages", po::value<uint32_t>(), "maximum number of messages queued for a WS RPC client")
+        ("ws-max-outbound-bytes", po::value<uint32_t>(), "maximum size of messages queued for a WS RPC client")
+        ("ws-overflow-policy", po::value<std::string>(), "what to do with notifications exceeding the WS RPC client queue: drop-oldest, coalesce (default) or disconnect")
         ("prometheus-host", po::value<std::string>(), "address for OpenMetrics over HTTP")
         ("prometheus-port", po::value<uint16_t>(), "port for OpenMetrics over HTTP")
         ("max-blocks-in-response", po::value<int>(), "max block per response while syncing")
         ("name", po::value<std::string>(), "the human-readable name for this node")
         ;
 
+    po::options_description threading_desc("Threading options");
+    threading_desc.add_options()
+        ("rpc-threads", po::value<uint32_t>(), "number of threads serving RPC requests")
+        ("sync-threads", po::value<uint32_t>(), "number of threads serving block requests of syncing peers")
+        ("grandpa-threads", po::value<uint32_t>(), "number of threads checking signatures of GRANDPA votes")
+        ;
+
+    po::options_description profiling_desc("Profiling options");
+    profiling_desc.add_options()
+        ("profile-runtime", "collect call statistics of runtime entry points and host functions, exported to Prometheus and by system_runtimeProfile RPC method")
+        ;
+
     po::options_description development_desc("Development options");
     development_desc.add_options()
         ("dev", "if node run in development mode")
@@ -386,7 +444,11 @@ namespace kagome::application {
     po::store(parsed, vm);
     po::notify(vm);
 
-    desc.add(blockhain_desc).add(storage_desc).add(network_desc);
+    desc.add(blockhain_desc)
+        .add(storage_desc)
+        .add(network_desc)
+        .add(threading_desc)
+        .add(profiling_desc);
 
     if (vm.count("help") > 0) {
       std::cout << desc << std::endl;
@@ -651,6 +713,19 @@ namespace kagome::application {
       max_ws_connections_ = val;
     });
 
+    find_argument<uint32_t>(vm, "ws-max-outbound-messages", [&](uint32_t val) {
+      ws_outbound_config_.max_messages = val;
+    });
+
+    find_argument<uint32_t>(vm, "ws-max-outbound-bytes", [&](uint32_t val) {
+      ws_outbound_config_.max_bytes = val;
+    });
+
+    find_argument<std::string>(
+        vm, "ws-overflow-policy", [&](std::string const &val) {
+          ws_overflow_policy_ = val;
+        });
+
     rpc_http_endpoint_ = get_endpoint_from(rpc_http_host_, rpc_http_port_);
     rpc_ws_endpoint_ = get_endpoint_from(rpc_ws_host_, rpc_ws_port_);
     openmetrics_http_endpoint_ = get_endpoint_from(openmetrics_http_host_, openmetrics_http_port_);
@@ -658,6 +733,22 @@ namespace kagome::application {
     find_argument<std::string>(
         vm, "name", [&](std::string const &val) { node_name_ = val; });
 
+    find_argument<uint32_t>(vm, "rpc-threads", [&](uint32_t val) {
+      threading_config_.rpc_threads = val;
+    });
+
+    find_argument<uint32_t>(vm, "sync-threads", [&](uint32_t val) {
+      threading_config_.sync_requests_threads = val;
+    });
+
+    find_argument<uint32_t>(vm, "grandpa-threads", [&](uint32_t val) {
+      threading_config_.grandpa_threads = val;
+    });
+
+    if (vm.count("profile-runtime") > 0) {
+      runtime_profiling_ = true;
+    }
+
     // if something wrong with config print help message
     if (not validate_config()) {
       std::cout << desc << std::endl;
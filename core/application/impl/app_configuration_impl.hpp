@@ -110,6 +110,9 @@ namespace kagome::application {
     uint32_t maxWsConnections() const override {
       return max_ws_connections_;
     }
+    const api::WsOutboundConfig &wsOutboundConfig() const override {
+      return ws_outbound_config_;
+    }
     log::Level verbosity() const override {
       return verbosity_;
     }
@@ -119,9 +122,15 @@ namespace kagome::application {
     const network::PeeringConfig &peeringConfig() const override {
       return peering_config_;
     }
+    const ThreadingConfig &threadingConfig() const override {
+      return threading_config_;
+    }
     bool isRunInDevMode() const override {
       return dev_mode_;
     }
+    bool isRuntimeProfilingEnabled() const override {
+      return runtime_profiling_;
+    }
     const std::string &nodeName() const override {
       return node_name_;
     }
@@ -196,9 +205,13 @@ namespace kagome::application {
     uint16_t rpc_ws_port_;
     uint16_t openmetrics_http_port_;
     network::PeeringConfig peering_config_;
+    ThreadingConfig threading_config_;
     bool dev_mode_;
+    bool runtime_profiling_;
     std::string node_name_;
     uint32_t max_ws_connections_;
+    api::WsOutboundConfig ws_outbound_config_;
+    std::string ws_overflow_policy_;
   };
 
 }  // namespace kagome::application
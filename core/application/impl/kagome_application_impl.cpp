@@ -5,8 +5,6 @@
 
 #include "application/impl/kagome_application_impl.hpp"
 
-#include <thread>
-
 #include "application/impl/util.hpp"
 #include "consensus/babe/babe.hpp"
 
@@ -26,6 +24,7 @@ namespace kagome::application {
     app_state_manager_ = injector_->injectAppStateManager();
 
     io_context_ = injector_->injectIoContext();
+    main_pool_ = std::make_unique<common::ThreadPool>("main", 1, io_context_);
     clock_ = injector_->injectSystemClock();
     babe_ = injector_->injectBabe();
     exposer_ = injector_->injectOpenMetricsService();
@@ -34,6 +33,7 @@ namespace kagome::application {
     peer_manager_ = injector_->injectPeerManager();
     jrpc_api_service_ = injector_->injectRpcApiService();
     sync_observer_ = injector_->injectSyncObserver();
+    pool_maintainer_ = injector_->injectPoolMaintainer();
   }
 
   void KagomeApplicationImpl::run() {
@@ -50,13 +50,12 @@ namespace kagome::application {
       exit(EXIT_FAILURE);
     }
 
-    app_state_manager_->atLaunch([ctx{io_context_}] {
-      std::thread asio_runner([ctx{ctx}] { ctx->run(); });
-      asio_runner.detach();
+    app_state_manager_->atLaunch([this] {
+      main_pool_->start();
       return true;
     });
 
-    app_state_manager_->atShutdown([ctx{io_context_}] { ctx->stop(); });
+    app_state_manager_->atShutdown([this] { main_pool_->stop(); });
 
     app_state_manager_->run();
   }
@@ -11,6 +11,7 @@
 #include "application/app_configuration.hpp"
 #include "application/app_state_manager.hpp"
 #include "application/chain_spec.hpp"
+#include "common/thread_pool.hpp"
 #include "injector/application_injector.hpp"
 
 namespace kagome::application {
@@ -35,6 +36,8 @@ namespace kagome::application {
     log::Logger logger_;
 
     sptr<boost::asio::io_context> io_context_;
+    /// serves main io_context shared by network, consensus and block import
+    uptr<common::ThreadPool> main_pool_;
     sptr<AppStateManager> app_state_manager_;
     sptr<ChainSpec> chain_spec_;
     sptr<clock::SystemClock> clock_;
@@ -45,6 +48,7 @@ namespace kagome::application {
     sptr<network::PeerManager> peer_manager_;
     sptr<api::ApiService> jrpc_api_service_;
     sptr<network::SyncProtocolObserver> sync_observer_;
+    sptr<transaction_pool::PoolMaintainer> pool_maintainer_;
     const std::string node_name_;
   };
 
@@ -0,0 +1,32 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_APPLICATION_THREADING_CONFIG
+#define KAGOME_APPLICATION_THREADING_CONFIG
+
+#include <cstdint>
+
+namespace kagome::application {
+
+  /**
+   * Amounts of threads of the pools the work of the node is distributed over.
+   * Network I/O, consensus and block import share the main io_context served
+   * by one thread, as they rely on the block tree being modified sequentially.
+   * Work which only reads the chain is handed off to the dedicated pools
+   */
+  struct ThreadingConfig {
+    /// Threads serving RPC requests
+    uint32_t rpc_threads = 1;
+
+    /// Threads serving incoming block requests of syncing peers
+    uint32_t sync_requests_threads = 2;
+
+    /// Threads checking signatures of GRANDPA votes received from peers
+    uint32_t grandpa_threads = 2;
+  };
+
+}  // namespace kagome::application
+
+#endif  // KAGOME_APPLICATION_THREADING_CONFIG
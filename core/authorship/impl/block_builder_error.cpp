@@ -11,6 +11,8 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::authorship, BlockBuilderError, e) {
   switch (e) {
     case BlockBuilderError::EXTRINSIC_APPLICATION_FAILED:
       return "extrinsic was not applied";
+    case BlockBuilderError::BLOCK_IS_FULL:
+      return "extrinsic was not applied, because block is full";
   }
   return "unknown error";
 }
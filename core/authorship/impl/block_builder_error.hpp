@@ -10,7 +10,10 @@
 
 namespace kagome::authorship {
 
-  enum class BlockBuilderError { EXTRINSIC_APPLICATION_FAILED = 1 };
+  enum class BlockBuilderError {
+    EXTRINSIC_APPLICATION_FAILED = 1,
+    BLOCK_IS_FULL
+  };
 
 }
 
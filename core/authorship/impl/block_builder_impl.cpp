@@ -52,8 +52,14 @@ namespace kagome::authorship {
               return extrinsics_.size() - 1;
           }
         },
-        [this, &extrinsic](primitives::ApplyError)
+        [this, &extrinsic](primitives::ApplyError apply_error)
             -> outcome::result<primitives::ExtrinsicIndex> {
+          if (apply_error == primitives::ApplyError::FULL_BLOCK) {
+            SL_DEBUG(logger_,
+                     "Extrinsic {} was not pushed to block. Block is full",
+                     extrinsic.data.toHex().substr(0, 8));
+            return BlockBuilderError::BLOCK_IS_FULL;
+          }
           logger_->warn(logger_error_template,
                         extrinsic.data.toHex().substr(0, 8));
           return BlockBuilderError::EXTRINSIC_APPLICATION_FAILED;
@@ -5,8 +5,28 @@
 
 #include "authorship/impl/proposer_impl.hpp"
 
+#include <map>
+#include <optional>
+#include <queue>
+#include <set>
+#include <unordered_map>
+
+#include "authorship/impl/block_builder_error.hpp"
+#include "metrics/timing.hpp"
+
+namespace {
+  constexpr const char *kBlockConstructedHistogramName =
+      "kagome_proposer_block_constructed_seconds";
+  constexpr const char *kTransactionsInBlockHistogramName =
+      "kagome_proposer_number_of_transactions";
+  constexpr const char *kDeadlineReachedCounterName =
+      "kagome_proposer_deadline_reached_total";
+}  // namespace
+
 namespace kagome::authorship {
 
+  using primitives::Transaction;
+
   ProposerImpl::ProposerImpl(
       std::shared_ptr<BlockBuilderFactory> block_builder_factory,
       std::shared_ptr<transaction_pool::TransactionPool> transaction_pool,
@@ -14,23 +34,49 @@ namespace kagome::authorship {
       std::shared_ptr<primitives::events::ExtrinsicSubscriptionEngine>
           ext_sub_engine,
       std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
-          extrinsic_event_key_repo)
+          extrinsic_event_key_repo,
+      std::shared_ptr<clock::SystemClock> clock,
+      Configuration configuration)
       : block_builder_factory_{std::move(block_builder_factory)},
         transaction_pool_{std::move(transaction_pool)},
         r_block_builder_{std::move(r_block_builder)},
         ext_sub_engine_{std::move(ext_sub_engine)},
-        extrinsic_event_key_repo_{std::move(extrinsic_event_key_repo)} {
+        extrinsic_event_key_repo_{std::move(extrinsic_event_key_repo)},
+        clock_{std::move(clock)},
+        config_{configuration} {
     BOOST_ASSERT(block_builder_factory_);
     BOOST_ASSERT(transaction_pool_);
     BOOST_ASSERT(r_block_builder_);
     BOOST_ASSERT(ext_sub_engine_);
     BOOST_ASSERT(extrinsic_event_key_repo_);
+    BOOST_ASSERT(clock_);
+
+    // initialize metrics
+    registry_->registerHistogramFamily(kBlockConstructedHistogramName,
+                                       "Time taken to construct new block");
+    block_constructed_time_ = registry_->registerHistogramMetric(
+        kBlockConstructedHistogramName,
+        {0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10});
+    registry_->registerHistogramFamily(
+        kTransactionsInBlockHistogramName,
+        "Number of transactions included in the constructed block");
+    transactions_in_block_ = registry_->registerHistogramMetric(
+        kTransactionsInBlockHistogramName,
+        {0, 1, 5, 10, 50, 100, 500, 1000, 5000, 10000});
+    registry_->registerCounterFamily(
+        kDeadlineReachedCounterName,
+        "Number of blocks which construction was stopped by the deadline");
+    deadline_reached_ =
+        registry_->registerCounterMetric(kDeadlineReachedCounterName);
   }
 
   outcome::result<primitives::Block> ProposerImpl::propose(
       const primitives::BlockNumber &parent_block_number,
       const primitives::InherentData &inherent_data,
-      const primitives::Digest &inherent_digest) {
+      const primitives::Digest &inherent_digest,
+      clock::SystemClock::TimePoint deadline) {
+    const auto start_time = clock_->now();
+
     OUTCOME_TRY(
         block_builder,
         block_builder_factory_->create(parent_block_number, inherent_digest));
@@ -51,6 +97,7 @@ namespace kagome::authorship {
                     message);
     };
 
+    size_t block_size = 0;
     for (const auto &xt : inherent_xts) {
       SL_DEBUG(logger_, "Adding inherent extrinsic: {}", xt.data.toHex());
       auto inserted_res = block_builder->pushExtrinsic(xt);
@@ -58,38 +105,160 @@ namespace kagome::authorship {
         log_push_warn(xt, inserted_res.error().message());
         return inserted_res.error();
       }
+      block_size += xt.data.size();
     }
 
-    const auto &ready_txs = transaction_pool_->getReadyTransactions();
+    using ReadyTx = std::shared_ptr<const Transaction>;
+
+    // Ready transactions depend only on the ones provided by other ready
+    // transactions, so a transaction requiring any tag waits until all its
+    // providers are included into the block
+    std::set<Transaction::Tag> included_tags;
+    std::map<Transaction::Tag, std::vector<ReadyTx>> blocked_by_tag;
+    std::unordered_map<Transaction::Hash, size_t> unresolved_tags;
+
+    // transactions unblocked during block construction; they are merged with
+    // the ones coming from the pool in order of priority
+    auto by_priority = [](const ReadyTx &lhs, const ReadyTx &rhs) {
+      return lhs->priority < rhs->priority;
+    };
+    std::priority_queue<ReadyTx, std::vector<ReadyTx>, decltype(by_priority)>
+        unblocked_txs(by_priority);
 
-    for (const auto &[hash, tx] : ready_txs) {
-      auto& tx_ref = tx;
-      SL_DEBUG(logger_, "Adding extrinsic: {}", tx_ref->ext.data.toHex());
+    size_t included_txs = 0;
+    std::vector<Transaction::Hash> invalid_txs;
+    size_t skipped = 0;
+    bool deadline_reached = false;
+
+    // returns false when block construction has to be stopped
+    auto push_tx = [&](const ReadyTx &tx) {
+      if (clock_->now() >= deadline) {
+        deadline_reached = true;
+        return false;
+      }
+
+      if (block_size + tx->ext.data.size() > config_.block_size_limit) {
+        if (++skipped > config_.max_skipped_transactions) {
+          SL_DEBUG(logger_, "Block size limit is reached");
+          return false;
+        }
+        return true;
+      }
+
+      SL_DEBUG(logger_, "Adding extrinsic: {}", tx->ext.data.toHex());
       auto inserted_res = block_builder->pushExtrinsic(tx->ext);
       if (not inserted_res) {
+        if (inserted_res.error() == BlockBuilderError::BLOCK_IS_FULL) {
+          // transaction stays in the pool for the next blocks
+          if (++skipped > config_.max_skipped_transactions) {
+            SL_DEBUG(logger_, "Block is full");
+            return false;
+          }
+          return true;
+        }
         log_push_warn(tx->ext, inserted_res.error().message());
-        continue;
+        invalid_txs.push_back(tx->hash);
+        return true;
       }
+      block_size += tx->ext.data.size();
+      ++included_txs;
+
       if (tx->observed_id.has_value()) {
         extrinsic_event_key_repo_->upgradeTransaction(tx->observed_id.value(),
                                                       parent_block_number + 1,
                                                       inserted_res.value());
       }
+
+      // unblock transactions waiting for the tags provided by included one
+      for (const auto &tag : tx->provides) {
+        included_tags.insert(tag);
+        auto node = blocked_by_tag.extract(tag);
+        if (node.empty()) {
+          continue;
+        }
+        for (auto &blocked_tx : node.mapped()) {
+          if (--unresolved_tags[blocked_tx->hash] == 0) {
+            unresolved_tags.erase(blocked_tx->hash);
+            unblocked_txs.push(std::move(blocked_tx));
+          }
+        }
+      }
+      return true;
+    };
+
+    // pushes unblocked transactions of priority higher than the given one, or
+    // all of them if none is given
+    auto push_unblocked_txs =
+        [&](std::optional<Transaction::Priority> priority) {
+      while (not unblocked_txs.empty()
+             and (not priority or unblocked_txs.top()->priority > *priority)) {
+        auto tx = unblocked_txs.top();
+        unblocked_txs.pop();
+        if (not push_tx(tx)) {
+          return false;
+        }
+      }
+      return true;
+    };
+
+    // the pool is changed by other threads while the runtime applies the
+    // transactions, so the block is built of a copy of its ready queue
+    const auto ready_txs = transaction_pool_->getBestReadyTransactions();
+    bool stopped = false;
+    for (const auto &tx : ready_txs) {
+      if (not push_unblocked_txs(tx->priority)) {
+        stopped = true;
+        break;
+      }
+
+      size_t unresolved = 0;
+      for (const auto &tag : tx->requires) {
+        if (included_tags.count(tag) == 0) {
+          blocked_by_tag[tag].push_back(tx);
+          ++unresolved;
+        }
+      }
+      if (unresolved != 0) {
+        unresolved_tags.emplace(tx->hash, unresolved);
+        continue;
+      }
+
+      if (not push_tx(tx)) {
+        stopped = true;
+        break;
+      }
+    }
+    if (not stopped) {
+      push_unblocked_txs(std::nullopt);
+    }
+
+    if (deadline_reached) {
+      deadline_reached_->inc();
+      logger_->info(
+          "Deadline of block construction is reached, {} of {} ready "
+          "transactions are included",
+          included_txs,
+          ready_txs.size());
     }
 
     OUTCOME_TRY(block, block_builder->bake());
 
-    for (const auto &[hash, tx] : ready_txs) {
+    // included transactions stay in the pool until the block is imported, as
+    // the block may be discarded; the ones failed to apply are removed
+    for (const auto &hash : invalid_txs) {
       auto removed_res = transaction_pool_->removeOne(hash);
       if (not removed_res) {
         logger_->error(
-            "Can't remove extrinsic (hash={}) after adding to the block. "
-            "Reason: {}",
+            "Can't remove invalid extrinsic (hash={}). Reason: {}",
             hash.toHex(),
             removed_res.error().message());
       }
     }
 
+    block_constructed_time_->observe(
+        metrics::toSeconds(clock_->now() - start_time));
+    transactions_in_block_->observe(included_txs);
+
     return std::move(block);
   }
 
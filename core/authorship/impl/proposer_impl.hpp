@@ -9,15 +9,32 @@
 #include "authorship/proposer.hpp"
 
 #include "authorship/block_builder_factory.hpp"
+#include "clock/clock.hpp"
 #include "log/logger.hpp"
+#include "metrics/metrics.hpp"
 #include "runtime/block_builder.hpp"
 #include "subscription/extrinsic_event_key_repository.hpp"
 #include "transaction_pool/transaction_pool.hpp"
 
 namespace kagome::authorship {
 
+  /**
+   * Builds a block of the ready transactions of the pool. Transactions are
+   * taken in order of priority, a transaction is considered only after all of
+   * ready transactions providing tags it requires are included. Building stops
+   * at the deadline or when the block is full
+   */
   class ProposerImpl : public Proposer {
    public:
+    struct Configuration {
+      /// Max size of extrinsics in the block
+      size_t block_size_limit = 4 * 1024 * 1024;
+
+      /// Max amount of transactions skipped because of full block, after
+      /// which building of the block stops
+      size_t max_skipped_transactions = 8;
+    };
+
     ~ProposerImpl() override = default;
 
     ProposerImpl(
@@ -27,12 +44,15 @@ namespace kagome::authorship {
         std::shared_ptr<primitives::events::ExtrinsicSubscriptionEngine>
             ext_sub_engine,
         std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
-            extrinsic_event_key_repo);
+            extrinsic_event_key_repo,
+        std::shared_ptr<clock::SystemClock> clock,
+        Configuration configuration);
 
     outcome::result<primitives::Block> propose(
         const primitives::BlockNumber &parent_block_number,
         const primitives::InherentData &inherent_data,
-        const primitives::Digest &inherent_digest) override;
+        const primitives::Digest &inherent_digest,
+        clock::SystemClock::TimePoint deadline) override;
 
    private:
     std::shared_ptr<BlockBuilderFactory> block_builder_factory_;
@@ -42,7 +62,15 @@ namespace kagome::authorship {
         ext_sub_engine_;
     std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
         extrinsic_event_key_repo_;
+    std::shared_ptr<clock::SystemClock> clock_;
+    const Configuration config_;
     log::Logger logger_ = log::createLogger("Proposer", "authorship");
+
+    // metrics
+    metrics::RegistryPtr registry_ = metrics::createRegistry();
+    metrics::Histogram *block_constructed_time_;
+    metrics::Histogram *transactions_in_block_;
+    metrics::Counter *deadline_reached_;
   };
 
 }  // namespace kagome::authorship
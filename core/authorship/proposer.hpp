@@ -22,16 +22,19 @@ namespace kagome::authorship {
     virtual ~Proposer() = default;
 
     /**
-     * Creates block from provided parameters
+     * Creates block from provided parameters. Transactions included into the
+     * block are left in the pool, they are removed once the block is imported
      * @param parent_block_number number of parent
      * @param inherent_data additional data on block from unsigned extrinsics
      * @param inherent_digests - chain-specific block auxilary data
+     * @param deadline - moment after which no more transactions are applied
      * @return proposed block or error
      */
     virtual outcome::result<primitives::Block> propose(
         const primitives::BlockNumber &parent_block_number,
         const primitives::InherentData &inherent_data,
-        const primitives::Digest &inherent_digest) = 0;
+        const primitives::Digest &inherent_digest,
+        clock::SystemClock::TimePoint deadline) = 0;
   };
 
 }  // namespace kagome::authorship
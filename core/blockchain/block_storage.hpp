@@ -6,6 +6,9 @@
 #ifndef KAGOME_BLOCK_STORAGE_HPP
 #define KAGOME_BLOCK_STORAGE_HPP
 
+#include <boost/optional.hpp>
+
+#include "consensus/babe/types/epoch_digest.hpp"
 #include "primitives/block.hpp"
 #include "primitives/block_data.hpp"
 #include "primitives/block_id.hpp"
@@ -30,6 +33,18 @@ namespace kagome::blockchain {
     virtual outcome::result<void> setLastFinalizedBlockHash(
         const primitives::BlockHash &) = 0;
 
+    /**
+     * Epoch digests in effect at the last finalized block are kept, so that
+     * they are not looked for in the chain on start
+     * @return digests saved for \arg block or none if it is not the block
+     * they were saved for
+     */
+    virtual outcome::result<boost::optional<consensus::EpochDigests>>
+    getEpochDigests(const primitives::BlockHash &block) const = 0;
+    virtual outcome::result<void> putEpochDigests(
+        const primitives::BlockHash &block,
+        const consensus::EpochDigests &digests) = 0;
+
     virtual outcome::result<primitives::BlockHeader> getBlockHeader(
         const primitives::BlockId &id) const = 0;
     virtual outcome::result<primitives::BlockBody> getBlockBody(
@@ -53,6 +68,13 @@ namespace kagome::blockchain {
         const primitives::BlockHash &hash,
         const primitives::BlockNumber &number) = 0;
 
+    /**
+     * Makes the block the one found by its number, which is the block of the
+     * canonical chain once it is finalized
+     */
+    virtual outcome::result<void> assignNumberToHash(
+        const primitives::BlockInfo &block) = 0;
+
     virtual outcome::result<void> removeBlock(
         const primitives::BlockHash &hash,
         const primitives::BlockNumber &number) = 0;
@@ -68,6 +68,16 @@ namespace kagome::blockchain {
         finalized{finalized} {
     BOOST_ASSERT(parent != nullptr or next_epoch_digest_opt.has_value());
     if (parent) {
+      // jumps over two equal spans are merged into one over both of them
+      auto parent_jump = parent->jump.lock();
+      auto parent_jump_jump = parent_jump ? parent_jump->jump.lock() : nullptr;
+      if (parent_jump_jump
+          and parent->depth - parent_jump->depth
+                  == parent_jump->depth - parent_jump_jump->depth) {
+        jump = parent_jump_jump;
+      } else {
+        jump = parent;
+      }
       epoch_digest = epoch_number != parent->epoch_number
                          ? parent->next_epoch_digest
                          : epoch_digest = parent->epoch_digest;
@@ -90,66 +100,20 @@ namespace kagome::blockchain {
     }
   }
 
-  boost::optional<std::vector<std::shared_ptr<BlockTreeImpl::TreeNode>>>
-  BlockTreeImpl::TreeNode::getPathTo(const primitives::BlockHash &hash) {
-    std::vector<std::shared_ptr<TreeNode>> stack{shared_from_this()};
-    std::unordered_map<primitives::BlockNumber, size_t> forks;
-
-    bool came_back = false;
-    while (not stack.empty()) {
-      auto &current = stack.back();
-
-      // Found
-      if (current->block_hash == hash) {
-        return stack;
-      }
-
-      // Straight
-      if (current->children.size() == 1) {
-        if (not came_back) {
-          // Go to children
-          stack.push_back(current->children.front());
-          continue;
-        }
-        // else - continue going back
-      }
-
-      // Fork
-      if (current->children.size() > 1) {
-        auto &children_index = forks[current->depth];
-        if (children_index < current->children.size()) {
-          // Go to next child
-          stack.push_back(current->children[children_index++]);
-          came_back = false;
-          continue;
-        }
-        // else (no more children) - going back
-      }
-
-      // Going back
-      forks.erase(current->depth);
-      stack.pop_back();
-      came_back = true;
-    }
-    return boost::none;
-  }
-
-  std::shared_ptr<BlockTreeImpl::TreeNode> BlockTreeImpl::TreeNode::getByHash(
-      const primitives::BlockHash &hash) {
-    // standard BFS
-    std::queue<std::shared_ptr<TreeNode>> nodes_to_scan;
-    nodes_to_scan.push(shared_from_this());
-    while (!nodes_to_scan.empty()) {
-      const auto &node = nodes_to_scan.front();
-      if (node->block_hash == hash) {
-        return node;
-      }
-      for (const auto &child : node->children) {
-        nodes_to_scan.push(child);
+  std::shared_ptr<BlockTreeImpl::TreeNode>
+  BlockTreeImpl::TreeNode::getAncestorAt(primitives::BlockNumber depth) {
+    auto node = shared_from_this();
+    while (node->depth > depth) {
+      auto jump = node->jump.lock();
+      if (jump and jump->depth >= depth) {
+        node = std::move(jump);
+      } else if (auto parent = node->parent.lock()) {
+        node = std::move(parent);
+      } else {
+        return nullptr;
       }
-      nodes_to_scan.pop();
     }
-    return nullptr;
+    return node;
   }
 
   bool BlockTreeImpl::TreeNode::operator==(const TreeNode &other) const {
@@ -226,6 +190,14 @@ namespace kagome::blockchain {
     boost::optional<consensus::EpochDigest> next_epoch;
     auto hash_tmp = hash;
 
+    // digests of the last finalized block are saved on finalization
+    OUTCOME_TRY(saved_digests, storage->getEpochDigests(hash));
+    if (saved_digests.has_value()) {
+      curr_epoch_number = saved_digests->epoch_number;
+      curr_epoch.emplace(std::move(saved_digests->epoch));
+      next_epoch.emplace(std::move(saved_digests->next_epoch));
+    }
+
     // We are going block by block to genesis direction and observes them for
     // find epoch digest. First found digest if it in the block assigned to the
     // current epoch will be saved as digest planned for next epoch. First found
@@ -233,7 +205,7 @@ namespace kagome::blockchain {
     // digest for current epoch (and planned for next epoch, if it not defined
     // yet).
 
-    for (;;) {
+    while (not curr_epoch.has_value()) {
       if (hash_tmp == primitives::BlockHash{}) {
         if (not curr_epoch_number.has_value()) {
           curr_epoch_number = 0;
@@ -320,6 +292,14 @@ namespace kagome::blockchain {
              curr_epoch.value().randomness,
              next_epoch.value().randomness);
 
+    if (not saved_digests.has_value()) {
+      OUTCOME_TRY(storage->putEpochDigests(
+          hash,
+          consensus::EpochDigests{.epoch_number = curr_epoch_number.value(),
+                                  .epoch = curr_epoch.value(),
+                                  .next_epoch = next_epoch.value()}));
+    }
+
     auto tree = std::make_shared<TreeNode>(hash,
                                            number,
                                            std::move(curr_epoch.value()),
@@ -381,6 +361,7 @@ namespace kagome::blockchain {
     BOOST_ASSERT(runtime_core_ != nullptr);
     BOOST_ASSERT(babe_configuration_ != nullptr);
     BOOST_ASSERT(babe_util_ != nullptr);
+    nodes_by_hash_.emplace(tree_->block_hash, tree_);
     // initialize metrics
     registry_->registerGaugeFamily(kBlockHeightGaugeName,
                                      "Block height info of the chain");
@@ -394,7 +375,7 @@ namespace kagome::blockchain {
 
   outcome::result<void> BlockTreeImpl::addBlockHeader(
       const primitives::BlockHeader &header) {
-    auto parent = tree_->getByHash(header.parent_hash);
+    auto parent = findNode(header.parent_hash);
     if (!parent) {
       return BlockTreeError::NO_PARENT;
     }
@@ -418,6 +399,8 @@ namespace kagome::blockchain {
         block_hash, header.number, parent, epoch_number, std::move(next_epoch));
     parent->children.push_back(new_node);
 
+    nodes_by_hash_.emplace(new_node->block_hash, new_node);
+
     tree_meta_->leaves.insert(new_node->block_hash);
     tree_meta_->leaves.erase(parent->block_hash);
     if (new_node->depth > tree_meta_->deepest_leaf.get().depth) {
@@ -434,6 +417,8 @@ namespace kagome::blockchain {
     auto parent = new_node->parent.lock();
     parent->children.push_back(new_node);
 
+    nodes_by_hash_.emplace(new_node->block_hash, new_node);
+
     tree_meta_->leaves.insert(new_node->block_hash);
     tree_meta_->leaves.erase(parent->block_hash);
     if (new_node->depth > tree_meta_->deepest_leaf.get().depth) {
@@ -444,7 +429,7 @@ namespace kagome::blockchain {
   outcome::result<void> BlockTreeImpl::addBlock(
       const primitives::Block &block) {
     // Check if we know parent of this block; if not, we cannot insert it
-    auto parent = tree_->getByHash(block.header.parent_hash);
+    auto parent = findNode(block.header.parent_hash);
     if (!parent) {
       return BlockTreeError::NO_PARENT;
     }
@@ -493,13 +478,13 @@ namespace kagome::blockchain {
   outcome::result<void> BlockTreeImpl::addExistingBlock(
       const primitives::BlockHash &block_hash,
       const primitives::BlockHeader &block_header) {
-    auto node = tree_->getByHash(block_hash);
+    auto node = findNode(block_hash);
     // Check if tree doesn't have this block; if not, we skip that
     if (node != nullptr) {
       return BlockTreeError::BLOCK_EXISTS;
     }
     // Check if we know parent of this block; if not, we cannot insert it
-    auto parent = tree_->getByHash(block_header.parent_hash);
+    auto parent = findNode(block_header.parent_hash);
     if (parent == nullptr) {
       return BlockTreeError::NO_PARENT;
     }
@@ -540,7 +525,7 @@ namespace kagome::blockchain {
   outcome::result<void> BlockTreeImpl::finalize(
       const primitives::BlockHash &block_hash,
       const primitives::Justification &justification) {
-    auto node = tree_->getByHash(block_hash);
+    auto node = findNode(block_hash);
     if (!node) {
       return BlockTreeError::NO_SUCH_BLOCK;
     }
@@ -558,13 +543,31 @@ namespace kagome::blockchain {
 
     OUTCOME_TRY(prune(node));
 
+    // forks of the finalized blocks are pruned, so their numbers are assigned
+    // back to the blocks of the canonical chain
+    for (auto current = node; current and current != tree_;
+         current = current->parent.lock()) {
+      OUTCOME_TRY(storage_->assignNumberToHash(
+          {current->depth, current->block_hash}));
+    }
+
     tree_ = node;
 
     tree_meta_ = std::make_shared<TreeMeta>(*tree_);
 
     tree_->parent.reset();
 
+    // nodes of the blocks below the root are released
+    for (auto it = nodes_by_hash_.begin(); it != nodes_by_hash_.end();) {
+      it = it->second.expired() ? nodes_by_hash_.erase(it) : std::next(it);
+    }
+
     OUTCOME_TRY(storage_->setLastFinalizedBlockHash(node->block_hash));
+    OUTCOME_TRY(storage_->putEpochDigests(
+        node->block_hash,
+        consensus::EpochDigests{.epoch_number = node->epoch_number,
+                                .epoch = *node->epoch_digest,
+                                .next_epoch = *node->next_epoch_digest}));
     OUTCOME_TRY(header, storage_->getBlockHeader(node->block_hash));
 
     chain_events_engine_->notify(
@@ -682,6 +685,10 @@ namespace kagome::blockchain {
             tryGetChainByBlocksFromCache(top_block, bottom_block, max_count)) {
       return std::move(from_cache.value());
     }
+    if (auto from_index =
+            tryGetChainByBlocksFromIndex(top_block, bottom_block, max_count)) {
+      return std::move(from_index.value());
+    }
 
     OUTCOME_TRY(from, header_repo_->getNumberByHash(top_block));
     OUTCOME_TRY(to, header_repo_->getNumberByHash(bottom_block));
@@ -726,36 +733,118 @@ namespace kagome::blockchain {
     return result;
   }
 
+  boost::optional<primitives::BlockNumber> BlockTreeImpl::getFinalizedNumber(
+      const primitives::BlockHash &hash) const {
+    auto number_res = header_repo_->getNumberByHash(hash);
+    if (not number_res or number_res.value() > tree_->depth) {
+      return boost::none;
+    }
+    auto canon_hash_res = header_repo_->getHashByNumber(number_res.value());
+    if (not canon_hash_res or canon_hash_res.value() != hash) {
+      return boost::none;
+    }
+    return number_res.value();
+  }
+
+  std::shared_ptr<BlockTreeImpl::TreeNode> BlockTreeImpl::findNode(
+      const primitives::BlockHash &hash) const {
+    if (auto it = nodes_by_hash_.find(hash); it != nodes_by_hash_.end()) {
+      return it->second.lock();
+    }
+    return nullptr;
+  }
+
   boost::optional<std::vector<primitives::BlockHash>>
-  BlockTreeImpl::tryGetChainByBlocksFromCache(
+  BlockTreeImpl::tryGetChainByBlocksFromIndex(
       const primitives::BlockHash &top_block,
       const primitives::BlockHash &bottom_block,
-      boost::optional<uint32_t> max_count) {
-    if (auto from = tree_->getByHash(top_block)) {
-      if (auto way_opt = from->getPathTo(bottom_block)) {
-        auto &way = way_opt.value();
-        const auto in_tree_branch_len = way.back()->depth - from->depth + 1;
-        const auto response_length =
-            max_count ? std::min(in_tree_branch_len, max_count.value())
-                      : in_tree_branch_len;
-        SL_TRACE(log_,
-                 "Create {} length chain from number {} to {} from cache.",
-                 response_length,
-                 from->depth,
-                 way.back()->depth);
-
-        way.resize(response_length);
-
-        std::vector<primitives::BlockHash> result;
-        result.reserve(response_length);
-        for (auto &s : way) {
-          result.emplace_back(s->block_hash);
-        }
+      boost::optional<uint32_t> max_count) const {
+    auto from_opt = getFinalizedNumber(top_block);
+    if (not from_opt) {
+      return boost::none;
+    }
+    auto from = from_opt.value();
+
+    primitives::BlockNumber to;  // NOLINT
+    auto bottom_node = findNode(bottom_block);
+    if (bottom_node) {
+      to = bottom_node->depth;
+    } else if (auto to_opt = getFinalizedNumber(bottom_block)) {
+      to = to_opt.value();
+    } else {
+      return boost::none;
+    }
 
-        return result;
+    std::vector<primitives::BlockHash> result;
+    if (to < from) {
+      return result;
+    }
+
+    const auto response_length =
+        max_count ? std::min(to - from + 1, max_count.value())
+                  : (to - from + 1);
+    const auto end = from + response_length;
+    result.reserve(response_length);
+
+    SL_TRACE(log_,
+             "Create {} length chain from number {} to {} from index.",
+             response_length,
+             from,
+             to);
+
+    // the finalized part of the chain is in the index
+    for (auto number = from; number < std::min(end, tree_->depth); ++number) {
+      auto hash_res = header_repo_->getHashByNumber(number);
+      if (not hash_res) {
+        return boost::none;
+      }
+      result.emplace_back(hash_res.value());
+    }
+
+    // and the rest of it is in the tree, only the bottom block may be deeper
+    // than the last finalized one
+    if (end > tree_->depth) {
+      BOOST_ASSERT(bottom_node);
+      auto tail_begin = result.size();
+      for (auto node = bottom_node; node; node = node->parent.lock()) {
+        if (node->depth < end) {
+          result.emplace_back(node->block_hash);
+        }
       }
+      std::reverse(result.begin() + tail_begin, result.end());
     }
-    return boost::none;
+    return result;
+  }
+
+  boost::optional<std::vector<primitives::BlockHash>>
+  BlockTreeImpl::tryGetChainByBlocksFromCache(
+      const primitives::BlockHash &top_block,
+      const primitives::BlockHash &bottom_block,
+      boost::optional<uint32_t> max_count) {
+    auto from = findNode(top_block);
+    auto to = findNode(bottom_block);
+    if (not from or not to or to->getAncestorAt(from->depth) != from) {
+      return boost::none;
+    }
+    const auto in_tree_branch_len = to->depth - from->depth + 1;
+    const auto response_length =
+        max_count ? std::min(in_tree_branch_len, max_count.value())
+                  : in_tree_branch_len;
+    SL_TRACE(log_,
+             "Create {} length chain from number {} to {} from cache.",
+             response_length,
+             from->depth,
+             to->depth);
+
+    // the branch is walked up from its end, so the jumps skip the part which
+    // is beyond the requested length
+    std::vector<primitives::BlockHash> result(response_length);
+    auto node = to->getAncestorAt(from->depth + response_length - 1);
+    for (auto i = response_length; i > 0; --i) {
+      result[i - 1] = node->block_hash;
+      node = node->parent.lock();
+    }
+    return result;
   }
 
   BlockTreeImpl::BlockHashVecRes BlockTreeImpl::getChainByBlocks(
@@ -766,20 +855,29 @@ namespace kagome::blockchain {
 
   bool BlockTreeImpl::hasDirectChain(const primitives::BlockHash &ancestor,
                                      const primitives::BlockHash &descendant) {
-    auto ancestor_node_ptr = tree_->getByHash(ancestor);
-    auto descendant_node_ptr = tree_->getByHash(descendant);
+    auto ancestor_node_ptr = findNode(ancestor);
+    auto descendant_node_ptr = findNode(descendant);
 
     // if both nodes are in our light tree, we can use this representation only
     if (ancestor_node_ptr && descendant_node_ptr) {
-      auto current_node = descendant_node_ptr;
-      while (current_node != ancestor_node_ptr) {
-        if (auto parent = current_node->parent; !parent.expired()) {
-          current_node = parent.lock();
-        } else {
-          return false;
-        }
+      return descendant_node_ptr->getAncestorAt(ancestor_node_ptr->depth)
+             == ancestor_node_ptr;
+    }
+
+    // a finalized block is an ancestor of all the blocks in the tree and of
+    // the finalized blocks with greater numbers, but not a descendant of the
+    // blocks in the tree
+    if (descendant_node_ptr) {
+      if (getFinalizedNumber(ancestor)) {
+        return true;
+      }
+    } else if (auto descendant_number = getFinalizedNumber(descendant)) {
+      if (ancestor_node_ptr) {
+        return false;
+      }
+      if (auto ancestor_number = getFinalizedNumber(ancestor)) {
+        return ancestor_number.value() <= descendant_number.value();
       }
-      return true;
     }
 
     // else, we need to use a database
@@ -824,6 +922,9 @@ namespace kagome::blockchain {
                       header_repo_->getHashByNumber(header.value().number));
           return primitives::BlockInfo{header.value().number, hash};
         }
+      } else if (target_header.number <= getLastFinalized().number) {
+        // all the leaves descend from the finalized blocks
+        return deepestLeaf();
       }
     } else {
       OUTCOME_TRY(last_finalized,
@@ -832,24 +933,42 @@ namespace kagome::blockchain {
         return Error::BLOCK_ON_DEAD_END;
       }
     }
-    for (auto &leaf_hash : getLeavesSorted()) {
-      auto current_hash = leaf_hash;
-      auto best_hash = current_hash;
-      if (max_number.has_value()) {
-        OUTCOME_TRY(hash, walkBackUntilLess(current_hash, max_number.value()));
-        best_hash = hash;
-        current_hash = hash;
+    // ancestors of the leaves in the tree are found by jumps, without
+    // reading the headers
+    if (auto target_node = findNode(target_hash)) {
+      for (auto &leaf_hash : getLeavesSorted()) {
+        auto best_node = findNode(leaf_hash);
+        if (max_number.has_value()) {
+          best_node = best_node->getAncestorAt(max_number.value());
+        }
+        if (best_node
+            and best_node->getAncestorAt(target_node->depth) == target_node) {
+          return primitives::BlockInfo{best_node->depth,
+                                       best_node->block_hash};
+        }
       }
-      OUTCOME_TRY(best_header, header_repo_->getBlockHeader(best_hash));
-      while (true) {
-        OUTCOME_TRY(current_header, header_repo_->getBlockHeader(current_hash));
-        if (current_hash == target_hash) {
-          return primitives::BlockInfo{best_header.number, best_hash};
+    } else {
+      for (auto &leaf_hash : getLeavesSorted()) {
+        auto current_hash = leaf_hash;
+        auto best_hash = current_hash;
+        if (max_number.has_value()) {
+          OUTCOME_TRY(hash,
+                      walkBackUntilLess(current_hash, max_number.value()));
+          best_hash = hash;
+          current_hash = hash;
         }
-        if (current_header.number < target_header.number) {
-          break;
+        OUTCOME_TRY(best_header, header_repo_->getBlockHeader(best_hash));
+        while (true) {
+          OUTCOME_TRY(current_header,
+                      header_repo_->getBlockHeader(current_hash));
+          if (current_hash == target_hash) {
+            return primitives::BlockInfo{best_header.number, best_hash};
+          }
+          if (current_header.number < target_header.number) {
+            break;
+          }
+          current_hash = current_header.parent_hash;
         }
-        current_hash = current_header.parent_hash;
       }
     }
 
@@ -873,7 +992,7 @@ namespace kagome::blockchain {
 
   BlockTreeImpl::BlockHashVecRes BlockTreeImpl::getChildren(
       const primitives::BlockHash &block) {
-    auto node = tree_->getByHash(block);
+    auto node = findNode(block);
     if (!node) {
       return BlockTreeError::NO_SUCH_BLOCK;
     }
@@ -895,8 +1014,7 @@ namespace kagome::blockchain {
   outcome::result<consensus::EpochDigest> BlockTreeImpl::getEpochDescriptor(
       consensus::EpochNumber epoch_number,
       primitives::BlockHash block_hash) const {
-    auto node = tree_->getByHash(block_hash);
-    if (node) {
+    if (auto node = findNode(block_hash)) {
       if (node->epoch_number != epoch_number) {
         return *node->next_epoch_digest;
       }
@@ -910,7 +1028,7 @@ namespace kagome::blockchain {
     auto leaves = getLeaves();
     leaf_depths.reserve(leaves.size());
     for (auto &leaf : leaves) {
-      auto leaf_node = tree_->getByHash(leaf);
+      auto leaf_node = findNode(leaf);
       leaf_depths.emplace_back(
           primitives::BlockInfo{leaf_node->depth, leaf_node->block_hash});
     }
@@ -930,6 +1048,12 @@ namespace kagome::blockchain {
   outcome::result<primitives::BlockHash> BlockTreeImpl::walkBackUntilLess(
       const primitives::BlockHash &start,
       const primitives::BlockNumber &limit) const {
+    if (auto node = findNode(start)) {
+      if (auto ancestor = node->getAncestorAt(limit)) {
+        return ancestor->block_hash;
+      }
+    }
+
     auto current_hash = start;
     while (true) {
       OUTCOME_TRY(current_header, header_repo_->getBlockHeader(current_hash));
@@ -986,6 +1110,7 @@ namespace kagome::blockchain {
         }
       }
 
+      nodes_by_hash_.erase(hash);
       OUTCOME_TRY(storage_->removeBlock(hash, number));
     }
 
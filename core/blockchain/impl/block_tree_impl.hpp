@@ -10,7 +10,7 @@
 
 #include <functional>
 #include <memory>
-#include <queue>
+#include <unordered_map>
 #include <unordered_set>
 
 #include <boost/optional.hpp>
@@ -60,6 +60,11 @@ namespace kagome::blockchain {
       primitives::BlockHash block_hash;
       primitives::BlockNumber depth;
       std::weak_ptr<TreeNode> parent;
+      /**
+       * Ancestor to skip to when looking for a deeper one. Jumps make a
+       * skew-binary list, so any ancestor is reached in O(log(depth)) steps
+       */
+      std::weak_ptr<TreeNode> jump;
       consensus::EpochNumber epoch_number;
       std::shared_ptr<consensus::EpochDigest> epoch_digest;
       std::shared_ptr<consensus::EpochDigest> next_epoch_digest;
@@ -68,13 +73,11 @@ namespace kagome::blockchain {
       std::vector<std::shared_ptr<TreeNode>> children{};
 
       /**
-       * Get a node of the tree, containing block with the specified hash, if it
-       * can be found
+       * Get the closest ancestor of this node, or the node itself, which is
+       * not deeper than \arg depth
+       * @return nullptr if there is no such node in the tree
        */
-      std::shared_ptr<TreeNode> getByHash(const primitives::BlockHash &hash);
-
-      boost::optional<std::vector<std::shared_ptr<TreeNode>>> getPathTo(
-          const primitives::BlockHash &hash);
+      std::shared_ptr<TreeNode> getAncestorAt(primitives::BlockNumber depth);
 
       bool operator==(const TreeNode &other) const;
       bool operator!=(const TreeNode &other) const;
@@ -236,6 +239,31 @@ namespace kagome::blockchain {
         const primitives::BlockHash &start,
         const primitives::BlockNumber &limit) const;
 
+    /**
+     * @return number of \param hash if it is a finalized block, which is
+     * checked with the number index instead of walking the chain. The index
+     * is canonical up to the last finalized block: finalization assigns the
+     * numbers, and the block storage re-indexes storages of older nodes once
+     * on load
+     */
+    boost::optional<primitives::BlockNumber> getFinalizedNumber(
+        const primitives::BlockHash &hash) const;
+
+    /**
+     * Finds a node of the tree by the index instead of searching the tree
+     * @return nullptr if the block is not in the tree
+     */
+    std::shared_ptr<TreeNode> findNode(const primitives::BlockHash &hash) const;
+
+    /**
+     * Makes a chain of blocks from the number index, if \param top_block is
+     * finalized and \param bottom_block is either finalized or in the tree
+     */
+    boost::optional<std::vector<primitives::BlockHash>>
+    tryGetChainByBlocksFromIndex(const primitives::BlockHash &top_block,
+                                 const primitives::BlockHash &bottom_block,
+                                 boost::optional<uint32_t> max_count) const;
+
     boost::optional<std::vector<primitives::BlockHash>>
     tryGetChainByBlocksFromCache(const primitives::BlockHash &top_block,
                                  const primitives::BlockHash &bottom_block,
@@ -263,6 +291,9 @@ namespace kagome::blockchain {
 
     std::shared_ptr<TreeNode> tree_;
     std::shared_ptr<TreeMeta> tree_meta_;
+    /// nodes of the tree, so that they are found without searching the tree
+    std::unordered_map<primitives::BlockHash, std::weak_ptr<TreeNode>>
+        nodes_by_hash_;
 
     std::shared_ptr<network::ExtrinsicObserver> extrinsic_observer_;
 
@@ -39,9 +39,10 @@ namespace kagome::blockchain {
   outcome::result<common::Hash256>
   KeyValueBlockHeaderRepository::getHashByNumber(
       const primitives::BlockNumber &number) const {
-    OUTCOME_TRY(header, getBlockHeader(number));
-    OUTCOME_TRY(enc_header, scale::encode(header));
-    return hasher_->blake2b_256(enc_header);
+    // the lookup key of a block contains its hash, so neither the header is
+    // read nor it is hashed
+    OUTCOME_TRY(key, idToLookupKey(*map_, number));
+    return lookupKeyToHash(key);
   }
 
   outcome::result<primitives::BlockHeader>
@@ -84,6 +84,9 @@ namespace kagome::blockchain {
     OUTCOME_TRY(block_header,
                 block_storage->getBlockHeader(last_finalized_block_hash));
 
+    OUTCOME_TRY(block_storage->ensureNumberIndexCanonical(
+        last_finalized_block_hash, block_header));
+
     primitives::Block finalized_block;
     finalized_block.header = block_header;
 
@@ -116,11 +119,38 @@ namespace kagome::blockchain {
     OUTCOME_TRY(storage->put(storage::kGenesisBlockHashLookupKey,
                              Buffer{genesis_block_hash}));
     OUTCOME_TRY(block_storage->setLastFinalizedBlockHash(genesis_block_hash));
+    OUTCOME_TRY(
+        storage->put(storage::kCanonicalNumberIndexLookupKey, Buffer{1}));
 
     on_genesis_created(genesis_block);
     return block_storage;
   }
 
+  outcome::result<void> KeyValueBlockStorage::ensureNumberIndexCanonical(
+      const primitives::BlockHash &last_finalized_hash,
+      primitives::BlockHeader last_finalized_header) {
+    if (storage_->contains(storage::kCanonicalNumberIndexLookupKey)) {
+      return outcome::success();
+    }
+
+    logger_->info(
+        "Assigning numbers to blocks of the finalized chain up to #{}, it is "
+        "done once",
+        last_finalized_header.number);
+    auto hash = last_finalized_hash;
+    auto header = std::move(last_finalized_header);
+    while (true) {
+      OUTCOME_TRY(putNumberToIndexKey(*storage_, {header.number, hash}));
+      if (header.number == 0) {
+        break;
+      }
+      hash = header.parent_hash;
+      OUTCOME_TRY(parent_header, getBlockHeader(hash));
+      header = std::move(parent_header);
+    }
+    return storage_->put(storage::kCanonicalNumberIndexLookupKey, Buffer{1});
+  }
+
   outcome::result<primitives::BlockHeader> KeyValueBlockStorage::getBlockHeader(
       const primitives::BlockId &id) const {
     OUTCOME_TRY(encoded_header, getWithPrefix(*storage_, Prefix::HEADER, id));
@@ -247,6 +277,11 @@ namespace kagome::blockchain {
     return outcome::success();
   }
 
+  outcome::result<void> KeyValueBlockStorage::assignNumberToHash(
+      const primitives::BlockInfo &block) {
+    return putNumberToIndexKey(*storage_, block);
+  }
+
   outcome::result<void> KeyValueBlockStorage::removeBlock(
       const primitives::BlockHash &hash,
       const primitives::BlockNumber &number) {
@@ -312,6 +347,34 @@ namespace kagome::blockchain {
     return outcome::success();
   }
 
+  outcome::result<boost::optional<consensus::EpochDigests>>
+  KeyValueBlockStorage::getEpochDigests(
+      const primitives::BlockHash &block) const {
+    auto encoded_res =
+        storage_->get(storage::kLastFinalizedEpochDigestsLookupKey);
+    if (encoded_res == outcome::failure(storage::DatabaseError::NOT_FOUND)) {
+      return boost::none;
+    }
+    if (not encoded_res) {
+      return encoded_res.as_failure();
+    }
+    using SavedDigests =
+        std::pair<primitives::BlockHash, consensus::EpochDigests>;
+    OUTCOME_TRY(saved, scale::decode<SavedDigests>(encoded_res.value()));
+    if (saved.first != block) {
+      return boost::none;
+    }
+    return std::move(saved.second);
+  }
+
+  outcome::result<void> KeyValueBlockStorage::putEpochDigests(
+      const primitives::BlockHash &block,
+      const consensus::EpochDigests &digests) {
+    OUTCOME_TRY(encoded, scale::encode(block, digests));
+    return storage_->put(storage::kLastFinalizedEpochDigestsLookupKey,
+                         Buffer{std::move(encoded)});
+  }
+
   outcome::result<void> KeyValueBlockStorage::ensureGenesisNotExists() const {
     auto res = getLastFinalizedBlockHash();
     if (res.has_value()) {
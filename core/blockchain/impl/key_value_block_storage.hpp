@@ -65,6 +65,12 @@ namespace kagome::blockchain {
     outcome::result<void> setLastFinalizedBlockHash(
         const primitives::BlockHash &) override;
 
+    outcome::result<boost::optional<consensus::EpochDigests>> getEpochDigests(
+        const primitives::BlockHash &block) const override;
+    outcome::result<void> putEpochDigests(
+        const primitives::BlockHash &block,
+        const consensus::EpochDigests &digests) override;
+
     outcome::result<primitives::BlockHeader> getBlockHeader(
         const primitives::BlockId &id) const override;
     outcome::result<primitives::BlockBody> getBlockBody(
@@ -87,6 +93,9 @@ namespace kagome::blockchain {
         const primitives::BlockHash &hash,
         const primitives::BlockNumber &number) override;
 
+    outcome::result<void> assignNumberToHash(
+        const primitives::BlockInfo &block) override;
+
     outcome::result<void> removeBlock(
         const primitives::BlockHash &hash,
         const primitives::BlockNumber &number) override;
@@ -97,6 +106,15 @@ namespace kagome::blockchain {
 
     outcome::result<void> ensureGenesisNotExists() const;
 
+    /**
+     * Assigns numbers to the blocks of the finalized chain ending with the
+     * given block, unless it has been done for the storage before. Storages
+     * written by older nodes may have numbers indexing blocks of pruned forks
+     */
+    outcome::result<void> ensureNumberIndexCanonical(
+        const primitives::BlockHash &last_finalized_hash,
+        primitives::BlockHeader last_finalized_header);
+
     std::shared_ptr<storage::BufferStorage> storage_;
     std::shared_ptr<crypto::Hasher> hasher_;
     log::Logger logger_;
@@ -5,6 +5,8 @@
 
 #include "blockchain/impl/storage_util.hpp"
 
+#include <algorithm>
+
 #include "blockchain/impl/common.hpp"
 #include "storage/database_error.hpp"
 
@@ -41,6 +43,14 @@ namespace kagome::blockchain {
     return map.put(value_lookup_key, value);
   }
 
+  outcome::result<void> putNumberToIndexKey(
+      storage::BufferStorage &map, const primitives::BlockInfo &block) {
+    auto num_to_idx_key =
+        prependPrefix(numberToIndexKey(block.number), Prefix::ID_TO_LOOKUP_KEY);
+    auto block_lookup_key = numberAndHashToLookupKey(block.number, block.hash);
+    return map.put(num_to_idx_key, block_lookup_key);
+  }
+
   outcome::result<common::Buffer> getWithPrefix(
       const storage::BufferStorage &map,
       prefix::Prefix prefix,
@@ -75,6 +85,16 @@ namespace kagome::blockchain {
            | (uint64_t(key[2]) << 8u) | uint64_t(key[3]);
   }
 
+  outcome::result<common::Hash256> lookupKeyToHash(
+      const common::Buffer &key) {
+    if (key.size() != 4 + Hash256::size()) {
+      return outcome::failure(KeyValueRepositoryError::INVALID_KEY);
+    }
+    Hash256 hash;
+    std::copy(key.begin() + 4, key.end(), hash.begin());
+    return hash;
+  }
+
   common::Buffer prependPrefix(const common::Buffer &key,
                                prefix::Prefix key_column) {
     return common::Buffer{}
@@ -9,6 +9,7 @@
 #include "common/buffer.hpp"
 #include "primitives/block_header.hpp"
 #include "primitives/block_id.hpp"
+#include "primitives/common.hpp"
 #include "storage/buffer_map_types.hpp"
 
 /**
@@ -68,6 +69,17 @@ namespace kagome::blockchain {
                                       common::Hash256 block_hash,
                                       const common::Buffer &value);
 
+  /**
+   * Make the number index point to \param block, so that its number is
+   * resolved to it. Blocks are indexed by number when they are put, so this
+   * is needed to keep the canonical chain in the index when the blocks of
+   * the chain are finalized
+   * @param map to put the entry to
+   * @return storage error if any
+   */
+  outcome::result<void> putNumberToIndexKey(storage::BufferStorage &map,
+                                            const primitives::BlockInfo &block);
+
   /**
    * Get an entry from the database
    * @param map to get the entry from
@@ -102,6 +114,11 @@ namespace kagome::blockchain {
   outcome::result<primitives::BlockNumber> lookupKeyToNumber(
       const common::Buffer &key);
 
+  /**
+   * Convert long lookup key to a block hash
+   */
+  outcome::result<common::Hash256> lookupKeyToHash(const common::Buffer &key);
+
   /**
    * For a persistant map based storage checks
    * whether result should be considered as `NOT FOUND` error
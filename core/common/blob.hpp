@@ -206,10 +206,7 @@ namespace kagome::common {
             size_t size,
             typename = std::enable_if_t<Stream::is_encoder_stream>>
   Stream &operator<<(Stream &s, const Blob<size> &blob) {
-    for (auto &&it = blob.begin(), end = blob.end(); it != end; ++it) {
-      s << *it;
-    }
-    return s;
+    return s << static_cast<const std::array<byte_t, size> &>(blob);
   }
 
   /**
@@ -224,10 +221,7 @@ namespace kagome::common {
             size_t size,
             typename = std::enable_if_t<Stream::is_decoder_stream>>
   Stream &operator>>(Stream &s, Blob<size> &blob) {
-    for (auto &&it = blob.begin(), end = blob.end(); it != end; ++it) {
-      s >> *it;
-    }
-    return s;
+    return s >> static_cast<std::array<byte_t, size> &>(blob);
   }
 
   template <size_t N>
@@ -272,10 +272,7 @@ namespace kagome::common {
   template <class Stream,
             typename = std::enable_if_t<Stream::is_decoder_stream>>
   Stream &operator>>(Stream &s, Buffer &buffer) {
-    std::vector<uint8_t> data;
-    s >> data;
-    buffer.put(data);
-    return s;
+    return s >> buffer.asVector();
   }
 
   std::ostream &operator<<(std::ostream &os, const Buffer &buffer);
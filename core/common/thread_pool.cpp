@@ -0,0 +1,153 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/thread_pool.hpp"
+
+#include <algorithm>
+
+#include <boost/assert.hpp>
+
+namespace {
+  constexpr const char *kQueueTimeHistogramName =
+      "kagome_thread_pool_queue_time_seconds";
+  constexpr const char *kServiceTimeHistogramName =
+      "kagome_thread_pool_service_time_seconds";
+  constexpr const char *kQueueSizeGaugeName = "kagome_thread_pool_queue_size";
+  constexpr const char *kBusyThreadsGaugeName =
+      "kagome_thread_pool_busy_threads";
+  constexpr const char *kThreadsGaugeName = "kagome_thread_pool_threads";
+  constexpr const char *kSchedulingDelayHistogramName =
+      "kagome_thread_pool_scheduling_delay_seconds";
+
+  const std::vector<double> kTimeBuckets{
+      0.0001, 0.0005, 0.001, 0.005, 0.01, 0.05, 0.1, 0.5, 1., 5.};
+
+  /**
+   * Families are shared by all of pools and have to be registered only once,
+   * metrics of the certain pool are distinguished by label
+   */
+  kagome::metrics::Registry &registry() {
+    static auto registry = [] {
+      auto registry = kagome::metrics::createRegistry();
+      registry->registerHistogramFamily(
+          kQueueTimeHistogramName,
+          "Time a task spent in the queue of the thread pool");
+      registry->registerHistogramFamily(
+          kServiceTimeHistogramName,
+          "Time a task spent in execution by the thread pool");
+      registry->registerGaugeFamily(
+          kQueueSizeGaugeName, "Amount of tasks waiting in the thread pool");
+      registry->registerGaugeFamily(
+          kBusyThreadsGaugeName,
+          "Amount of threads of the pool executing a task right now");
+      registry->registerGaugeFamily(kThreadsGaugeName,
+                                    "Amount of threads of the pool");
+      registry->registerHistogramFamily(
+          kSchedulingDelayHistogramName,
+          "Delay of running a handler of the io_context served by the pool "
+          "after it became ready");
+      return registry;
+    }();
+    return *registry;
+  }
+}  // namespace
+
+namespace kagome::common {
+
+  ThreadPool::ThreadPool(std::string name, size_t thread_number)
+      : ThreadPool(std::move(name),
+                   thread_number,
+                   std::make_shared<boost::asio::io_context>()) {}
+
+  ThreadPool::ThreadPool(std::string name,
+                         size_t thread_number,
+                         std::shared_ptr<boost::asio::io_context> io_context)
+      : name_{std::move(name)},
+        thread_number_{std::max<size_t>(thread_number, 1)},
+        io_context_{std::move(io_context)},
+        queued_{std::make_shared<std::atomic_size_t>(0)},
+        logger_{log::createLogger("ThreadPool", "threads")} {
+    BOOST_ASSERT(io_context_ != nullptr);
+    const std::map<std::string, std::string> labels{{"pool", name_}};
+    auto &metrics_registry = registry();
+    queue_time_ = metrics_registry.registerHistogramMetric(
+        kQueueTimeHistogramName, kTimeBuckets, labels);
+    service_time_ = metrics_registry.registerHistogramMetric(
+        kServiceTimeHistogramName, kTimeBuckets, labels);
+    queue_size_ =
+        metrics_registry.registerGaugeMetric(kQueueSizeGaugeName, labels);
+    busy_threads_ =
+        metrics_registry.registerGaugeMetric(kBusyThreadsGaugeName, labels);
+    metrics_registry.registerGaugeMetric(kThreadsGaugeName, labels)
+        ->set(thread_number_);
+    scheduling_delay_ = metrics_registry.registerHistogramMetric(
+        kSchedulingDelayHistogramName, kTimeBuckets, labels);
+  }
+
+  ThreadPool::~ThreadPool() {
+    stop();
+  }
+
+  void ThreadPool::start() {
+    if (not threads_.empty()) {
+      return;
+    }
+    io_context_->restart();
+    work_guard_ = std::make_unique<decltype(work_guard_)::element_type>(
+        io_context_->get_executor());
+    probe_timer_ = std::make_shared<boost::asio::steady_timer>(*io_context_);
+    scheduleProbe(probe_timer_, scheduling_delay_);
+    threads_.reserve(thread_number_);
+    for (size_t i = 0; i < thread_number_; ++i) {
+      threads_.emplace_back([io_context = io_context_] { io_context->run(); });
+    }
+    SL_DEBUG(logger_,
+             "Thread pool '{}' started with {} threads",
+             name_,
+             thread_number_);
+  }
+
+  void ThreadPool::stop() {
+    if (threads_.empty()) {
+      return;
+    }
+    work_guard_.reset();
+    io_context_->stop();
+    for (auto &thread : threads_) {
+      if (thread.joinable()) {
+        if (thread.get_id() == std::this_thread::get_id()) {
+          thread.detach();
+        } else {
+          thread.join();
+        }
+      }
+    }
+    threads_.clear();
+    // the pending wait is aborted and its handler finds the timer expired
+    probe_timer_.reset();
+    SL_DEBUG(logger_, "Thread pool '{}' stopped", name_);
+  }
+
+  void ThreadPool::scheduleProbe(
+      std::weak_ptr<boost::asio::steady_timer> timer,
+      metrics::Histogram *scheduling_delay) {
+    auto probe = timer.lock();
+    if (not probe) {
+      return;
+    }
+    probe->expires_after(kProbeInterval);
+    probe->async_wait([timer = std::move(timer), scheduling_delay](
+                          const boost::system::error_code &ec) mutable {
+      auto probe = timer.lock();
+      if (ec or not probe) {
+        return;
+      }
+      scheduling_delay->observe(
+          metrics::toSeconds(Clock::now() - probe->expiry()));
+      scheduleProbe(std::move(timer), scheduling_delay);
+    });
+  }
+
+}  // namespace kagome::common
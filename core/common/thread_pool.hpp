@@ -0,0 +1,160 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_COMMON_THREAD_POOL_HPP
+#define KAGOME_CORE_COMMON_THREAD_POOL_HPP
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include "log/logger.hpp"
+#include "metrics/metrics.hpp"
+#include "metrics/timing.hpp"
+
+namespace kagome::common {
+
+  /**
+   * @brief Fixed-size pool of worker threads serving an io_context.
+   * Every posted task is accounted: time spent in the queue, time spent in
+   * execution, amount of queued tasks and amount of busy threads are exported
+   * as metrics labeled by the name of the pool. Additionally, while the pool
+   * is running, a periodic probe measures how late the handlers of the
+   * io_context are run, that covers work which is not posted through the
+   * pool, like network handlers
+   */
+  class ThreadPool final {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @param name of the pool, used for thread naming and as metrics label
+     * @param thread_number amount of worker threads, at least one
+     */
+    ThreadPool(std::string name, size_t thread_number);
+
+    /**
+     * @param name of the pool, used for thread naming and as metrics label
+     * @param thread_number amount of worker threads, at least one
+     * @param io_context to be served by the pool instead of own one
+     */
+    ThreadPool(std::string name,
+               size_t thread_number,
+               std::shared_ptr<boost::asio::io_context> io_context);
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool(ThreadPool &&) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+    ThreadPool &operator=(ThreadPool &&) = delete;
+
+    ~ThreadPool();
+
+    /**
+     * @brief spawns worker threads; does nothing if already started
+     */
+    void start();
+
+    /**
+     * @brief stops io_context and joins worker threads; tasks which have not
+     * been started yet are dropped
+     */
+    void stop();
+
+    /**
+     * @brief enqueues task to be executed by one of worker threads
+     */
+    template <typename Task>
+    void post(Task &&task) {
+      queued_->fetch_add(1);
+      queue_size_->inc();
+      // pool itself is not captured: the last owner of the pool might be
+      // released by the task, so only objects outliving the pool are used
+      boost::asio::post(*io_context_,
+                        [queued = queued_,
+                         queue_time = queue_time_,
+                         service_time = service_time_,
+                         queue_size = queue_size_,
+                         busy_threads = busy_threads_,
+                         enqueued = Clock::now(),
+                         task = std::forward<Task>(task)]() mutable {
+                          queued->fetch_sub(1);
+                          queue_size->dec();
+                          busy_threads->inc();
+                          auto started = Clock::now();
+                          queue_time->observe(
+                              metrics::toSeconds(started - enqueued));
+                          task();
+                          service_time->observe(
+                              metrics::toSeconds(Clock::now() - started));
+                          busy_threads->dec();
+                        });
+    }
+
+    /**
+     * @return amount of tasks posted but not started yet
+     */
+    size_t queueSize() const {
+      return queued_->load();
+    }
+
+    size_t threadNumber() const {
+      return thread_number_;
+    }
+
+    const std::string &name() const {
+      return name_;
+    }
+
+    /**
+     * @return io_context served by the pool; it can be used for creating
+     * strands over the pool
+     */
+    const std::shared_ptr<boost::asio::io_context> &io_context() const {
+      return io_context_;
+    }
+
+    /// Interval between measurements of scheduling delay of the io_context
+    static constexpr std::chrono::milliseconds kProbeInterval{500};
+
+   private:
+    /**
+     * Arms the probe timer. The handler keeps only a weak pointer to the
+     * timer, which is owned by the pool, so a pending wait does not prolong
+     * the life of the timer
+     */
+    static void scheduleProbe(std::weak_ptr<boost::asio::steady_timer> timer,
+                              metrics::Histogram *scheduling_delay);
+
+    const std::string name_;
+    const size_t thread_number_;
+    std::shared_ptr<boost::asio::io_context> io_context_;
+    std::unique_ptr<
+        boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>
+        work_guard_;
+    std::vector<std::thread> threads_;
+    std::shared_ptr<std::atomic_size_t> queued_;
+    std::shared_ptr<boost::asio::steady_timer> probe_timer_;
+
+    // metrics are owned by the registry which outlives all of pools
+    metrics::Histogram *queue_time_;
+    metrics::Histogram *service_time_;
+    metrics::Gauge *queue_size_;
+    metrics::Gauge *busy_threads_;
+    metrics::Histogram *scheduling_delay_;
+
+    log::Logger logger_;
+  };
+
+}  // namespace kagome::common
+
+#endif  // KAGOME_CORE_COMMON_THREAD_POOL_HPP
@@ -5,6 +5,8 @@
 
 #include "consensus/authority/impl/authority_manager_impl.hpp"
 
+#include <algorithm>
+
 #include "application/app_state_manager.hpp"
 #include "blockchain/block_tree.hpp"
 #include "common/visitor.hpp"
@@ -12,10 +14,52 @@
 #include "consensus/authority/authority_update_observer_error.hpp"
 #include "consensus/authority/impl/schedule_node.hpp"
 #include "scale/scale.hpp"
+#include "storage/database_error.hpp"
 #include "storage/predefined_keys.hpp"
 
 namespace kagome::authority {
 
+  namespace {
+    common::Buffer nodeKey(const primitives::BlockHash &hash) {
+      return common::Buffer(AuthorityManagerImpl::SCHEDULER_NODE_PREFIX)
+          .put(hash);
+    }
+
+    /**
+     * Stored nodes of a block: the first node of the block, the nodes made
+     * under it by the following digests of the same block, and the blocks of
+     * the descendants of the last of them
+     */
+    struct NodeRecord {
+      std::vector<std::shared_ptr<ScheduleNode>> nodes;
+      std::vector<primitives::BlockHash> descendants;
+    };
+
+    template <class Stream,
+              typename = std::enable_if_t<Stream::is_encoder_stream>>
+    Stream &operator<<(Stream &s, const NodeRecord &r) {
+      s << scale::CompactInteger(r.nodes.size());
+      for (const auto &node : r.nodes) {
+        encodeState(s, *node);
+      }
+      return s << r.descendants;
+    }
+
+    template <class Stream,
+              typename = std::enable_if_t<Stream::is_decoder_stream>>
+    Stream &operator>>(Stream &s, NodeRecord &r) {
+      scale::CompactInteger size;
+      s >> size;
+      r.nodes.clear();
+      for (auto n = size.convert_to<size_t>(); n != 0; --n) {
+        auto node = std::make_shared<ScheduleNode>();
+        decodeState(s, *node);
+        r.nodes.emplace_back(std::move(node));
+      }
+      return s >> r.descendants;
+    }
+  }  // namespace
+
   AuthorityManagerImpl::AuthorityManagerImpl(
       std::shared_ptr<application::AppStateManager> app_state_manager,
       std::shared_ptr<blockchain::BlockTree> block_tree,
@@ -48,7 +92,27 @@ namespace kagome::authority {
 
     root_ = std::move(root);
 
-    return true;
+    if (root_->descendants.empty()) {
+      return loadNodes();
+    }
+
+    // The tree used to be stored as a whole, it is moved to the records
+    std::vector<std::shared_ptr<ScheduleNode>> nodes{root_};
+    while (not nodes.empty()) {
+      auto node = std::move(nodes.back());
+      nodes.pop_back();
+      indexNode(node);
+      for (auto &descendant : node->descendants) {
+        descendant->parent = node;
+        nodes.emplace_back(descendant);
+      }
+    }
+    for (auto &[hash, node] : nodes_by_hash_) {
+      if (not saveNode(node.lock()).has_value()) {
+        return false;
+      }
+    }
+    return saveRoot().has_value();
   }
 
   bool AuthorityManagerImpl::start() {
@@ -56,14 +120,100 @@ namespace kagome::authority {
   }
 
   void AuthorityManagerImpl::stop() {
-    if (!root_) return;
-    std::ignore = save();
+    // Each change is saved as soon as it is applied
   }
 
-  outcome::result<void> AuthorityManagerImpl::save() {
+  bool AuthorityManagerImpl::loadNodes() {
     BOOST_ASSERT(root_ != nullptr);
 
-    auto data_res = scale::encode(root_);
+    // Blocks of the nodes to read the records of, with the nodes to put them
+    // under
+    std::vector<
+        std::pair<std::shared_ptr<ScheduleNode>, primitives::BlockHash>>
+        pending{{nullptr, root_->block.hash}};
+    while (not pending.empty()) {
+      auto [parent, hash] = std::move(pending.back());
+      pending.pop_back();
+
+      auto data_res = storage_->get(nodeKey(hash));
+      if (not data_res.has_value()) {
+        // The root has no record until anything is scheduled
+        if (parent == nullptr
+            and data_res
+                    == outcome::failure(storage::DatabaseError::NOT_FOUND)) {
+          indexNode(root_);
+          continue;
+        }
+        log_->critical("Can't read stored schedule node of block {}",
+                       hash.toHex());
+        return false;
+      }
+
+      auto record_res = scale::decode<NodeRecord>(data_res.value());
+      if (not record_res.has_value() or record_res.value().nodes.empty()) {
+        log_->critical("Can't decode stored schedule node of block {}",
+                       hash.toHex());
+        return false;
+      }
+      auto &record = record_res.value();
+
+      auto &nodes = record.nodes;
+      for (size_t i = 1; i < nodes.size(); ++i) {
+        nodes[i]->parent = nodes[i - 1];
+        nodes[i - 1]->descendants.emplace_back(nodes[i]);
+      }
+      if (parent == nullptr) {
+        root_ = nodes.front();
+      } else {
+        nodes.front()->parent = parent;
+        parent->descendants.emplace_back(nodes.front());
+      }
+      indexNode(nodes.front());
+
+      for (auto &descendant : record.descendants) {
+        pending.emplace_back(nodes.back(), descendant);
+      }
+    }
+
+    return true;
+  }
+
+  void AuthorityManagerImpl::indexNode(
+      const std::shared_ptr<ScheduleNode> &node) {
+    if (auto parent = node->parent.lock();
+        parent != nullptr and parent->block == node->block) {
+      return;
+    }
+    nodes_by_hash_[node->block.hash] = node;
+    nodes_by_number_.emplace(node->block.number, node);
+  }
+
+  outcome::result<void> AuthorityManagerImpl::attachNode(
+      const std::shared_ptr<ScheduleNode> &node,
+      const std::shared_ptr<ScheduleNode> &new_node,
+      const std::vector<std::shared_ptr<ScheduleNode>> &changed_descendants) {
+    node->descendants.emplace_back(new_node);
+    indexNode(new_node);
+
+    // The record of a block keeps all its nodes
+    OUTCOME_TRY(saveNode(node));
+    if (new_node->block != node->block) {
+      OUTCOME_TRY(saveNode(new_node));
+    }
+    for (const auto &descendant : changed_descendants) {
+      OUTCOME_TRY(saveNode(descendant));
+    }
+    return outcome::success();
+  }
+
+  outcome::result<void> AuthorityManagerImpl::saveRoot() {
+    BOOST_ASSERT(root_ != nullptr);
+
+    // The same encoding as of the whole tree, but with no descendants
+    auto root = std::make_shared<ScheduleNode>(*root_);
+    root->descendants.clear();
+
+    auto data_res = scale::encode(root);
     if (!data_res.has_value()) {
       log_->critical("Can't encode state to store");
       return AuthorityManagerError::CAN_NOT_SAVE_STATE;
@@ -79,6 +229,68 @@ namespace kagome::authority {
     return outcome::success();
   }
 
+  outcome::result<void> AuthorityManagerImpl::saveNode(
+      std::shared_ptr<ScheduleNode> node) {
+    for (auto parent = node->parent.lock();
+         parent != nullptr and parent->block == node->block;
+         parent = node->parent.lock()) {
+      node = std::move(parent);
+    }
+
+    NodeRecord record;
+    record.nodes.emplace_back(node);
+    while (true) {
+      const auto &descendants = record.nodes.back()->descendants;
+      auto it = std::find_if(
+          descendants.begin(), descendants.end(), [&](const auto &descendant) {
+            return descendant->block == node->block;
+          });
+      if (it == descendants.end()) {
+        break;
+      }
+      record.nodes.emplace_back(*it);
+    }
+    for (const auto &descendant : record.nodes.back()->descendants) {
+      if (descendant->block != node->block) {
+        record.descendants.emplace_back(descendant->block.hash);
+      }
+    }
+
+    auto data_res = scale::encode(record);
+    if (!data_res.has_value()) {
+      log_->critical("Can't encode schedule node to store");
+      return AuthorityManagerError::CAN_NOT_SAVE_STATE;
+    }
+
+    auto save_res = storage_->put(nodeKey(node->block.hash),
+                                  common::Buffer(data_res.value()));
+    if (!save_res.has_value()) {
+      log_->critical("Can't store schedule node");
+      return AuthorityManagerError::CAN_NOT_SAVE_STATE;
+    }
+
+    return outcome::success();
+  }
+
+  outcome::result<void> AuthorityManagerImpl::removePrunedNodes() {
+    for (auto it = nodes_by_hash_.begin(); it != nodes_by_hash_.end();) {
+      if (not it->second.expired()) {
+        ++it;
+        continue;
+      }
+      auto remove_res = storage_->remove(nodeKey(it->first));
+      if (!remove_res.has_value()) {
+        log_->critical("Can't remove pruned schedule node");
+        return AuthorityManagerError::CAN_NOT_SAVE_STATE;
+      }
+      it = nodes_by_hash_.erase(it);
+    }
+    for (auto it = nodes_by_number_.begin(); it != nodes_by_number_.end();) {
+      it = it->second.expired() ? nodes_by_number_.erase(it) : std::next(it);
+    }
+    return outcome::success();
+  }
+
   outcome::result<std::shared_ptr<const primitives::AuthorityList>>
   AuthorityManagerImpl::authorities(const primitives::BlockInfo &block,
                                     bool finalized) {
@@ -133,7 +345,8 @@ namespace kagome::authority {
                  authority.weight);
     }
 
-    // Reorganize ancestry
+    // Reorganize ancestry, the changed nodes are saved once it is done
+    std::vector<std::shared_ptr<ScheduleNode>> changed_descendants;
     for (auto &descendant : std::move(node->descendants)) {
       auto &ancestor =
           directChainExists(block, descendant->block) ? new_node : node;
@@ -142,15 +355,13 @@ namespace kagome::authority {
         descendant->actual_authorities = ancestor->forced_authorities;
         descendant->forced_authorities.reset();
         descendant->forced_for = ScheduleNode::INACTIVE;
+        changed_descendants.emplace_back(descendant);
       }
 
+      descendant->parent = ancestor;
       ancestor->descendants.emplace_back(std::move(descendant));
     }
-    node->descendants.emplace_back(std::move(new_node));
-
-    std::ignore = save();
-
-    return outcome::success();
+    return attachNode(node, new_node, changed_descendants);
   }
 
   outcome::result<void> AuthorityManagerImpl::applyForcedChange(
@@ -185,29 +396,33 @@ namespace kagome::authority {
                  authority.weight);
     }
 
-    // Reorganize ancestry
+    // Reorganize ancestry, the changed nodes are saved once it is done
+    std::vector<std::shared_ptr<ScheduleNode>> changed_descendants;
     for (auto &descendant : std::move(node->descendants)) {
       auto &ancestor =
           directChainExists(block, descendant->block) ? new_node : node;
 
       // Apply forced changes if dalay will be passed for descendant
+      bool changed = false;
       if (descendant->block.number >= ancestor->forced_for) {
         descendant->actual_authorities = ancestor->forced_authorities;
         descendant->forced_authorities.reset();
         descendant->forced_for = ScheduleNode::INACTIVE;
+        changed = true;
       }
       if (descendant->block.number >= ancestor->resume_for) {
         descendant->enabled = true;
         descendant->resume_for = ScheduleNode::INACTIVE;
+        changed = true;
+      }
+      if (changed) {
+        changed_descendants.emplace_back(descendant);
       }
 
+      descendant->parent = ancestor;
       ancestor->descendants.emplace_back(std::move(descendant));
     }
-    node->descendants.emplace_back(std::move(new_node));
-
-    std::ignore = save();
-
-    return outcome::success();
+    return attachNode(node, new_node, changed_descendants);
   }
 
   outcome::result<void> AuthorityManagerImpl::applyOnDisabled(
@@ -232,23 +447,22 @@ namespace kagome::authority {
                (*authorities)[authority_index].id.id,
                new_node->block.number);
 
-    // Reorganize ancestry
+    // Reorganize ancestry, the changed nodes are saved once it is done
+    std::vector<std::shared_ptr<ScheduleNode>> changed_descendants;
     for (auto &descendant : std::move(node->descendants)) {
       if (directChainExists(block, descendant->block)) {
         // Propogate change to descendants
         if (descendant->actual_authorities == node->actual_authorities) {
           descendant->actual_authorities = new_node->actual_authorities;
+          changed_descendants.emplace_back(descendant);
         }
+        descendant->parent = new_node;
         new_node->descendants.emplace_back(std::move(descendant));
       } else {
         node->descendants.emplace_back(std::move(descendant));
       }
     }
-    node->descendants.emplace_back(std::move(new_node));
-
-    std::ignore = save();
-
-    return outcome::success();
+    return attachNode(node, new_node, changed_descendants);
   }
 
   outcome::result<void> AuthorityManagerImpl::applyPause(
@@ -267,13 +481,10 @@ namespace kagome::authority {
     for (auto &descendant : std::move(node->descendants)) {
       auto &ancestor =
           directChainExists(block, descendant->block) ? new_node : node;
+      descendant->parent = ancestor;
       ancestor->descendants.emplace_back(std::move(descendant));
     }
-    node->descendants.emplace_back(std::move(new_node));
-
-    std::ignore = save();
-
-    return outcome::success();
+    return attachNode(node, new_node);
   }
 
   outcome::result<void> AuthorityManagerImpl::applyResume(
@@ -288,29 +499,33 @@ namespace kagome::authority {
 
     SL_VERBOSE(log_, "Scheduled resume on block #{}", new_node->block.number);
 
-    // Reorganize ancestry
+    // Reorganize ancestry, the changed nodes are saved once it is done
+    std::vector<std::shared_ptr<ScheduleNode>> changed_descendants;
     for (auto &descendant : std::move(node->descendants)) {
       auto &ancestor =
           directChainExists(block, descendant->block) ? new_node : node;
 
       // Apply resume if delay will be passed for descendant
+      bool changed = false;
       if (descendant->block.number >= ancestor->forced_for) {
         descendant->actual_authorities = ancestor->forced_authorities;
         descendant->forced_authorities.reset();
         descendant->forced_for = ScheduleNode::INACTIVE;
+        changed = true;
       }
       if (descendant->block.number >= ancestor->resume_for) {
         descendant->enabled = true;
         descendant->resume_for = ScheduleNode::INACTIVE;
+        changed = true;
+      }
+      if (changed) {
+        changed_descendants.emplace_back(descendant);
       }
 
+      descendant->parent = ancestor;
       ancestor->descendants.emplace_back(std::move(descendant));
     }
-    node->descendants.emplace_back(std::move(new_node));
-
-    std::ignore = save();
-
-    return outcome::success();
+    return attachNode(node, new_node, changed_descendants);
   }
 
   outcome::result<void> AuthorityManagerImpl::onConsensus(
@@ -377,27 +592,35 @@ namespace kagome::authority {
       return outcome::success();
     }
 
-    auto node = getAppropriateAncestor(block);
+    {
+      auto node = getAppropriateAncestor(block);
 
-    if (node->block == block) {
-      // Rebase
-      root_ = std::move(node);
+      if (node->block == block) {
+        // Rebase
+        root_ = std::move(node);
 
-    } else {
-      // Reorganize ancestry
-      auto new_node = node->makeDescendant(block, true);
-      for (auto &descendant : std::move(node->descendants)) {
-        if (directChainExists(block, descendant->block)) {
-          new_node->descendants.emplace_back(std::move(descendant));
+      } else {
+        // Reorganize ancestry
+        auto new_node = node->makeDescendant(block, true);
+        for (auto &descendant : std::move(node->descendants)) {
+          if (directChainExists(block, descendant->block)) {
+            descendant->parent = new_node;
+            new_node->descendants.emplace_back(std::move(descendant));
+          }
         }
-      }
+        indexNode(new_node);
+        OUTCOME_TRY(saveNode(new_node));
 
-      root_ = std::move(new_node);
+        root_ = std::move(new_node);
+      }
     }
 
     SL_VERBOSE(log_, "Prune authority manager upto block #{}", block.number);
 
-    OUTCOME_TRY(save());
+    OUTCOME_TRY(saveRoot());
+
+    // Nodes out of the new root are released with the old one
+    OUTCOME_TRY(removePrunedNodes());
 
     return outcome::success();
   }
@@ -405,6 +628,16 @@ namespace kagome::authority {
   std::shared_ptr<ScheduleNode> AuthorityManagerImpl::getAppropriateAncestor(
       const primitives::BlockInfo &block) {
     BOOST_ASSERT(root_ != nullptr);
+
+    // The block has got its own node
+    if (auto it = nodes_by_hash_.find(block.hash);
+        it != nodes_by_hash_.end()) {
+      if (auto node = it->second.lock();
+          node != nullptr and node->block == block) {
+        return node;
+      }
+    }
+
     std::shared_ptr<ScheduleNode> ancestor;
     // Target block is not descendant of the current root
     if (root_->block.number > block.number
@@ -412,19 +645,30 @@ namespace kagome::authority {
             && not directChainExists(root_->block, block))) {
       return ancestor;
     }
+
+    // The highest block having a node on the chain of the target block
     ancestor = root_;
-    while (ancestor->block != block) {
-      bool goto_next_generation = false;
-      for (const auto &node : ancestor->descendants) {
-        if (node->block == block || directChainExists(node->block, block)) {
-          ancestor = node;
-          goto_next_generation = true;
-          break;
-        }
+    for (auto it = nodes_by_number_.upper_bound(block.number);
+         it != nodes_by_number_.begin();) {
+      --it;
+      auto node = it->second.lock();
+      if (node != nullptr and directChainExists(node->block, block)) {
+        ancestor = std::move(node);
+        break;
       }
-      if (not goto_next_generation) {
+    }
+
+    // Descendants go under the last node of the block
+    while (true) {
+      const auto &descendants = ancestor->descendants;
+      auto it = std::find_if(
+          descendants.begin(), descendants.end(), [&](const auto &node) {
+            return node->block == ancestor->block;
+          });
+      if (it == descendants.end()) {
         break;
       }
+      ancestor = *it;
     }
     return ancestor;
   }
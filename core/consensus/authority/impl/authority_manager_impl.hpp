@@ -6,6 +6,9 @@
 #ifndef KAGOME_CONSENSUS_AUTHORITIES_MANAGER_IMPL
 #define KAGOME_CONSENSUS_AUTHORITIES_MANAGER_IMPL
 
+#include <map>
+#include <unordered_map>
+
 #include "consensus/authority/authority_manager.hpp"
 #include "consensus/authority/authority_update_observer.hpp"
 
@@ -34,6 +37,9 @@ namespace kagome::authority {
         known_engines{primitives::kBabeEngineId, primitives::kGrandpaEngineId};
     inline static const common::Buffer SCHEDULER_TREE =
         common::Buffer{}.put(":kagome:authorities:scheduler_tree");
+    /// Prefix of the keys of the schedule nodes, followed by block hash
+    inline static const common::Buffer SCHEDULER_NODE_PREFIX =
+        common::Buffer{}.put(":kagome:authorities:scheduler_node:");
 
     AuthorityManagerImpl(
         std::shared_ptr<application::AppStateManager> app_state_manager,
@@ -100,13 +106,52 @@ namespace kagome::authority {
     bool directChainExists(const primitives::BlockInfo &ancestor,
                            const primitives::BlockInfo &descendant);
 
-    outcome::result<void> save();
+    /**
+     * Restores the subtree of the root from the records of the nodes
+     * @return false if the records can't be read
+     */
+    bool loadNodes();
+
+    /// Adds \arg node to the indices if it is the first node of its block
+    void indexNode(const std::shared_ptr<ScheduleNode> &node);
+
+    /**
+     * Puts \arg new_node under \arg node when the descendants of the last
+     * are reorganized, indexes it and saves the changed records, including
+     * the ones of \arg changed_descendants
+     */
+    outcome::result<void> attachNode(
+        const std::shared_ptr<ScheduleNode> &node,
+        const std::shared_ptr<ScheduleNode> &new_node,
+        const std::vector<std::shared_ptr<ScheduleNode>> &changed_descendants =
+            {});
+
+    /// Saves the root without descendants, which are stored in records
+    outcome::result<void> saveRoot();
+
+    /**
+     * Saves the record of the block of \arg node: the nodes of the block and
+     * the blocks of their descendants
+     */
+    outcome::result<void> saveNode(std::shared_ptr<ScheduleNode> node);
+
+    /// Drops the indices and the records of the nodes pruned from the tree
+    outcome::result<void> removePrunedNodes();
 
     log::Logger log_;
     std::shared_ptr<application::AppStateManager> app_state_manager_;
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<storage::BufferStorage> storage_;
     std::shared_ptr<ScheduleNode> root_;
+
+    /**
+     * The first nodes of the blocks having any. The nodes are owned by the
+     * tree, so the pruned ones expire
+     */
+    std::unordered_map<primitives::BlockHash, std::weak_ptr<ScheduleNode>>
+        nodes_by_hash_;
+    std::multimap<primitives::BlockNumber, std::weak_ptr<ScheduleNode>>
+        nodes_by_number_;
   };
 }  // namespace kagome::authority
 
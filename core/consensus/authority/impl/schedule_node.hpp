@@ -55,9 +55,13 @@ namespace kagome::authority {
     primitives::BlockNumber resume_for = INACTIVE;
   };
 
+  /**
+   * Scale-encodes the node without its descendants, so that the node may be
+   * stored apart from them
+   */
   template <class Stream,
             typename = std::enable_if_t<Stream::is_encoder_stream>>
-  Stream &operator<<(Stream &s, const ScheduleNode &b) {
+  void encodeState(Stream &s, const ScheduleNode &b) {
     s << b.block << b.actual_authorities << b.actual_authorities->id
       << b.enabled;
     if (b.scheduled_after != ScheduleNode::INACTIVE) {
@@ -81,13 +85,12 @@ namespace kagome::authority {
     } else {
       s << static_cast<primitives::BlockNumber>(0);
     }
-    s << b.descendants;
-    return s;
   }
 
+  /// Decodes the node encoded by encodeState, descendants are left as is
   template <class Stream,
             typename = std::enable_if_t<Stream::is_decoder_stream>>
-  Stream &operator>>(Stream &s, ScheduleNode &b) {
+  void decodeState(Stream &s, ScheduleNode &b) {
     s >> const_cast<primitives::BlockInfo &>(b.block);  // NOLINT
     s >> b.actual_authorities;
     s >> const_cast<uint64_t &>(b.actual_authorities->id);  // NOLINT
@@ -117,6 +120,20 @@ namespace kagome::authority {
     } else {
       b.resume_for = ScheduleNode::INACTIVE;
     }
+  }
+
+  template <class Stream,
+            typename = std::enable_if_t<Stream::is_encoder_stream>>
+  Stream &operator<<(Stream &s, const ScheduleNode &b) {
+    encodeState(s, b);
+    s << b.descendants;
+    return s;
+  }
+
+  template <class Stream,
+            typename = std::enable_if_t<Stream::is_decoder_stream>>
+  Stream &operator>>(Stream &s, ScheduleNode &b) {
+    decodeState(s, b);
     s >> b.descendants;
     return s;
   }
@@ -14,10 +14,27 @@
 #include "consensus/babe/impl/threshold_util.hpp"
 #include "consensus/babe/types/babe_block_header.hpp"
 #include "consensus/babe/types/seal.hpp"
+#include "metrics/timing.hpp"
 #include "network/types/block_announce.hpp"
 #include "primitives/inherent_data.hpp"
 #include "scale/scale.hpp"
 #include "storage/trie/serialization/ordered_trie_hash.hpp"
+#include "transaction_pool/transaction_pool_error.hpp"
+
+namespace {
+  /// Portion of the remaining slot time given to applying of extrinsics; the
+  /// rest is left for finalization, sealing and import of the block
+  constexpr auto kBlockProposalSlotPortion = 2. / 3;
+
+  /// Portion of a slot before an owned slot in which its block is built in
+  /// advance
+  constexpr auto kPrebuildSlotPortion = 1. / 3;
+
+  constexpr const char *kSlotShareHistogramName =
+      "kagome_babe_block_authoring_slot_share";
+  constexpr const char *kPrebuiltCounterName =
+      "kagome_babe_prebuilt_blocks_total";
+}  // namespace
 
 namespace kagome::consensus::babe {
   BabeImpl::BabeImpl(
@@ -27,6 +44,7 @@ namespace kagome::consensus::babe {
       std::shared_ptr<storage::trie::TrieStorage> trie_storage,
       std::shared_ptr<primitives::BabeConfiguration> configuration,
       std::shared_ptr<authorship::Proposer> proposer,
+      std::shared_ptr<transaction_pool::TransactionPool> tx_pool,
       std::shared_ptr<blockchain::BlockTree> block_tree,
       std::shared_ptr<BabeGossiper> gossiper,
       std::shared_ptr<crypto::Sr25519Provider> sr25519_provider,
@@ -34,15 +52,18 @@ namespace kagome::consensus::babe {
       std::shared_ptr<clock::SystemClock> clock,
       std::shared_ptr<crypto::Hasher> hasher,
       std::unique_ptr<clock::Ticker> ticker,
+      std::unique_ptr<clock::Timer> prebuild_timer,
       std::shared_ptr<authority::AuthorityUpdateObserver>
           authority_update_observer,
-      std::shared_ptr<BabeUtil> babe_util)
+      std::shared_ptr<BabeUtil> babe_util,
+      std::shared_ptr<PostStateCache> post_state_cache)
       : app_state_manager_(std::move(app_state_manager)),
         lottery_{std::move(lottery)},
         block_executor_{std::move(block_executor)},
         trie_storage_{std::move(trie_storage)},
         babe_configuration_{std::move(configuration)},
         proposer_{std::move(proposer)},
+        tx_pool_{std::move(tx_pool)},
         block_tree_{std::move(block_tree)},
         gossiper_{std::move(gossiper)},
         keypair_{keypair},
@@ -50,21 +71,44 @@ namespace kagome::consensus::babe {
         hasher_{std::move(hasher)},
         sr25519_provider_{std::move(sr25519_provider)},
         ticker_{std::move(ticker)},
+        prebuild_timer_{std::move(prebuild_timer)},
         authority_update_observer_(std::move(authority_update_observer)),
         babe_util_(std::move(babe_util)),
+        post_state_cache_(std::move(post_state_cache)),
         log_{log::createLogger("Babe", "babe")} {
     BOOST_ASSERT(app_state_manager_);
     BOOST_ASSERT(lottery_);
     BOOST_ASSERT(trie_storage_);
     BOOST_ASSERT(proposer_);
+    BOOST_ASSERT(tx_pool_);
     BOOST_ASSERT(block_tree_);
     BOOST_ASSERT(gossiper_);
     BOOST_ASSERT(sr25519_provider_);
     BOOST_ASSERT(clock_);
     BOOST_ASSERT(hasher_);
+    BOOST_ASSERT(prebuild_timer_);
     BOOST_ASSERT(log_);
     BOOST_ASSERT(authority_update_observer_);
     BOOST_ASSERT(babe_util_);
+    BOOST_ASSERT(post_state_cache_);
+
+    // initialize metrics
+    registry_->registerHistogramFamily(
+        kSlotShareHistogramName,
+        "Share of the slot passed by the moment an authored block is "
+        "announced");
+    slot_share_ = registry_->registerHistogramMetric(
+        kSlotShareHistogramName,
+        {0.05, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1});
+    registry_->registerCounterFamily(
+        kPrebuiltCounterName,
+        "Number of blocks built ahead of owned slots by their fate");
+    prebuilt_used_ = registry_->registerCounterMetric(kPrebuiltCounterName,
+                                                      {{"result", "used"}});
+    prebuilt_discarded_ = registry_->registerCounterMetric(
+        kPrebuiltCounterName, {{"result", "discarded"}});
+    prebuilt_failed_ = registry_->registerCounterMetric(
+        kPrebuiltCounterName, {{"result", "failed"}});
 
     app_state_manager_->atLaunch([this] { return start(); });
   }
@@ -240,14 +284,17 @@ namespace kagome::consensus::babe {
 
     if (current_epoch_.epoch_number != babe_util_->slotToEpoch(current_slot_)) {
       startNextEpoch();
+    } else {
+      schedulePrebuild();
     }
   }
 
   outcome::result<primitives::PreRuntime> BabeImpl::babePreDigest(
+      BabeSlotNumber slot,
       const crypto::VRFOutput &output,
       primitives::AuthorityIndex authority_index) const {
     BabeBlockHeader babe_header{
-        BabeBlockHeader::kVRFHeader, current_slot_, output, authority_index};
+        BabeBlockHeader::kVRFHeader, slot, output, authority_index};
     auto encoded_header_res = scale::encode(babe_header);
     if (!encoded_header_res) {
       log_->error("cannot encode BabeBlockHeader: {}",
@@ -289,68 +336,53 @@ namespace kagome::consensus::babe {
                current_slot_,
                current_epoch_.epoch_number);
 
-    primitives::InherentData inherent_data;
-    auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
-                   clock_->now().time_since_epoch())
-                   .count();
-    // identifiers are guaranteed to be correct, so use .value() directly
-    auto put_res = inherent_data.putData<uint64_t>(kTimestampId, now);
-    if (!put_res) {
-      return log_->error("cannot put an inherent data: {}",
-                         put_res.error().message());
-    }
-    put_res = inherent_data.putData(kBabeSlotId, current_slot_);
-    if (!put_res) {
-      return log_->error("cannot put an inherent data: {}",
-                         put_res.error().message());
-    }
+    // share of the slot budget consumed by authoring of the block
+    auto observe_slot_share = [this] {
+      const auto slot_remaining = babe_util_->slotStartsIn(current_slot_ + 1);
+      slot_share_->observe(
+          1.
+          - metrics::toSeconds(slot_remaining)
+                / metrics::toSeconds(babe_configuration_->slot_duration));
+    };
 
     auto best_block_info = block_tree_->deepestLeaf();
-    auto &[best_block_number, best_block_hash] = best_block_info;
-    log_->info("Babe builds block on top of block with number {} and hash {}",
-               best_block_number,
-               best_block_hash);
-
-    auto epoch = block_tree_->getEpochDescriptor(current_epoch_.epoch_number,
-                                                 best_block_hash);
-
-    auto authority_index_res =
-        getAuthorityIndex(epoch.value().authorities, keypair_->public_key);
-    BOOST_ASSERT_MSG(authority_index_res.has_value(), "Authority is not known");
-
-    // calculate babe_pre_digest
-    auto babe_pre_digest_res =
-        babePreDigest(output, authority_index_res.value());
-    if (not babe_pre_digest_res) {
-      return log_->error("cannot propose a block: {}",
-                         babe_pre_digest_res.error().message());
-    }
-    const auto &babe_pre_digest = babe_pre_digest_res.value();
+    auto prebuilt_block = std::move(prebuilt_block_);
+    prebuilt_block_.reset();
+
+    primitives::Block block;
+    if (prebuilt_block and prebuilt_block->slot == current_slot_
+        and prebuilt_block->parent == best_block_info) {
+      block = std::move(prebuilt_block->block);
+      prebuilt_used_->inc();
+    } else {
+      if (prebuilt_block) {
+        log_->info(
+            "Block built in advance for slot {} is discarded, best block "
+            "changed to #{} ({})",
+            prebuilt_block->slot,
+            best_block_info.number,
+            best_block_info.hash);
+        prebuilt_discarded_->inc();
+      }
 
-    // create new block
-    auto pre_seal_block_res =
-        proposer_->propose(best_block_number, inherent_data, {babe_pre_digest});
-    if (!pre_seal_block_res) {
-      return log_->error("Cannot propose a block: {}",
-                         pre_seal_block_res.error().message());
+      // extrinsics are applied until the deadline, so that the block is
+      // built, sealed and imported within the slot
+      const auto now = clock_->now();
+      const auto slot_remaining = babe_util_->slotStartsIn(current_slot_ + 1);
+      const auto deadline =
+          now
+          + std::chrono::duration_cast<BabeDuration>(
+              slot_remaining * kBlockProposalSlotPortion);
+
+      auto block_res =
+          proposeBlock(current_slot_, output, best_block_info, now, deadline);
+      if (not block_res) {
+        return log_->error("Cannot propose a block: {}",
+                           block_res.error().message());
+      }
+      block = std::move(block_res.value());
     }
 
-    auto block = pre_seal_block_res.value();
-
-    // Ensure block's extrinsics root matches extrinsics in block's body
-    BOOST_ASSERT_MSG(
-        [&block]() {
-          using boost::adaptors::transformed;
-          const auto &ext_root_res = storage::trie::calculateOrderedTrieHash(
-              block.body | transformed([](const auto &ext) {
-                return common::Buffer{scale::encode(ext).value()};
-              }));
-          return ext_root_res.has_value()
-                 and (ext_root_res.value()
-                      == common::Buffer(block.header.extrinsics_root));
-        }(),
-        "Extrinsics root does not match extrinsics in the block");
-
     // seal the block
     auto seal_res = sealBlock(block);
     if (!seal_res) {
@@ -366,6 +398,7 @@ namespace kagome::consensus::babe {
       log_->warn(
           "Block was not built in time. Slot has finished. If you are "
           "executing in debug mode, consider to rebuild in release");
+      observe_slot_share();
       return;
     }
 
@@ -382,12 +415,34 @@ namespace kagome::consensus::babe {
           [](const auto &) {});
     }
 
+    // the state of the block has been committed while building it, so the
+    // block needs no execution if it is imported later, e.g. when adding it
+    // below fails; the hash is computed once for the cache and the logs
+    const auto block_hash =
+        hasher_->blake2b_256(scale::encode(block.header).value());
+    post_state_cache_->put(block_hash, block.header.state_root);
+
     // add block to the block tree
     if (auto add_res = block_tree_->addBlock(block); not add_res) {
-      log_->error("Could not add block: {}", add_res.error().message());
+      log_->error("Could not add block {}: {}",
+                  block_hash.toHex(),
+                  add_res.error().message());
       return;
     }
 
+    // proposer leaves included extrinsics in the pool, so that the ones of a
+    // discarded block built in advance are not lost
+    for (const auto &extrinsic : block.body) {
+      auto res = tx_pool_->removeOne(hasher_->blake2b_256(extrinsic.data));
+      if (res.has_error()
+          && res
+                 != outcome::failure(
+                     transaction_pool::TransactionPoolError::TX_NOT_FOUND)) {
+        log_->warn("Can't remove extrinsic of the authored block: {}",
+                   res.error().message());
+      }
+    }
+
     if (auto next_epoch_digest_res = getNextEpochDigest(block.header);
         next_epoch_digest_res) {
       auto &next_epoch_digest = next_epoch_digest_res.value();
@@ -399,13 +454,134 @@ namespace kagome::consensus::babe {
 
     // finally, broadcast the sealed block
     gossiper_->blockAnnounce(network::BlockAnnounce{block.header});
-    SL_DEBUG(
-        log_,
-        "Announced block number {} in slot {} (epoch {}) with timestamp {}",
-        block.header.number,
-        current_slot_,
-        babe_util_->slotToEpoch(current_slot_),
-        now);
+    SL_DEBUG(log_,
+             "Announced block number {}, hash {} in slot {} (epoch {})",
+             block.header.number,
+             block_hash.toHex(),
+             current_slot_,
+             babe_util_->slotToEpoch(current_slot_));
+    observe_slot_share();
+  }
+
+  outcome::result<primitives::Block> BabeImpl::proposeBlock(
+      BabeSlotNumber slot,
+      const crypto::VRFOutput &output,
+      const primitives::BlockInfo &parent,
+      clock::SystemClock::TimePoint timestamp,
+      clock::SystemClock::TimePoint deadline) {
+    primitives::InherentData inherent_data;
+    auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                   timestamp.time_since_epoch())
+                   .count();
+    // identifiers are guaranteed to be correct, so use .value() directly
+    auto put_res = inherent_data.putData<uint64_t>(kTimestampId, now);
+    if (!put_res) {
+      log_->error("cannot put an inherent data: {}",
+                  put_res.error().message());
+      return put_res.as_failure();
+    }
+    put_res = inherent_data.putData(kBabeSlotId, slot);
+    if (!put_res) {
+      log_->error("cannot put an inherent data: {}",
+                  put_res.error().message());
+      return put_res.as_failure();
+    }
+
+    log_->info("Babe builds block on top of block with number {} and hash {}",
+               parent.number,
+               parent.hash);
+
+    auto epoch = block_tree_->getEpochDescriptor(current_epoch_.epoch_number,
+                                                 parent.hash);
+
+    auto authority_index_res =
+        getAuthorityIndex(epoch.value().authorities, keypair_->public_key);
+    BOOST_ASSERT_MSG(authority_index_res.has_value(), "Authority is not known");
+
+    // calculate babe_pre_digest
+    OUTCOME_TRY(babe_pre_digest,
+                babePreDigest(slot, output, authority_index_res.value()));
+
+    // create new block
+    OUTCOME_TRY(block,
+                proposer_->propose(
+                    parent.number, inherent_data, {babe_pre_digest}, deadline));
+
+    // Ensure block's extrinsics root matches extrinsics in block's body
+    BOOST_ASSERT_MSG(
+        [&block]() {
+          using boost::adaptors::transformed;
+          const auto &ext_root_res = storage::trie::calculateOrderedTrieHash(
+              block.body | transformed([](const auto &ext) {
+                return common::Buffer{scale::encode(ext).value()};
+              }));
+          return ext_root_res.has_value()
+                 and (ext_root_res.value()
+                      == common::Buffer(block.header.extrinsics_root));
+        }(),
+        "Extrinsics root does not match extrinsics in the block");
+
+    return block;
+  }
+
+  void BabeImpl::schedulePrebuild() {
+    if (not slots_leadership_.has_value()) {
+      return;
+    }
+    const auto slot_index = current_slot_ - current_epoch_.start_slot;
+    if (slot_index >= slots_leadership_->size()
+        or not slots_leadership_.value()[slot_index]) {
+      return;
+    }
+
+    const auto slot = current_slot_;
+    const auto lead = std::chrono::duration_cast<BabeDuration>(
+        babe_configuration_->slot_duration * kPrebuildSlotPortion);
+    prebuild_timer_->expiresAfter(babe_util_->slotStartsIn(slot) - lead);
+    prebuild_timer_->asyncWait(
+        [wp = weak_from_this(),
+         slot,
+         output = *slots_leadership_.value()[slot_index]](auto &&ec) {
+          if (auto self = wp.lock()) {
+            if (ec) {
+              return;
+            }
+            self->prebuildBlock(slot, output);
+          }
+        });
+  }
+
+  void BabeImpl::prebuildBlock(BabeSlotNumber slot,
+                               const crypto::VRFOutput &output) {
+    // the block is built on the main context like the blocks built in their
+    // slots, as runtime calls must not run concurrently with block import;
+    // import of a block arriving meanwhile waits for the build to finish
+
+    // the slot has begun while waiting, it builds its block itself
+    if (babe_util_->getCurrentSlot() >= slot) {
+      return;
+    }
+
+    // the block is built the same way as in its slot, with the time of the
+    // slot start, and extrinsics are applied until the slot begins
+    const auto slot_start = clock_->now() + babe_util_->slotStartsIn(slot);
+    auto best_block_info = block_tree_->deepestLeaf();
+    SL_DEBUG(log_,
+             "Building a block for slot {} in advance on block #{} ({})",
+             slot,
+             best_block_info.number,
+             best_block_info.hash);
+    auto block_res =
+        proposeBlock(slot, output, best_block_info, slot_start, slot_start);
+    if (not block_res) {
+      log_->warn("Cannot build a block for slot {} in advance: {}",
+                 slot,
+                 block_res.error().message());
+      prebuilt_failed_->inc();
+      return;
+    }
+    prebuilt_block_ =
+        PrebuiltBlock{slot, best_block_info, std::move(block_res.value())};
   }
 
   BabeLottery::SlotsLeadership BabeImpl::getEpochLeadership(
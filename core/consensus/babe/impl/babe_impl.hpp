@@ -15,19 +15,23 @@
 #include "authorship/proposer.hpp"
 #include "blockchain/block_tree.hpp"
 #include "clock/ticker.hpp"
+#include "clock/timer.hpp"
 #include "consensus/authority/authority_update_observer.hpp"
 #include "consensus/babe/babe_gossiper.hpp"
 #include "consensus/babe/babe_lottery.hpp"
 #include "consensus/babe/babe_util.hpp"
 #include "consensus/babe/impl/block_executor.hpp"
+#include "consensus/babe/post_state_cache.hpp"
 #include "crypto/hasher.hpp"
 #include "crypto/sr25519_provider.hpp"
 #include "crypto/sr25519_types.hpp"
 #include "log/logger.hpp"
+#include "metrics/metrics.hpp"
 #include "outcome/outcome.hpp"
 #include "primitives/babe_configuration.hpp"
 #include "primitives/common.hpp"
 #include "storage/trie/trie_storage.hpp"
+#include "transaction_pool/transaction_pool.hpp"
 
 namespace kagome::consensus::babe {
 
@@ -42,6 +46,7 @@ namespace kagome::consensus::babe {
      * Create an instance of Babe implementation
      * @param lottery - implementation of Babe Lottery
      * @param proposer - block proposer
+     * @param tx_pool - pool extrinsics of the authored blocks are removed from
      * @param block_tree - tree of the blocks
      * @param gossiper of this consensus
      * @param keypair - SR25519 keypair of this node
@@ -49,7 +54,9 @@ namespace kagome::consensus::babe {
      * @param clock to measure time
      * @param hasher to take hashes
      * @param ticker to be used by the implementation
+     * @param prebuild_timer to start building blocks ahead of owned slots
      * @param event_bus to deliver events over
+     * @param post_state_cache to remember states of the authored blocks
      */
     BabeImpl(std::shared_ptr<application::AppStateManager> app_state_manager,
              std::shared_ptr<BabeLottery> lottery,
@@ -57,6 +64,7 @@ namespace kagome::consensus::babe {
              std::shared_ptr<storage::trie::TrieStorage> trie_db,
              std::shared_ptr<primitives::BabeConfiguration> configuration,
              std::shared_ptr<authorship::Proposer> proposer,
+             std::shared_ptr<transaction_pool::TransactionPool> tx_pool,
              std::shared_ptr<blockchain::BlockTree> block_tree,
              std::shared_ptr<BabeGossiper> gossiper,
              std::shared_ptr<crypto::Sr25519Provider> sr25519_provider,
@@ -64,9 +72,11 @@ namespace kagome::consensus::babe {
              std::shared_ptr<clock::SystemClock> clock,
              std::shared_ptr<crypto::Hasher> hasher,
              std::unique_ptr<clock::Ticker> ticker,
+             std::unique_ptr<clock::Timer> prebuild_timer,
              std::shared_ptr<authority::AuthorityUpdateObserver>
                  authority_update_observer,
-             std::shared_ptr<BabeUtil> babe_util);
+             std::shared_ptr<BabeUtil> babe_util,
+             std::shared_ptr<PostStateCache> post_state_cache);
 
     ~BabeImpl() override = default;
 
@@ -95,6 +105,34 @@ namespace kagome::consensus::babe {
      */
     void processSlotLeadership(const crypto::VRFOutput &output);
 
+    /**
+     * Builds a block without a seal
+     * @param slot in which the block is produced
+     * @param output that we are the leader of this slot
+     * @param parent block to build on
+     * @param timestamp to put to the inherent data
+     * @param deadline after which no more extrinsics are applied
+     */
+    outcome::result<primitives::Block> proposeBlock(
+        BabeSlotNumber slot,
+        const crypto::VRFOutput &output,
+        const primitives::BlockInfo &parent,
+        clock::SystemClock::TimePoint timestamp,
+        clock::SystemClock::TimePoint deadline);
+
+    /**
+     * Arms the timer to build a block in advance if we are the leader of the
+     * next slot
+     */
+    void schedulePrebuild();
+
+    /**
+     * Builds a block for the owned \arg slot, which has not begun yet, on
+     * the current best block. The block is sealed and announced when the
+     * slot begins, unless the best block changes by then
+     */
+    void prebuildBlock(BabeSlotNumber slot, const crypto::VRFOutput &output);
+
     /**
      * Finish the Babe epoch
      */
@@ -106,6 +144,7 @@ namespace kagome::consensus::babe {
         const Randomness &randomness) const;
 
     outcome::result<primitives::PreRuntime> babePreDigest(
+        BabeSlotNumber slot,
         const crypto::VRFOutput &output,
         primitives::AuthorityIndex authority_index) const;
 
@@ -135,6 +174,7 @@ namespace kagome::consensus::babe {
     std::shared_ptr<storage::trie::TrieStorage> trie_storage_;
     std::shared_ptr<primitives::BabeConfiguration> babe_configuration_;
     std::shared_ptr<authorship::Proposer> proposer_;
+    std::shared_ptr<transaction_pool::TransactionPool> tx_pool_;
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<BabeGossiper> gossiper_;
     const std::shared_ptr<crypto::Sr25519Keypair>& keypair_;
@@ -142,9 +182,11 @@ namespace kagome::consensus::babe {
     std::shared_ptr<crypto::Hasher> hasher_;
     std::shared_ptr<crypto::Sr25519Provider> sr25519_provider_;
     std::unique_ptr<clock::Ticker> ticker_;
+    std::unique_ptr<clock::Timer> prebuild_timer_;
     std::shared_ptr<authority::AuthorityUpdateObserver>
         authority_update_observer_;
     std::shared_ptr<BabeUtil> babe_util_;
+    std::shared_ptr<PostStateCache> post_state_cache_;
 
     State current_state_{State::WAIT_BLOCK};
 
@@ -156,8 +198,23 @@ namespace kagome::consensus::babe {
     BabeSlotNumber current_slot_{};
     boost::optional<BabeLottery::SlotsLeadership> slots_leadership_;
 
+    /// Block built in advance for an owned slot, waiting for it to begin
+    struct PrebuiltBlock {
+      BabeSlotNumber slot;
+      primitives::BlockInfo parent;
+      primitives::Block block;
+    };
+    boost::optional<PrebuiltBlock> prebuilt_block_;
+
     std::function<void()> on_synchronized_;
 
+    // metrics
+    metrics::RegistryPtr registry_ = metrics::createRegistry();
+    metrics::Histogram *slot_share_;
+    metrics::Counter *prebuilt_used_;
+    metrics::Counter *prebuilt_discarded_;
+    metrics::Counter *prebuilt_failed_;
+
     log::Logger log_;
   };
 }  // namespace kagome::consensus::babe
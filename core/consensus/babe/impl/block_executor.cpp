@@ -6,15 +6,40 @@
 #include "consensus/babe/impl/block_executor.hpp"
 
 #include <chrono>
+
+#include <boost/range/adaptor/transformed.hpp>
 #include <libp2p/peer/peer_id.hpp>
 
 #include "blockchain/block_tree_error.hpp"
 #include "consensus/babe/impl/babe_digests_util.hpp"
 #include "consensus/babe/impl/threshold_util.hpp"
+#include "metrics/timing.hpp"
 #include "primitives/common.hpp"
 #include "scale/scale.hpp"
+#include "storage/trie/serialization/ordered_trie_hash.hpp"
 #include "transaction_pool/transaction_pool_error.hpp"
 
+namespace {
+  constexpr const char *kBlocksCounterName = "kagome_block_import_blocks_total";
+  constexpr const char *kPostStatesReusedCounterName =
+      "kagome_block_import_post_states_reused_total";
+  constexpr const char *kImportHistogramName = "kagome_block_import_seconds";
+  constexpr const char *kStageHistogramName =
+      "kagome_block_import_stage_seconds";
+
+  /// @return true if the body of the block is the one its header commits to
+  bool bodyMatchesHeader(const kagome::primitives::Block &block) {
+    using boost::adaptors::transformed;
+    const auto root_res = kagome::storage::trie::calculateOrderedTrieHash(
+        block.body | transformed([](const auto &ext) {
+          return kagome::common::Buffer{kagome::scale::encode(ext).value()};
+        }));
+    return root_res.has_value()
+           and root_res.value()
+                   == kagome::common::Buffer(block.header.extrinsics_root);
+  }
+}  // namespace
+
 OUTCOME_CPP_DEFINE_CATEGORY(kagome::consensus, BlockExecutor::Error, e) {
   using E = kagome::consensus::BlockExecutor::Error;
   switch (e) {
@@ -38,6 +63,7 @@ namespace kagome::consensus {
       std::shared_ptr<authority::AuthorityUpdateObserver>
           authority_update_observer,
       std::shared_ptr<BabeUtil> babe_util,
+      std::shared_ptr<PostStateCache> post_state_cache,
       std::shared_ptr<boost::asio::io_context> io_context,
       std::unique_ptr<clock::Timer> sync_timer)
       : sync_state_(kReadyState),
@@ -52,6 +78,7 @@ namespace kagome::consensus {
         hasher_{std::move(hasher)},
         authority_update_observer_{std::move(authority_update_observer)},
         babe_util_(std::move(babe_util)),
+        post_state_cache_(std::move(post_state_cache)),
         io_context_(std::move(io_context)),
         logger_{log::createLogger("BlockExecutor", "block_executor")} {
     BOOST_ASSERT(block_tree_ != nullptr);
@@ -64,9 +91,46 @@ namespace kagome::consensus {
     BOOST_ASSERT(hasher_ != nullptr);
     BOOST_ASSERT(authority_update_observer_ != nullptr);
     BOOST_ASSERT(babe_util_ != nullptr);
+    BOOST_ASSERT(post_state_cache_ != nullptr);
     BOOST_ASSERT(io_context_ != nullptr);
     BOOST_ASSERT(sync_timer_ != nullptr);
     BOOST_ASSERT(logger_ != nullptr);
+
+    // initialize metrics
+    registry_->registerCounterFamily(
+        kBlocksCounterName, "Number of blocks received for import by result");
+    blocks_imported_ = registry_->registerCounterMetric(
+        kBlocksCounterName, {{"result", "imported"}});
+    blocks_skipped_ = registry_->registerCounterMetric(
+        kBlocksCounterName, {{"result", "skipped"}});
+    blocks_failed_ = registry_->registerCounterMetric(kBlocksCounterName,
+                                                      {{"result", "failed"}});
+    registry_->registerCounterFamily(
+        kPostStatesReusedCounterName,
+        "Number of blocks imported without execution, as their post-state "
+        "had been produced before");
+    post_states_reused_ =
+        registry_->registerCounterMetric(kPostStatesReusedCounterName);
+    registry_->registerHistogramFamily(kImportHistogramName,
+                                       "Time taken to import a block");
+    import_time_ = registry_->registerHistogramMetric(
+        kImportHistogramName, {0.01, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10, 30});
+    registry_->registerHistogramFamily(
+        kStageHistogramName, "Time taken by a stage of block import");
+    auto register_stage = [&](const std::string &stage) {
+      return registry_->registerHistogramMetric(
+          kStageHistogramName,
+          {0.0001, 0.0005, 0.001, 0.005, 0.01, 0.05, 0.1, 0.5, 1, 5},
+          {{"stage", stage}});
+    };
+    stage_time_.header_hash = register_stage("header_hash");
+    stage_time_.digests = register_stage("digests");
+    stage_time_.validation = register_stage("validation");
+    stage_time_.execution = register_stage("execution");
+    stage_time_.insertion = register_stage("insertion");
+    stage_time_.authorities = register_stage("authorities");
+    stage_time_.justification = register_stage("justification");
+    stage_time_.tx_pool = register_stage("tx_pool");
   }
 
   void BlockExecutor::processNextBlock(
@@ -203,6 +267,15 @@ namespace kagome::consensus {
             auto block = std::move(blocks[i++]);  // For free memory asap
 
             auto apply_res = self->applyBlock(block);
+            if (apply_res.has_value()) {
+              self->blocks_imported_->inc();
+            } else if (apply_res
+                       == outcome::failure(
+                           blockchain::BlockTreeError::BLOCK_EXISTS)) {
+              self->blocks_skipped_->inc();
+            } else {
+              self->blocks_failed_->inc();
+            }
 
             // Failed
             if (not apply_res.has_value()
@@ -253,9 +326,16 @@ namespace kagome::consensus {
     block.header = *b.header;
     if (b.body) block.body = *b.body;
     // get current time to measure performance if block execution
-    auto t_start = std::chrono::high_resolution_clock::now();
+    const auto import_start = std::chrono::steady_clock::now();
+    auto stage_start = import_start;
+    // observes time since the end of the previous stage
+    auto stage_done = [&stage_start](metrics::Histogram *stage_time) {
+      stage_time->observe(metrics::secondsSince(stage_start));
+      stage_start = std::chrono::steady_clock::now();
+    };
 
     auto block_hash = hasher_->blake2b_256(scale::encode(block.header).value());
+    stage_done(stage_time_.header_hash);
 
     // check if block body already exists. If so, do not apply
     if (block_tree_->getBlockBody(block_hash)) {
@@ -313,6 +393,7 @@ namespace kagome::consensus {
           block.header.number,
           next_epoch_digest.randomness.toHex());
     }
+    stage_done(stage_time_.digests);
 
     OUTCOME_TRY(block_validator_->validateHeader(
         block.header,
@@ -320,16 +401,35 @@ namespace kagome::consensus {
         this_block_epoch_descriptor.authorities[babe_header.authority_index].id,
         threshold,
         this_block_epoch_descriptor.randomness));
+    stage_done(stage_time_.validation);
 
     auto block_without_seal_digest = block;
 
     // block should be applied without last digest which contains the seal
     block_without_seal_digest.header.digest.pop_back();
-    // apply block
-    OUTCOME_TRY(core_->execute_block(block_without_seal_digest));
+    // apply block, unless its post-state is already in the storage; stored
+    // blocks are skipped above, so the post-state is known here only for a
+    // block which state has been committed, but which has not been stored,
+    // e.g. as its insertion failed after the execution or authoring. The hash
+    // covers the header only, so the body is checked to be the executed one,
+    // otherwise the execution rejects it
+    if (post_state_cache_->contains(block_hash, block.header.state_root)
+        and bodyMatchesHeader(block)) {
+      SL_DEBUG(logger_,
+               "Post-state of block number: {}, hash: {} is known, skipping "
+               "its execution",
+               block.header.number,
+               block_hash.toHex());
+      post_states_reused_->inc();
+    } else {
+      OUTCOME_TRY(core_->execute_block(block_without_seal_digest));
+      post_state_cache_->put(block_hash, block.header.state_root);
+    }
+    stage_done(stage_time_.execution);
 
     // add block header if it does not exist
     OUTCOME_TRY(block_tree_->addBlock(block));
+    stage_done(stage_time_.insertion);
 
     // observe possible changes of authorities
     for (auto &digest_item : block_without_seal_digest.header.digest) {
@@ -344,6 +444,7 @@ namespace kagome::consensus {
           },
           [](const auto &) { return outcome::success(); }));
     }
+    stage_done(stage_time_.authorities);
 
     // apply justification if any
     if (b.justification.has_value()) {
@@ -352,6 +453,7 @@ namespace kagome::consensus {
       OUTCOME_TRY(grandpa_environment_->applyJustification(
           primitives::BlockInfo(block.header.number, block_hash),
           b.justification.value()));
+      stage_done(stage_time_.justification);
     }
 
     // remove block's extrinsics from tx pool
@@ -364,14 +466,16 @@ namespace kagome::consensus {
         return res.as_failure();
       }
     }
-
-    auto t_end = std::chrono::high_resolution_clock::now();
+    stage_done(stage_time_.tx_pool);
+    const auto import_duration =
+        std::chrono::steady_clock::now() - import_start;
+    import_time_->observe(metrics::toSeconds(import_duration));
 
     logger_->info(
         "Imported block with number: {}, hash: {} within {} ms",
         block.header.number,
         block_hash.toHex(),
-        std::chrono::duration_cast<std::chrono::milliseconds>(t_end - t_start)
+        std::chrono::duration_cast<std::chrono::milliseconds>(import_duration)
             .count());
     return outcome::success();
   }
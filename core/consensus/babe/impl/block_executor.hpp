@@ -13,10 +13,12 @@
 #include "consensus/authority/authority_update_observer.hpp"
 #include "consensus/babe/babe_synchronizer.hpp"
 #include "consensus/babe/babe_util.hpp"
+#include "consensus/babe/post_state_cache.hpp"
 #include "consensus/grandpa/environment.hpp"
 #include "consensus/validation/block_validator.hpp"
 #include "crypto/hasher.hpp"
 #include "log/logger.hpp"
+#include "metrics/metrics.hpp"
 #include "primitives/babe_configuration.hpp"
 #include "primitives/block_header.hpp"
 #include "runtime/core.hpp"
@@ -41,6 +43,7 @@ namespace kagome::consensus {
                   std::shared_ptr<authority::AuthorityUpdateObserver>
                       authority_update_observer,
                   std::shared_ptr<BabeUtil> babe_util,
+                  std::shared_ptr<PostStateCache> post_state_cache,
                   std::shared_ptr<boost::asio::io_context> io_context,
                   std::unique_ptr<clock::Timer> sync_timer);
 
@@ -104,9 +107,28 @@ namespace kagome::consensus {
     std::shared_ptr<authority::AuthorityUpdateObserver>
         authority_update_observer_;
     std::shared_ptr<BabeUtil> babe_util_;
+    std::shared_ptr<PostStateCache> post_state_cache_;
     std::shared_ptr<boost::asio::io_context> io_context_;
     log::Logger logger_;
 
+    // metrics
+    metrics::RegistryPtr registry_ = metrics::createRegistry();
+    metrics::Counter *blocks_imported_;
+    metrics::Counter *blocks_skipped_;
+    metrics::Counter *blocks_failed_;
+    metrics::Counter *post_states_reused_;
+    metrics::Histogram *import_time_;
+    struct {
+      metrics::Histogram *header_hash;
+      metrics::Histogram *digests;
+      metrics::Histogram *validation;
+      metrics::Histogram *execution;
+      metrics::Histogram *insertion;
+      metrics::Histogram *authorities;
+      metrics::Histogram *justification;
+      metrics::Histogram *tx_pool;
+    } stage_time_;
+
     /**
      * Aux class for doing iterable action aynchronously (not all iteration as
      * solid execution)
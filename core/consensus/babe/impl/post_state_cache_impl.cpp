@@ -0,0 +1,33 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/babe/impl/post_state_cache_impl.hpp"
+
+namespace kagome::consensus {
+
+  void PostStateCacheImpl::put(const primitives::BlockHash &block_hash,
+                               const storage::trie::RootHash &state_root) {
+    std::lock_guard lock(mutex_);
+    auto [it, inserted] = state_roots_.emplace(block_hash, state_root);
+    if (not inserted) {
+      it->second = state_root;
+      return;
+    }
+    order_.push_back(block_hash);
+    if (order_.size() > kMaxBlocks) {
+      state_roots_.erase(order_.front());
+      order_.pop_front();
+    }
+  }
+
+  bool PostStateCacheImpl::contains(
+      const primitives::BlockHash &block_hash,
+      const storage::trie::RootHash &state_root) const {
+    std::lock_guard lock(mutex_);
+    auto it = state_roots_.find(block_hash);
+    return it != state_roots_.end() and it->second == state_root;
+  }
+
+}  // namespace kagome::consensus
@@ -0,0 +1,40 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_CONSENSUS_BABE_IMPL_POST_STATE_CACHE_IMPL_HPP
+#define KAGOME_CORE_CONSENSUS_BABE_IMPL_POST_STATE_CACHE_IMPL_HPP
+
+#include "consensus/babe/post_state_cache.hpp"
+
+#include <deque>
+#include <map>
+#include <mutex>
+
+namespace kagome::consensus {
+
+  class PostStateCacheImpl final : public PostStateCache {
+   public:
+    /// Number of blocks which post-states are remembered, oldest ones are
+    /// evicted first
+    static constexpr size_t kMaxBlocks = 64;
+
+    PostStateCacheImpl() = default;
+    ~PostStateCacheImpl() override = default;
+
+    void put(const primitives::BlockHash &block_hash,
+             const storage::trie::RootHash &state_root) override;
+
+    bool contains(const primitives::BlockHash &block_hash,
+                  const storage::trie::RootHash &state_root) const override;
+
+   private:
+    mutable std::mutex mutex_;
+    std::map<primitives::BlockHash, storage::trie::RootHash> state_roots_;
+    std::deque<primitives::BlockHash> order_;
+  };
+
+}  // namespace kagome::consensus
+
+#endif  // KAGOME_CORE_CONSENSUS_BABE_IMPL_POST_STATE_CACHE_IMPL_HPP
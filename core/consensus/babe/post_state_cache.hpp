@@ -0,0 +1,43 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_CONSENSUS_BABE_POST_STATE_CACHE_HPP
+#define KAGOME_CORE_CONSENSUS_BABE_POST_STATE_CACHE_HPP
+
+#include "primitives/common.hpp"
+#include "storage/trie/types.hpp"
+
+namespace kagome::consensus {
+
+  /**
+   * Remembers the blocks which post-state has been recently produced by this
+   * node, either by authoring or by execution of the block. The post-state is
+   * committed to the trie storage when the runtime calculates the storage
+   * root, so the same block may be imported later on without running
+   * Core_execute_block once more
+   */
+  class PostStateCache {
+   public:
+    virtual ~PostStateCache() = default;
+
+    /**
+     * Records that the state of the block is stored in the trie storage
+     * @param block_hash hash of the block header including the seal
+     * @param state_root root of the state produced by the block
+     */
+    virtual void put(const primitives::BlockHash &block_hash,
+                     const storage::trie::RootHash &state_root) = 0;
+
+    /**
+     * @return true if the block with \arg block_hash was recorded with
+     * \arg state_root as its post-state
+     */
+    virtual bool contains(const primitives::BlockHash &block_hash,
+                          const storage::trie::RootHash &state_root) const = 0;
+  };
+
+}  // namespace kagome::consensus
+
+#endif  // KAGOME_CORE_CONSENSUS_BABE_POST_STATE_CACHE_HPP
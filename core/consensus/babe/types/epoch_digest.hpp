@@ -39,6 +39,38 @@ namespace kagome::consensus {
     return s >> digest.authorities >> digest.randomness;
   }
 
+  /// Digests in effect at a block: the one of its epoch and the next one
+  struct EpochDigests {
+    /// The epoch of the block
+    EpochNumber epoch_number = 0;
+
+    /// Digest of the epoch of the block
+    EpochDigest epoch;
+
+    /// Digest announced for the next epoch, or the same one if there is none
+    EpochDigest next_epoch;
+
+    bool operator==(const EpochDigests &rhs) const {
+      return epoch_number == rhs.epoch_number and epoch == rhs.epoch
+             and next_epoch == rhs.next_epoch;
+    }
+    bool operator!=(const EpochDigests &rhs) const {
+      return not operator==(rhs);
+    }
+  };
+
+  template <class Stream,
+            typename = std::enable_if_t<Stream::is_encoder_stream>>
+  Stream &operator<<(Stream &s, const EpochDigests &digests) {
+    return s << digests.epoch_number << digests.epoch << digests.next_epoch;
+  }
+
+  template <class Stream,
+            typename = std::enable_if_t<Stream::is_decoder_stream>>
+  Stream &operator>>(Stream &s, EpochDigests &digests) {
+    return s >> digests.epoch_number >> digests.epoch >> digests.next_epoch;
+  }
+
 }  // namespace kagome::consensus
 
 #endif  // KAGOME_CONSENSUS_EPOCHDIGEST
@@ -10,6 +10,7 @@
 
 #include "blockchain/block_header_repository.hpp"
 #include "blockchain/block_tree.hpp"
+#include "blockchain/block_tree_error.hpp"
 #include "consensus/grandpa/gossiper.hpp"
 #include "consensus/grandpa/justification_observer.hpp"
 #include "scale/scale.hpp"
@@ -40,9 +41,31 @@ namespace kagome::consensus::grandpa {
       return std::vector<BlockHash>{base};
     }
 
-    OUTCOME_TRY(chain, block_tree_->getChainByBlocks(base, block));
-    std::reverse(chain.begin(), chain.end());
-    return std::move(chain);
+    std::vector<BlockHash> ancestry{block};
+    while (ancestry.back() != base) {
+      auto parent_it = parents_.find(ancestry.back());
+      if (parent_it != parents_.end()) {
+        ancestry.push_back(parent_it->second);
+        continue;
+      }
+
+      // the rest is not cached, the block tree walks it once
+      OUTCOME_TRY(chain, block_tree_->getChainByBlocks(base, ancestry.back()));
+      if (chain.empty() or chain.front() != base
+          or chain.back() != ancestry.back()) {
+        return blockchain::BlockTreeError::NO_SOME_BLOCK_IN_CHAIN;
+      }
+      cacheAncestry(chain);
+      ancestry.insert(ancestry.end(), chain.rbegin() + 1, chain.rend());
+    }
+    return std::move(ancestry);
+  }
+
+  void EnvironmentImpl::cacheAncestry(
+      const std::vector<BlockHash> &chain) const {
+    for (size_t i = 1; i < chain.size(); ++i) {
+      parents_.emplace(chain[i], chain[i - 1]);
+    }
   }
 
   bool EnvironmentImpl::hasAncestry(const BlockHash &base,
@@ -219,7 +242,10 @@ namespace kagome::consensus::grandpa {
       const GrandpaJustification &grandpa_jusitification) {
     primitives::Justification justification;
     justification.data.put(scale::encode(grandpa_jusitification).value());
-    return block_tree_->finalize(block_hash, justification);
+    OUTCOME_TRY(block_tree_->finalize(block_hash, justification));
+    // the following rounds vote above the finalized block
+    parents_.clear();
+    return outcome::success();
   }
 
   outcome::result<GrandpaJustification> EnvironmentImpl::getJustification(
@@ -8,6 +8,8 @@
 
 #include "consensus/grandpa/environment.hpp"
 
+#include <unordered_map>
+
 #include <boost/signals2/signal.hpp>
 
 #include "log/logger.hpp"
@@ -102,11 +104,23 @@ namespace kagome::consensus::grandpa {
         const BlockHash &block_hash) override;
 
    private:
+    /**
+     * Remembers the parent links of \arg chain, which is in the ascending
+     * order as the block tree returns it
+     */
+    void cacheAncestry(const std::vector<primitives::BlockHash> &chain) const;
+
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<blockchain::BlockHeaderRepository> header_repository_;
     std::shared_ptr<Gossiper> gossiper_;
     std::weak_ptr<JustificationObserver> justification_observer_;
 
+    /// parents of the blocks met in the requested ancestries. Votes of a
+    /// round target a few chains, so their ancestries are mostly walked in
+    /// memory. Dropped on finalization, when the base of the votes moves on
+    mutable std::unordered_map<primitives::BlockHash, primitives::BlockHash>
+        parents_;
+
     OnCompleted on_completed_;
     log::Logger logger_;
   };
@@ -5,15 +5,25 @@
 
 #include "consensus/grandpa/impl/grandpa_impl.hpp"
 
+#include <algorithm>
+
 #include "consensus/grandpa/impl/vote_crypto_provider_impl.hpp"
 #include "consensus/grandpa/impl/vote_tracker_impl.hpp"
 #include "consensus/grandpa/impl/voting_round_error.hpp"
 #include "consensus/grandpa/impl/voting_round_impl.hpp"
 #include "consensus/grandpa/vote_graph/vote_graph_impl.hpp"
+#include "metrics/timing.hpp"
 #include "scale/scale.hpp"
 #include "storage/database_error.hpp"
 #include "storage/predefined_keys.hpp"
 
+namespace {
+  constexpr const char *kVotesQueuedGaugeName = "kagome_grandpa_votes_queued";
+  constexpr const char *kRoundVotesGaugeName = "kagome_grandpa_round_votes";
+  constexpr const char *kVoteLatencyHistogramName =
+      "kagome_grandpa_vote_verification_latency_seconds";
+}  // namespace
+
 namespace kagome::consensus::grandpa {
 
   GrandpaImpl::GrandpaImpl(
@@ -26,7 +36,8 @@ namespace kagome::consensus::grandpa {
       std::shared_ptr<Clock> clock,
       std::shared_ptr<boost::asio::io_context> io_context,
       std::shared_ptr<authority::AuthorityManager> authority_manager,
-      std::shared_ptr<consensus::babe::Babe> babe)
+      std::shared_ptr<consensus::babe::Babe> babe,
+      const application::AppConfiguration &app_config)
       : app_state_manager_(std::move(app_state_manager)),
         environment_{std::move(environment)},
         storage_{std::move(storage)},
@@ -36,7 +47,9 @@ namespace kagome::consensus::grandpa {
         clock_{std::move(clock)},
         io_context_{std::move(io_context)},
         authority_manager_(std::move(authority_manager)),
-        babe_(babe) {
+        babe_(babe),
+        verification_pool_("grandpa_votes",
+                           app_config.threadingConfig().grandpa_threads) {
     BOOST_ASSERT(app_state_manager_ != nullptr);
     BOOST_ASSERT(environment_ != nullptr);
     BOOST_ASSERT(storage_ != nullptr);
@@ -49,6 +62,28 @@ namespace kagome::consensus::grandpa {
 
     app_state_manager_->takeControl(*this);
     catch_up_request_suppressed_until_ = clock_->now();
+
+    // initialize metrics
+    registry_->registerGaugeFamily(
+        kVotesQueuedGaugeName,
+        "Received votes which are being verified or waiting to be applied");
+    votes_queued_ = registry_->registerGaugeMetric(kVotesQueuedGaugeName);
+    registry_->registerGaugeFamily(
+        kRoundVotesGaugeName,
+        "Votes received since the current round has started, by result of "
+        "verification");
+    round_votes_verified_ = registry_->registerGaugeMetric(
+        kRoundVotesGaugeName, {{"result", "verified"}});
+    round_votes_rejected_ = registry_->registerGaugeMetric(
+        kRoundVotesGaugeName, {{"result", "rejected"}});
+    round_votes_duplicated_ = registry_->registerGaugeMetric(
+        kRoundVotesGaugeName, {{"result", "duplicated"}});
+    registry_->registerHistogramFamily(
+        kVoteLatencyHistogramName,
+        "Time from receiving a vote to applying it to the round");
+    vote_latency_ = registry_->registerHistogramMetric(
+        kVoteLatencyHistogramName,
+        {0.0001, 0.0005, 0.001, 0.005, 0.01, 0.05, 0.1, 0.5, 1});
   }
 
   bool GrandpaImpl::prepare() {
@@ -67,6 +102,8 @@ namespace kagome::consensus::grandpa {
   }
 
   bool GrandpaImpl::start() {
+    verification_pool_.start();
+
     // Obtain last completed round
     auto round_state_res = getLastCompletedRound();
     if (not round_state_res.has_value()) {
@@ -124,7 +161,9 @@ namespace kagome::consensus::grandpa {
     return true;
   }
 
-  void GrandpaImpl::stop() {}
+  void GrandpaImpl::stop() {
+    verification_pool_.stop();
+  }
 
   std::shared_ptr<VotingRound> GrandpaImpl::makeInitialRound(
       const MovableRoundState &round_state, std::shared_ptr<VoterSet> voters) {
@@ -451,6 +490,14 @@ namespace kagome::consensus::grandpa {
       return;
     }
 
+    // the same vote is gossiped by many peers, its copies are dropped before
+    // anything is asked of the runtime
+    auto message = scale::encode(msg).value();
+    if (pending_votes_.isDuplicate(msg.round_number, message)) {
+      round_votes_duplicated_->inc();
+      return;
+    }
+
     // get block info
     auto blockInfo = visit_in_place(msg.vote.message, [](const auto &vote) {
       return BlockInfo(vote.number, vote.hash);
@@ -477,17 +524,82 @@ namespace kagome::consensus::grandpa {
       logger_->warn("Vote signed by unknown validator");
       return;
     };
-    visit_in_place(
-        msg.vote.message,
-        [&target_round, &msg](const PrimaryPropose &) {
-          target_round->onProposal(msg.vote);
-        },
-        [&target_round, &msg](const Prevote &) {
-          target_round->onPrevote(msg.vote);
-        },
-        [&target_round, &msg](const Precommit &) {
-          target_round->onPrecommit(msg.vote);
-        });
+
+    updateRoundMetrics();
+    auto pending = pending_votes_.push(
+        msg.round_number,
+        std::move(message),
+        PendingVotes::Vote{target_round, msg.vote, clock_->now(), boost::none});
+    BOOST_ASSERT(pending != nullptr);
+    votes_queued_->inc();
+
+    // the queued vote holds the round, so the pool gets only the provider
+    // and a copy of the vote, and the round is released in the thread of
+    // io_context only
+    verification_pool_.post([wp = weak_from_this(),
+                             io_context = io_context_,
+                             provider = target_round->voteCryptoProvider(),
+                             vote = msg.vote,
+                             pending_wp = std::weak_ptr<PendingVotes::Vote>(
+                                 pending)]() mutable {
+      auto valid = visit_in_place(
+          vote.message,
+          [&](const PrimaryPropose &) {
+            return provider->verifyPrimaryPropose(vote);
+          },
+          [&](const Prevote &) { return provider->verifyPrevote(vote); },
+          [&](const Precommit &) { return provider->verifyPrecommit(vote); });
+      boost::asio::post(
+          *io_context,
+          [wp = std::move(wp), pending_wp = std::move(pending_wp), valid] {
+            auto self = wp.lock();
+            auto pending = pending_wp.lock();
+            if (self and pending) {
+              pending->valid = valid;
+              self->applyVerifiedVotes();
+            }
+          });
+    });
+  }
+
+  void GrandpaImpl::applyVerifiedVotes() {
+    while (auto pending = pending_votes_.popChecked()) {
+      votes_queued_->dec();
+      vote_latency_->observe(
+          metrics::toSeconds(clock_->now() - pending->received));
+
+      auto &round = pending->round;
+      if (not pending->valid.value()) {
+        round_votes_rejected_->inc();
+        logger_->warn(
+            "Round #{}: Vote received from {} was rejected: invalid signature",
+            round->roundNumber(),
+            pending->vote.id.toHex());
+        continue;
+      }
+      round_votes_verified_->inc();
+
+      // the round might be gone while the vote was being verified
+      if (selectRound(round->roundNumber()) != round) {
+        continue;
+      }
+      round->onVerifiedVote(pending->vote);
+    }
+  }
+
+  void GrandpaImpl::updateRoundMetrics() {
+    auto round_number = current_round_->roundNumber();
+    if (round_number == metrics_round_) {
+      return;
+    }
+    metrics_round_ = round_number;
+    round_votes_verified_->set(0);
+    round_votes_rejected_->set(0);
+    round_votes_duplicated_->set(0);
+
+    // votes are accepted for the current and previous rounds only
+    pending_votes_.forgetRoundsBefore(round_number == 0 ? 0
+                                                        : round_number - 1);
   }
 
   void GrandpaImpl::onFinalize(const libp2p::peer::PeerId &peer_id,
@@ -9,17 +9,21 @@
 #include "consensus/grandpa/grandpa.hpp"
 #include "consensus/grandpa/grandpa_observer.hpp"
 
+#include "application/app_configuration.hpp"
 #include "application/app_state_manager.hpp"
 #include "blockchain/block_tree.hpp"
+#include "common/thread_pool.hpp"
 #include "consensus/authority/authority_manager.hpp"
 #include "consensus/babe/babe.hpp"
 #include "consensus/grandpa/environment.hpp"
+#include "consensus/grandpa/impl/pending_votes.hpp"
 #include "consensus/grandpa/impl/voting_round_impl.hpp"
 #include "consensus/grandpa/movable_round_state.hpp"
 #include "consensus/grandpa/voter_set.hpp"
 #include "crypto/ed25519_provider.hpp"
 #include "crypto/hasher.hpp"
 #include "log/logger.hpp"
+#include "metrics/metrics.hpp"
 #include "network/gossiper.hpp"
 #include "runtime/grandpa_api.hpp"
 #include "storage/buffer_map_types.hpp"
@@ -41,7 +45,8 @@ namespace kagome::consensus::grandpa {
                 std::shared_ptr<Clock> clock,
                 std::shared_ptr<boost::asio::io_context> io_context,
                 std::shared_ptr<authority::AuthorityManager> authority_manager,
-                std::shared_ptr<consensus::babe::Babe> babe);
+                std::shared_ptr<consensus::babe::Babe> babe,
+                const application::AppConfiguration &app_config);
 
     /** @see AppStateManager::takeControl */
     bool prepare();
@@ -93,6 +98,16 @@ namespace kagome::consensus::grandpa {
 
     void onCompletedRound(outcome::result<MovableRoundState> round_state_res);
 
+    /**
+     * Applies the checked votes from the front of the queue. Votes are
+     * applied in the order they were received, so a vote checked earlier
+     * than the preceding ones waits for them
+     */
+    void applyVerifiedVotes();
+
+    /// Resets the metrics of votes when the current round changes
+    void updateRoundMetrics();
+
     // Note: Duration value was gotten from substrate
     // https://github.com/paritytech/substrate/blob/efbac7be80c6e8988a25339061078d3e300f132d/bin/node-template/node/src/service.rs#L166
     // Perhaps, 333ms is not enough for normal communication during the round
@@ -118,6 +133,21 @@ namespace kagome::consensus::grandpa {
         std::chrono::seconds(15);
     Clock::TimePoint catch_up_request_suppressed_until_;
 
+    // signatures of votes are checked in the pool, the rest of handling is
+    // done in the thread of io_context_
+    common::ThreadPool verification_pool_;
+    PendingVotes pending_votes_;
+
+    // metrics
+    metrics::RegistryPtr registry_ = metrics::createRegistry();
+    metrics::Gauge *votes_queued_;
+    metrics::Gauge *round_votes_verified_;
+    metrics::Gauge *round_votes_rejected_;
+    metrics::Gauge *round_votes_duplicated_;
+    metrics::Histogram *vote_latency_;
+    /// round the metrics of votes are collected for
+    RoundNumber metrics_round_ = 0;
+
     log::Logger logger_ = log::createLogger("Grandpa", "grandpa");
   };
 
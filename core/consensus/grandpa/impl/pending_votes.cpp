@@ -0,0 +1,52 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/grandpa/impl/pending_votes.hpp"
+
+#include <algorithm>
+
+namespace kagome::consensus::grandpa {
+
+  bool PendingVotes::isDuplicate(RoundNumber round_number,
+                                 const std::vector<uint8_t> &message) const {
+    if (checking_.count(message) != 0) {
+      return true;
+    }
+    auto it = verified_.find(round_number);
+    return it != verified_.end() and it->second.count(message) != 0;
+  }
+
+  std::shared_ptr<PendingVotes::Vote> PendingVotes::push(
+      RoundNumber round_number, std::vector<uint8_t> message, Vote vote) {
+    if (isDuplicate(round_number, message)) {
+      return nullptr;
+    }
+
+    checking_.insert(message);
+    auto pending = std::make_shared<Vote>(std::move(vote));
+    queue_.push_back(Entry{round_number, std::move(message), pending});
+    return pending;
+  }
+
+  std::shared_ptr<PendingVotes::Vote> PendingVotes::popChecked() {
+    if (queue_.empty() or not queue_.front().vote->valid) {
+      return nullptr;
+    }
+    auto entry = std::move(queue_.front());
+    queue_.pop_front();
+
+    checking_.erase(entry.message);
+    if (entry.vote->valid.value() and entry.round_number >= oldest_round_) {
+      verified_[entry.round_number].insert(std::move(entry.message));
+    }
+    return std::move(entry.vote);
+  }
+
+  void PendingVotes::forgetRoundsBefore(RoundNumber round_number) {
+    oldest_round_ = std::max(oldest_round_, round_number);
+    verified_.erase(verified_.begin(), verified_.lower_bound(oldest_round_));
+  }
+
+}  // namespace kagome::consensus::grandpa
@@ -0,0 +1,91 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CONSENSUS_GRANDPA_PENDING_VOTES_HPP
+#define KAGOME_CONSENSUS_GRANDPA_PENDING_VOTES_HPP
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "consensus/grandpa/common.hpp"
+#include "consensus/grandpa/structs.hpp"
+
+namespace kagome::consensus::grandpa {
+
+  class VotingRound;
+
+  /**
+   * Queue of votes received from the network, which signatures are being
+   * checked. Votes leave the queue in the order they were received, so a
+   * vote checked earlier than the preceding ones waits for them.
+   * The same vote message is gossiped by several peers, so a message which
+   * is being checked or has been checked successfully is not queued again.
+   * Messages of rejected votes are not remembered, so that votes with invalid
+   * signatures do not take the memory
+   */
+  class PendingVotes {
+   public:
+    struct Vote {
+      std::shared_ptr<VotingRound> round;
+      SignedMessage vote;
+      TimePoint received;
+      /// result of the check, none while it is in progress
+      boost::optional<bool> valid;
+    };
+
+    /**
+     * @return true if the message is being checked or has been checked
+     * successfully, so the vote need not be looked at again
+     */
+    bool isDuplicate(RoundNumber round_number,
+                     const std::vector<uint8_t> &message) const;
+
+    /**
+     * Queues the vote to be checked
+     * @param round_number round of the vote message
+     * @param message encoded vote message, which includes round and voter
+     * set, so it is the same only if the vote and the signature are the same
+     * @return queued vote to store the result of the check in, nullptr if the
+     * message is a duplicate
+     */
+    std::shared_ptr<Vote> push(RoundNumber round_number,
+                               std::vector<uint8_t> message,
+                               Vote vote);
+
+    /**
+     * @return the first vote of the queue if its check is finished, nullptr
+     * otherwise
+     */
+    std::shared_ptr<Vote> popChecked();
+
+    /// Forgets checked messages of the rounds before the given one
+    void forgetRoundsBefore(RoundNumber round_number);
+
+    /// @return number of votes in the queue
+    size_t size() const {
+      return queue_.size();
+    }
+
+   private:
+    struct Entry {
+      RoundNumber round_number;
+      std::vector<uint8_t> message;
+      std::shared_ptr<Vote> vote;
+    };
+
+    std::deque<Entry> queue_;
+    std::set<std::vector<uint8_t>> checking_;
+    std::map<RoundNumber, std::set<std::vector<uint8_t>>> verified_;
+    RoundNumber oldest_round_ = 0;
+  };
+
+}  // namespace kagome::consensus::grandpa
+
+#endif  // KAGOME_CONSENSUS_GRANDPA_PENDING_VOTES_HPP
@@ -764,21 +764,57 @@ namespace kagome::consensus::grandpa {
   }
 
   void VotingRoundImpl::onProposal(const SignedMessage &proposal) {
-    if (not isPrimary(proposal.id)) {
+    bool isValid = vote_crypto_provider_->verifyPrimaryPropose(proposal);
+    if (not isValid) {
       logger_->warn(
-          "Round #{}: Proposal received from {} was rejected: voter is not "
-          "primary",
+          "Round #{}: Proposal received from {} was rejected: invalid "
+          "signature",
           round_number_,
           proposal.id.toHex());
       return;
     }
+    applyProposal(proposal);
+  }
 
-    bool isValid = vote_crypto_provider_->verifyPrimaryPropose(proposal);
+  void VotingRoundImpl::onPrevote(const SignedMessage &prevote) {
+    bool isValid = vote_crypto_provider_->verifyPrevote(prevote);
     if (not isValid) {
       logger_->warn(
-          "Round #{}: Proposal received from {} was rejected: invalid "
+          "Round #{}: Prevote received from {} was rejected: invalid signature",
+          round_number_,
+          prevote.id.toHex());
+      return;
+    }
+    applyPrevote(prevote);
+  }
+
+  void VotingRoundImpl::onPrecommit(const SignedMessage &precommit) {
+    bool isValid = vote_crypto_provider_->verifyPrecommit(precommit);
+    if (not isValid) {
+      logger_->warn(
+          "Round #{}: Precommit received from {} was rejected: invalid "
           "signature",
           round_number_,
+          precommit.id.toHex());
+      return;
+    }
+    applyPrecommit(precommit);
+  }
+
+  void VotingRoundImpl::onVerifiedVote(const SignedMessage &vote) {
+    visit_in_place(
+        vote.message,
+        [&](const PrimaryPropose &) { applyProposal(vote); },
+        [&](const Prevote &) { applyPrevote(vote); },
+        [&](const Precommit &) { applyPrecommit(vote); });
+  }
+
+  void VotingRoundImpl::applyProposal(const SignedMessage &proposal) {
+    if (not isPrimary(proposal.id)) {
+      logger_->warn(
+          "Round #{}: Proposal received from {} was rejected: voter is not "
+          "primary",
+          round_number_,
           proposal.id.toHex());
       return;
     }
@@ -793,16 +829,7 @@ namespace kagome::consensus::grandpa {
     primary_vote_ = {{proposal.getBlockNumber(), proposal.getBlockHash()}};
   }
 
-  void VotingRoundImpl::onPrevote(const SignedMessage &prevote) {
-    bool isValid = vote_crypto_provider_->verifyPrevote(prevote);
-    if (not isValid) {
-      logger_->warn(
-          "Round #{}: Prevote received from {} was rejected: invalid signature",
-          round_number_,
-          prevote.id.toHex());
-      return;
-    }
-
+  void VotingRoundImpl::applyPrevote(const SignedMessage &prevote) {
     if (auto result = onSignedPrevote(prevote); result.has_failure()) {
       if (result == outcome::failure(VotingRoundError::DUPLICATED_VOTE)) {
         return;
@@ -836,17 +863,7 @@ namespace kagome::consensus::grandpa {
     }
   }
 
-  void VotingRoundImpl::onPrecommit(const SignedMessage &precommit) {
-    bool isValid = vote_crypto_provider_->verifyPrecommit(precommit);
-    if (not isValid) {
-      logger_->warn(
-          "Round #{}: Precommit received from {} was rejected: invalid "
-          "signature",
-          round_number_,
-          precommit.id.toHex());
-      return;
-    }
-
+  void VotingRoundImpl::applyPrecommit(const SignedMessage &precommit) {
     if (auto result = onSignedPrecommit(precommit); result.has_failure()) {
       if (result == outcome::failure(VotingRoundError::DUPLICATED_VOTE)) {
         return;
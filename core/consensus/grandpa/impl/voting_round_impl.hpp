@@ -141,6 +141,12 @@ namespace kagome::consensus::grandpa {
      */
     void onPrecommit(const SignedMessage &precommit) override;
 
+    void onVerifiedVote(const SignedMessage &vote) override;
+
+    std::shared_ptr<VoteCryptoProvider> voteCryptoProvider() const override {
+      return vote_crypto_provider_;
+    }
+
     /**
      * Checks if current round is completable and finalized block differs from
      * the last round's finalized block. If so fin message is broadcasted to the
@@ -177,6 +183,11 @@ namespace kagome::consensus::grandpa {
     /// Check if peer \param id is primary
     bool isPrimary(const Id &id) const;
 
+    /// Handle votes which signatures are valid
+    void applyProposal(const SignedMessage &proposal);
+    void applyPrevote(const SignedMessage &prevote);
+    void applyPrecommit(const SignedMessage &precommit);
+
     /// Triggered when we receive \param signed_prevote for the current peer
     outcome::result<void> onSignedPrevote(const SignedMessage &signed_prevote);
 
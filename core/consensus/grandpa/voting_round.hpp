@@ -8,6 +8,7 @@
 
 #include "consensus/grandpa/movable_round_state.hpp"
 #include "consensus/grandpa/round_observer.hpp"
+#include "consensus/grandpa/vote_crypto_provider.hpp"
 
 namespace kagome::consensus::grandpa {
 
@@ -104,6 +105,18 @@ namespace kagome::consensus::grandpa {
 
     virtual void onPrecommit(const SignedMessage &precommit) = 0;
 
+    /**
+     * Handles a proposal, prevote or precommit like the methods above, but
+     * doesn't check its signature, which is checked by the caller already
+     */
+    virtual void onVerifiedVote(const SignedMessage &vote) = 0;
+
+    /**
+     * @return provider checking the signatures of the votes of the round.
+     * Its checks don't touch the round, so they may be done in other threads
+     */
+    virtual std::shared_ptr<VoteCryptoProvider> voteCryptoProvider() const = 0;
+
     // Auxiliary methods
 
     virtual outcome::result<void> applyJustification(
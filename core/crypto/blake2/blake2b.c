@@ -11,6 +11,10 @@
 
 #include "blake2b.h"
 
+#include <string.h>
+
+#include "blake2b_avx2.h"
+
 // Cyclic right rotation.
 
 #ifndef ROTR64
@@ -19,6 +23,14 @@
 
 // Little-endian byte access.
 
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+static inline uint64_t b2b_get64(const uint8_t *p) {
+  uint64_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+#define B2B_GET64(p) b2b_get64(p)
+#else
 #define B2B_GET64(p)                                                        \
   (((uint64_t)((uint8_t *)(p))[0]) ^ (((uint64_t)((uint8_t *)(p))[1]) << 8) \
    ^ (((uint64_t)((uint8_t *)(p))[2]) << 16)                                \
@@ -27,6 +39,7 @@
    ^ (((uint64_t)((uint8_t *)(p))[5]) << 40)                                \
    ^ (((uint64_t)((uint8_t *)(p))[6]) << 48)                                \
    ^ (((uint64_t)((uint8_t *)(p))[7]) << 56))
+#endif
 
 // G Mixing function.
 
@@ -51,7 +64,10 @@ static const uint64_t blake2b_iv[8] = {0x6A09E667F3BCC908, 0xBB67AE8584CAA73B,
 
 // Compression function. "last" flag indicates last block.
 
-static void blake2b_compress(blake2b_ctx *ctx, int last) {
+static void blake2b_compress_ref(uint64_t h[8],
+                                 const uint8_t block[128],
+                                 const uint64_t t[2],
+                                 int last) {
   const uint8_t sigma[12][16] = {
       {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
       {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
@@ -70,18 +86,18 @@ static void blake2b_compress(blake2b_ctx *ctx, int last) {
   uint64_t m[16];
 
   for (i = 0; i < 8; i++) {  // init work variables
-    v[i] = ctx->h[i];
+    v[i] = h[i];
     v[i + 8] = blake2b_iv[i];
   }
 
-  v[12] ^= ctx->t[0];  // low 64 bits of offset
-  v[13] ^= ctx->t[1];  // high 64 bits
+  v[12] ^= t[0];  // low 64 bits of offset
+  v[13] ^= t[1];  // high 64 bits
   if (last) {          // last block flag set ?
     v[14] = ~v[14];
   }
 
   for (i = 0; i < 16; i++) {  // get little-endian words
-    m[i] = B2B_GET64(&ctx->b[8 * i]);
+    m[i] = B2B_GET64(&block[8 * i]);
   }
 
   for (i = 0; i < 12; i++) {  // twelve rounds
@@ -96,7 +112,31 @@ static void blake2b_compress(blake2b_ctx *ctx, int last) {
   }
 
   for (i = 0; i < 8; ++i) {
-    ctx->h[i] ^= v[i] ^ v[i + 8];
+    h[i] ^= v[i] ^ v[i + 8];
+  }
+}
+
+// Compresses a block with the fastest implementation the CPU supports.
+
+static void blake2b_compress(uint64_t h[8],
+                             const uint8_t block[128],
+                             const uint64_t t[2],
+                             int last) {
+#ifdef BLAKE2B_AVX2
+  if (__builtin_cpu_supports("avx2")) {
+    blake2b_compress_avx2(h, block, t, last);
+    return;
+  }
+#endif
+  blake2b_compress_ref(h, block, t, last);
+}
+
+// Adds "inc" to the 128-bit input counter.
+
+static void blake2b_increment(blake2b_ctx *ctx, size_t inc) {
+  ctx->t[0] += inc;
+  if (ctx->t[0] < inc) {  // carry overflow ?
+    ctx->t[1]++;          // high word
   }
 }
 
@@ -139,18 +179,28 @@ int blake2b_init(blake2b_ctx *ctx, size_t outlen, const void *key,
 void blake2b_update(blake2b_ctx *ctx, const void *in,
                     size_t inlen)  // data bytes
 {
-  size_t i;
-
-  for (i = 0; i < inlen; i++) {
-    if (ctx->c == 128) {         // buffer full ?
-      ctx->t[0] += ctx->c;       // add counters
-      if (ctx->t[0] < ctx->c) {  // carry overflow ?
-        ctx->t[1]++;             // high word
-      }
-      blake2b_compress(ctx, 0);  // compress (not last)
-      ctx->c = 0;                // counter to zero
+  const uint8_t *p = (const uint8_t *)in;
+  size_t n;
+
+  while (inlen > 0) {
+    if (ctx->c == 128) {  // buffer full ?
+      blake2b_increment(ctx, ctx->c);
+      blake2b_compress(ctx->h, ctx->b, ctx->t, 0);  // compress (not last)
+      ctx->c = 0;                                    // counter to zero
+    }
+    // whole blocks are compressed in place, except for the one which may
+    // turn out to be the last
+    while (ctx->c == 0 && inlen > 128) {
+      blake2b_increment(ctx, 128);
+      blake2b_compress(ctx->h, p, ctx->t, 0);
+      p += 128;
+      inlen -= 128;
     }
-    ctx->b[ctx->c++] = ((const uint8_t *)in)[i];
+    n = 128 - ctx->c < inlen ? 128 - ctx->c : inlen;
+    memcpy(&ctx->b[ctx->c], p, n);
+    ctx->c += n;
+    p += n;
+    inlen -= n;
   }
 }
 
@@ -160,15 +210,11 @@ void blake2b_update(blake2b_ctx *ctx, const void *in,
 void blake2b_final(blake2b_ctx *ctx, void *out) {
   size_t i;
 
-  ctx->t[0] += ctx->c;       // mark last block offset
-  if (ctx->t[0] < ctx->c) {  // carry overflow
-    ctx->t[1]++;             // high word
-  }
+  blake2b_increment(ctx, ctx->c);  // mark last block offset
 
-  while (ctx->c < 128) {  // fill up with zeros
-    ctx->b[ctx->c++] = 0;
-  }
-  blake2b_compress(ctx, 1);  // final block flag = 1
+  memset(&ctx->b[ctx->c], 0, 128 - ctx->c);  // fill up with zeros
+  ctx->c = 128;
+  blake2b_compress(ctx->h, ctx->b, ctx->t, 1);  // final block flag = 1
 
   // little endian convert and store
   for (i = 0; i < ctx->outlen; i++) {
@@ -190,3 +236,27 @@ int blake2b(void *out, size_t outlen, const void *key, size_t keylen,
 
   return 0;
 }
+
+// Digests of several inputs, four at a time with AVX2.
+
+int blake2b_many(uint8_t *const *out, size_t outlen, const uint8_t *const *in,
+                 const size_t *inlen, size_t count) {
+  size_t i = 0;
+
+  if (outlen == 0 || outlen > 64) {
+    return -1;  // illegal parameters
+  }
+
+#ifdef BLAKE2B_AVX2
+  if (__builtin_cpu_supports("avx2")) {
+    for (; i + 4 <= count; i += 4) {
+      blake2b_x4_avx2(&out[i], outlen, &in[i], &inlen[i]);
+    }
+  }
+#endif
+  for (; i < count; i++) {
+    blake2b(out[i], outlen, NULL, 0, in[i], inlen[i]);
+  }
+
+  return 0;
+}
@@ -44,6 +44,14 @@ int blake2b(void *out, size_t outlen,        // return buffer for digest
             const void *key, size_t keylen,  // optional secret key
             const void *in, size_t inlen);   // data to be hashed
 
+// Unkeyed digests of "count" independent inputs, like nodes of a trie.
+//      "out[i]" receives the digest of "inlen[i]" bytes at "in[i]".
+//      Several inputs are hashed at once in lanes of vector registers if
+//      the CPU supports it, which is faster for short inputs.
+int blake2b_many(uint8_t *const *out, size_t outlen,  // digests
+                 const uint8_t *const *in,            // data to be hashed
+                 const size_t *inlen, size_t count);  // their sizes
+
 #if defined(__cplusplus)
 }
 #endif
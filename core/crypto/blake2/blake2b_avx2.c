@@ -0,0 +1,240 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// AVX2 implementations of the BLAKE2b compression function.
+// A single input keeps a row of the 4x4 work matrix in a vector, the way
+// the BLAKE2 SIMD implementations by Samuel Neves do. Several inputs keep
+// one input per 64-bit lane, so that a vector holds the same work variable
+// of all of them.
+
+#include "blake2b_avx2.h"
+
+#ifdef BLAKE2B_AVX2
+
+#include <immintrin.h>
+#include <string.h>
+
+#define B2B_AVX2 __attribute__((target("avx2")))
+
+static const uint64_t blake2b_iv[8] = {0x6A09E667F3BCC908, 0xBB67AE8584CAA73B,
+                                       0x3C6EF372FE94F82B, 0xA54FF53A5F1D36F1,
+                                       0x510E527FADE682D1, 0x9B05688C2B3E6C1F,
+                                       0x1F83D9ABFB41BD6B, 0x5BE0CD19137E2179};
+
+static const uint8_t blake2b_sigma[12][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+    {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+    {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+    {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+    {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+    {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+    {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+    {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+    {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3}};
+
+// Rotations of 64-bit lanes to the right. Rotations by whole bytes are
+// byte shuffles.
+
+#define ROTR32(x) _mm256_shuffle_epi32((x), _MM_SHUFFLE(2, 3, 0, 1))
+#define ROTR24(x) _mm256_shuffle_epi8((x), rotr24)
+#define ROTR16(x) _mm256_shuffle_epi8((x), rotr16)
+#define ROTR63(x) \
+  _mm256_xor_si256(_mm256_srli_epi64((x), 63), _mm256_add_epi64((x), (x)))
+
+#define ROTR_CONSTANTS                                                   \
+  const __m256i rotr24 = _mm256_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, \
+                                          13, 14, 15, 8, 9, 10, 3, 4, 5, \
+                                          6, 7, 0, 1, 2, 11, 12, 13, 14, \
+                                          15, 8, 9, 10);                 \
+  const __m256i rotr16 = _mm256_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, \
+                                          12, 13, 14, 15, 8, 9, 2, 3, 4, \
+                                          5, 6, 7, 0, 1, 10, 11, 12, 13, \
+                                          14, 15, 8, 9)
+
+// G Mixing function over vectors.
+
+#define B2B_G(a, b, c, d, x, y)                           \
+  {                                                       \
+    a = _mm256_add_epi64(_mm256_add_epi64(a, b), (x));    \
+    d = ROTR32(_mm256_xor_si256(d, a));                   \
+    c = _mm256_add_epi64(c, d);                           \
+    b = ROTR24(_mm256_xor_si256(b, c));                   \
+    a = _mm256_add_epi64(_mm256_add_epi64(a, b), (y));    \
+    d = ROTR16(_mm256_xor_si256(d, a));                   \
+    c = _mm256_add_epi64(c, d);                           \
+    b = ROTR63(_mm256_xor_si256(b, c));                   \
+  }
+
+static inline uint64_t load64(const uint8_t *p) {
+  uint64_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+B2B_AVX2 void blake2b_compress_avx2(uint64_t h[8],
+                                    const uint8_t block[128],
+                                    const uint64_t t[2],
+                                    int last) {
+  ROTR_CONSTANTS;
+  uint64_t m[16];
+  int i;
+
+  for (i = 0; i < 16; i++) {
+    m[i] = load64(&block[8 * i]);
+  }
+
+  __m256i a = _mm256_loadu_si256((const __m256i *)&h[0]);
+  __m256i b = _mm256_loadu_si256((const __m256i *)&h[4]);
+  __m256i c = _mm256_loadu_si256((const __m256i *)&blake2b_iv[0]);
+  __m256i d = _mm256_xor_si256(
+      _mm256_loadu_si256((const __m256i *)&blake2b_iv[4]),
+      _mm256_set_epi64x(0, last ? -1 : 0, (int64_t)t[1], (int64_t)t[0]));
+
+  for (i = 0; i < 12; i++) {
+    const uint8_t *s = blake2b_sigma[i];
+    // columns
+    B2B_G(a,
+          b,
+          c,
+          d,
+          _mm256_set_epi64x(m[s[6]], m[s[4]], m[s[2]], m[s[0]]),
+          _mm256_set_epi64x(m[s[7]], m[s[5]], m[s[3]], m[s[1]]));
+    // diagonals, rows b, c and d are rotated to put them under the columns
+    b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(0, 3, 2, 1));
+    c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));
+    d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(2, 1, 0, 3));
+    B2B_G(a,
+          b,
+          c,
+          d,
+          _mm256_set_epi64x(m[s[14]], m[s[12]], m[s[10]], m[s[8]]),
+          _mm256_set_epi64x(m[s[15]], m[s[13]], m[s[11]], m[s[9]]));
+    b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(2, 1, 0, 3));
+    c = _mm256_permute4x64_epi64(c, _MM_SHUFFLE(1, 0, 3, 2));
+    d = _mm256_permute4x64_epi64(d, _MM_SHUFFLE(0, 3, 2, 1));
+  }
+
+  a = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)&h[0]),
+                       _mm256_xor_si256(a, c));
+  b = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)&h[4]),
+                       _mm256_xor_si256(b, d));
+  _mm256_storeu_si256((__m256i *)&h[0], a);
+  _mm256_storeu_si256((__m256i *)&h[4], b);
+}
+
+// Compresses a block of each of 4 inputs. "active" lanes get the new state,
+// the state of the rest is kept.
+
+static B2B_AVX2 void blake2b_compress_x4(__m256i h[8],
+                                         const uint8_t *const block[4],
+                                         __m256i t,
+                                         __m256i last,
+                                         __m256i active) {
+  ROTR_CONSTANTS;
+  __m256i m[16];
+  __m256i v[16];
+  int i;
+
+  for (i = 0; i < 16; i++) {
+    m[i] = _mm256_set_epi64x((int64_t)load64(&block[3][8 * i]),
+                             (int64_t)load64(&block[2][8 * i]),
+                             (int64_t)load64(&block[1][8 * i]),
+                             (int64_t)load64(&block[0][8 * i]));
+  }
+  for (i = 0; i < 8; i++) {
+    v[i] = h[i];
+    v[i + 8] = _mm256_set1_epi64x((int64_t)blake2b_iv[i]);
+  }
+  // inputs are much shorter than 2^64 bytes, the high word of the counter
+  // stays zero
+  v[12] = _mm256_xor_si256(v[12], t);
+  v[14] = _mm256_xor_si256(v[14], last);
+
+  for (i = 0; i < 12; i++) {
+    const uint8_t *s = blake2b_sigma[i];
+    B2B_G(v[0], v[4], v[8], v[12], m[s[0]], m[s[1]]);
+    B2B_G(v[1], v[5], v[9], v[13], m[s[2]], m[s[3]]);
+    B2B_G(v[2], v[6], v[10], v[14], m[s[4]], m[s[5]]);
+    B2B_G(v[3], v[7], v[11], v[15], m[s[6]], m[s[7]]);
+    B2B_G(v[0], v[5], v[10], v[15], m[s[8]], m[s[9]]);
+    B2B_G(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+    B2B_G(v[2], v[7], v[8], v[13], m[s[12]], m[s[13]]);
+    B2B_G(v[3], v[4], v[9], v[14], m[s[14]], m[s[15]]);
+  }
+
+  for (i = 0; i < 8; i++) {
+    __m256i next = _mm256_xor_si256(h[i], _mm256_xor_si256(v[i], v[i + 8]));
+    h[i] = _mm256_blendv_epi8(h[i], next, active);
+  }
+}
+
+B2B_AVX2 void blake2b_x4_avx2(uint8_t *const out[4],
+                              size_t outlen,
+                              const uint8_t *const in[4],
+                              const size_t inlen[4]) {
+  static const uint8_t zero_block[128] = {0};
+  uint8_t last_blocks[4][128];
+  const uint8_t *block[4];
+  size_t blocks[4];
+  size_t max_blocks = 0;
+  __m256i h[8];
+  uint64_t state[8][4];
+  size_t i, j, lane;
+
+  for (lane = 0; lane < 4; lane++) {
+    // an empty input is hashed as one zero block
+    blocks[lane] = inlen[lane] == 0 ? 1 : (inlen[lane] + 127) / 128;
+    if (blocks[lane] > max_blocks) {
+      max_blocks = blocks[lane];
+    }
+    // the last block is padded with zeros
+    size_t tail = inlen[lane] - (blocks[lane] - 1) * 128;
+    memcpy(last_blocks[lane], in[lane] + (blocks[lane] - 1) * 128, tail);
+    memset(last_blocks[lane] + tail, 0, 128 - tail);
+  }
+
+  for (i = 0; i < 8; i++) {
+    h[i] = _mm256_set1_epi64x((int64_t)blake2b_iv[i]);
+  }
+  h[0] = _mm256_xor_si256(h[0], _mm256_set1_epi64x(0x01010000 ^ outlen));
+
+  for (j = 0; j < max_blocks; j++) {
+    int64_t t[4], last[4], active[4];
+    for (lane = 0; lane < 4; lane++) {
+      active[lane] = j < blocks[lane] ? -1 : 0;
+      last[lane] = j + 1 == blocks[lane] ? -1 : 0;
+      if (j + 1 < blocks[lane]) {
+        block[lane] = in[lane] + j * 128;
+        t[lane] = (int64_t)((j + 1) * 128);
+      } else if (j + 1 == blocks[lane]) {
+        block[lane] = last_blocks[lane];
+        t[lane] = (int64_t)inlen[lane];
+      } else {
+        block[lane] = zero_block;
+        t[lane] = 0;
+      }
+    }
+    blake2b_compress_x4(h,
+                        block,
+                        _mm256_set_epi64x(t[3], t[2], t[1], t[0]),
+                        _mm256_set_epi64x(last[3], last[2], last[1], last[0]),
+                        _mm256_set_epi64x(
+                            active[3], active[2], active[1], active[0]));
+  }
+
+  for (i = 0; i < 8; i++) {
+    _mm256_storeu_si256((__m256i *)state[i], h[i]);
+  }
+  for (lane = 0; lane < 4; lane++) {
+    for (i = 0; i < outlen; i++) {
+      out[lane][i] = (state[i >> 3][lane] >> (8 * (i & 7))) & 0xFF;
+    }
+  }
+}
+
+#endif
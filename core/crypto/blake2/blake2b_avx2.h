@@ -0,0 +1,34 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// AVX2 kernels of blake2b.c, which are called only after checking that the
+// CPU supports AVX2.
+
+#ifndef CORE_BLAKE2B_AVX2_H
+#define CORE_BLAKE2B_AVX2_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define BLAKE2B_AVX2
+
+// Compresses a block into the chained state "h", the same as
+// blake2b_compress_ref does. "t" is the input counter.
+void blake2b_compress_avx2(uint64_t h[8],
+                           const uint8_t block[128],
+                           const uint64_t t[2],
+                           int last);
+
+// Unkeyed hashes of 4 inputs at once, each one in its own 64-bit lane of
+// the vector registers.
+void blake2b_x4_avx2(uint8_t *const out[4],
+                     size_t outlen,
+                     const uint8_t *const in[4],
+                     const size_t inlen[4]);
+
+#endif
+
+#endif
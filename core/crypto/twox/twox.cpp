@@ -5,10 +5,252 @@
 
 #include "crypto/twox/twox.hpp"
 
+#include <cstring>
+
 #include <xxhash/xxhash.h>
 
+#if defined(__x86_64__) and (defined(__GNUC__) or defined(__clang__))
+#define KAGOME_TWOX_X86_SIMD
+#include <immintrin.h>
+#endif
+
 namespace kagome::crypto {
 
+  namespace {
+    // twox hashes of 128 and 256 bits are XXH64 hashes of the same data with
+    // the seeds 0..N-1. Instead of passing the data N times, each stripe of
+    // 32 bytes is read once and fed to the accumulators of all the seeds in
+    // vector registers. The product of an input word and kPrime2 does not
+    // depend on the seed, so it is calculated once per word as well
+
+    constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ull;
+    constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4Full;
+    constexpr uint64_t kPrime3 = 0x165667B19E3779F9ull;
+    constexpr uint64_t kPrime4 = 0x85EBCA77C2B2AE63ull;
+    constexpr uint64_t kPrime5 = 0x27D4EB2F165667C5ull;
+
+    constexpr size_t kStripeSize = 32;
+    constexpr size_t kMinKernelStripes = 4;
+
+    inline uint64_t rotl(uint64_t x, int r) {
+      return (x << r) | (x >> (64 - r));
+    }
+
+    inline uint64_t read64(const uint8_t *p) {
+      uint64_t v;
+      std::memcpy(&v, p, sizeof(v));
+      return v;
+    }
+
+    inline uint32_t read32(const uint8_t *p) {
+      uint32_t v;
+      std::memcpy(&v, p, sizeof(v));
+      return v;
+    }
+
+    inline uint64_t xxhRound(uint64_t acc, uint64_t input) {
+      acc += input * kPrime2;
+      return rotl(acc, 31) * kPrime1;
+    }
+
+    inline uint64_t mergeRound(uint64_t acc, uint64_t val) {
+      acc ^= xxhRound(0, val);
+      return acc * kPrime1 + kPrime4;
+    }
+
+    /**
+     * Accumulators of N seeds, lane-major: acc[lane][seed], so that the
+     * accumulators of one lane for all the seeds are adjacent
+     */
+    template <size_t N>
+    using Accumulators = uint64_t[4][N];
+
+    /**
+     * Consumes \arg stripes stripes of 32 bytes starting at \arg p.
+     * Without vector instructions the dependency chains of the seeds are
+     * better fed one after another, the data stays in the L1 cache
+     */
+    template <size_t N>
+    void consumeStripes(const uint8_t *p,
+                        size_t stripes,
+                        Accumulators<N> &acc) {
+      for (size_t seed = 0; seed < N; ++seed) {
+        auto v1 = acc[0][seed], v2 = acc[1][seed];
+        auto v3 = acc[2][seed], v4 = acc[3][seed];
+        const auto *stripe = p;
+        for (size_t i = 0; i < stripes; ++i, stripe += kStripeSize) {
+          v1 = xxhRound(v1, read64(stripe));
+          v2 = xxhRound(v2, read64(stripe + 8));
+          v3 = xxhRound(v3, read64(stripe + 16));
+          v4 = xxhRound(v4, read64(stripe + 24));
+        }
+        acc[0][seed] = v1, acc[1][seed] = v2;
+        acc[2][seed] = v3, acc[3][seed] = v4;
+      }
+    }
+
+#ifdef KAGOME_TWOX_X86_SIMD
+    /**
+     * Multiplies 64-bit lanes by a constant. AVX2 has no such instruction,
+     * so it is lo*lo + ((hi*lo + lo*hi) << 32)
+     */
+    __attribute__((target("avx2"))) inline __m256i mul64(__m256i a,
+                                                         uint64_t b) {
+      const auto b_lo = _mm256_set1_epi64x(b & 0xffffffffu);
+      const auto b_hi = _mm256_set1_epi64x(b >> 32u);
+      const auto lo = _mm256_mul_epu32(a, b_lo);
+      const auto cross =
+          _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b_lo),
+                           _mm256_mul_epu32(a, b_hi));
+      return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+    }
+
+    /// One round for the accumulators in \arg acc and inputs in \arg input
+    __attribute__((target("avx2"))) inline __m256i roundAvx2(__m256i acc,
+                                                             __m256i input) {
+      acc = _mm256_add_epi64(acc, input);
+      acc = _mm256_or_si256(_mm256_slli_epi64(acc, 31),
+                            _mm256_srli_epi64(acc, 33));
+      return mul64(acc, kPrime1);
+    }
+
+    /**
+     * AVX2 kernel for 2 seeds, a vector keeps two lanes of both of them,
+     * which is the lane-major order of the accumulators
+     */
+    __attribute__((target("avx2"))) void consumeStripesAvx2(
+        const uint8_t *p, size_t stripes, Accumulators<2> &acc) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      auto *vectors = reinterpret_cast<__m256i *>(acc);
+      auto v01 = _mm256_loadu_si256(vectors);
+      auto v23 = _mm256_loadu_si256(vectors + 1);
+      for (; stripes != 0; --stripes, p += kStripeSize) {
+        const auto in0 = static_cast<int64_t>(read64(p) * kPrime2);
+        const auto in1 = static_cast<int64_t>(read64(p + 8) * kPrime2);
+        const auto in2 = static_cast<int64_t>(read64(p + 16) * kPrime2);
+        const auto in3 = static_cast<int64_t>(read64(p + 24) * kPrime2);
+        v01 = roundAvx2(v01, _mm256_set_epi64x(in1, in1, in0, in0));
+        v23 = roundAvx2(v23, _mm256_set_epi64x(in3, in3, in2, in2));
+      }
+      _mm256_storeu_si256(vectors, v01);
+      _mm256_storeu_si256(vectors + 1, v23);
+    }
+
+    /// AVX2 kernel for 4 seeds, a vector keeps one lane of all of them
+    __attribute__((target("avx2"))) void consumeStripesAvx2(
+        const uint8_t *p, size_t stripes, Accumulators<4> &acc) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      auto *vectors = reinterpret_cast<__m256i *>(acc);
+      __m256i v[4];
+      for (size_t lane = 0; lane < 4; ++lane) {
+        v[lane] = _mm256_loadu_si256(vectors + lane);
+      }
+      for (; stripes != 0; --stripes, p += kStripeSize) {
+        for (size_t lane = 0; lane < 4; ++lane) {
+          const auto input =
+              static_cast<int64_t>(read64(p + lane * 8) * kPrime2);
+          v[lane] = roundAvx2(v[lane], _mm256_set1_epi64x(input));
+        }
+      }
+      for (size_t lane = 0; lane < 4; ++lane) {
+        _mm256_storeu_si256(vectors + lane, v[lane]);
+      }
+    }
+#endif
+
+    template <size_t N>
+    using StripesKernel = void (*)(const uint8_t *,
+                                   size_t,
+                                   Accumulators<N> &);
+
+    /// @return the fastest kernel for N seeds supported by the CPU
+    template <size_t N>
+    StripesKernel<N> selectKernel() {
+#ifdef KAGOME_TWOX_X86_SIMD
+      if (__builtin_cpu_supports("avx2")) {
+        return consumeStripesAvx2;
+      }
+#endif
+      return consumeStripes<N>;
+    }
+
+    /**
+     * Calculates XXH64 of the data with the seeds 0..N-1 in one pass
+     * @param out receives N hashes in the native byte order
+     */
+    template <size_t N>
+    void xxh64Seeds(const uint8_t *in, size_t len, uint8_t *out) {
+      static const auto kernel = selectKernel<N>();
+
+      uint64_t h[N];
+      const auto *p = in;
+      const auto *const end = in + len;
+      if (len >= kStripeSize) {
+        Accumulators<N> acc;
+        for (size_t seed = 0; seed < N; ++seed) {
+          acc[0][seed] = seed + kPrime1 + kPrime2;
+          acc[1][seed] = seed + kPrime2;
+          acc[2][seed] = seed;
+          acc[3][seed] = seed - kPrime1;
+        }
+        const auto stripes = len / kStripeSize;
+        // a few stripes don't pay off loading the accumulators to vectors
+        if (stripes < kMinKernelStripes) {
+          consumeStripes<N>(p, stripes, acc);
+        } else {
+          kernel(p, stripes, acc);
+        }
+        p += stripes * kStripeSize;
+
+        for (size_t seed = 0; seed < N; ++seed) {
+          auto h64 = rotl(acc[0][seed], 1) + rotl(acc[1][seed], 7)
+                     + rotl(acc[2][seed], 12) + rotl(acc[3][seed], 18);
+          for (size_t lane = 0; lane < 4; ++lane) {
+            h64 = mergeRound(h64, acc[lane][seed]);
+          }
+          h[seed] = h64;
+        }
+      } else {
+        for (size_t seed = 0; seed < N; ++seed) {
+          h[seed] = seed + kPrime5;
+        }
+      }
+
+      for (size_t seed = 0; seed < N; ++seed) {
+        h[seed] += len;
+      }
+      for (; p + 8 <= end; p += 8) {
+        const auto k1 = xxhRound(0, read64(p));
+        for (size_t seed = 0; seed < N; ++seed) {
+          h[seed] = rotl(h[seed] ^ k1, 27) * kPrime1 + kPrime4;
+        }
+      }
+      if (p + 4 <= end) {
+        const auto k1 = read32(p) * kPrime1;
+        for (size_t seed = 0; seed < N; ++seed) {
+          h[seed] = rotl(h[seed] ^ k1, 23) * kPrime2 + kPrime3;
+        }
+        p += 4;
+      }
+      for (; p < end; ++p) {
+        const auto k1 = *p * kPrime5;
+        for (size_t seed = 0; seed < N; ++seed) {
+          h[seed] = rotl(h[seed] ^ k1, 11) * kPrime1;
+        }
+      }
+
+      for (size_t seed = 0; seed < N; ++seed) {
+        auto h64 = h[seed];
+        h64 ^= h64 >> 33;
+        h64 *= kPrime2;
+        h64 ^= h64 >> 29;
+        h64 *= kPrime3;
+        h64 ^= h64 >> 32;
+        std::memcpy(out + seed * sizeof(h64), &h64, sizeof(h64));
+      }
+    }
+  }  // namespace
+
   void make_twox64(const uint8_t *in, uint32_t len, uint8_t *out) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
     auto *ptr = reinterpret_cast<uint64_t *>(out);
@@ -23,12 +265,7 @@ namespace kagome::crypto {
   }
 
   void make_twox128(const uint8_t *in, uint32_t len, uint8_t *out) {
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-    auto *ptr = reinterpret_cast<uint64_t *>(out);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    ptr[0] = XXH64(in, len, 0);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    ptr[1] = XXH64(in, len, 1);
+    xxh64Seeds<2>(in, len, out);
   }
 
   common::Hash128 make_twox128(gsl::span<const uint8_t> buf) {
@@ -38,16 +275,7 @@ namespace kagome::crypto {
   }
 
   void make_twox256(const uint8_t *in, uint32_t len, uint8_t *out) {
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-    auto *ptr = reinterpret_cast<uint64_t *>(out);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    ptr[0] = XXH64(in, len, 0);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    ptr[1] = XXH64(in, len, 1);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    ptr[2] = XXH64(in, len, 2);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    ptr[3] = XXH64(in, len, 3);
+    xxh64Seeds<4>(in, len, out);
   }
 
   common::Hash256 make_twox256(gsl::span<const uint8_t> buf) {
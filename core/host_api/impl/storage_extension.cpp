@@ -467,36 +467,16 @@ namespace kagome::host_api {
       throw std::runtime_error(pairs.error().message());
     }
 
-    auto &&pv = pairs.value();
-    storage::trie::PolkadotCodec codec;
-    if (pv.empty()) {
-      static const auto empty_root = common::Buffer{}.put(codec.hash256({0}));
-      auto res = memory_->storeBuffer(empty_root);
-      return runtime::WasmResult(res).address;
-    }
-    storage::trie::PolkadotTrieImpl trie;
-    for (auto &&p : pv) {
-      auto &&key = p.first;
-      auto &&value = p.second;
-      // already scale-encoded
-      auto put_res = trie.put(key, value);
-      if (not put_res) {
-        logger_->error(
-            "Insertion of value {} with key {} into the trie failed due to "
-            "error: {}",
-            value.toHex(),
-            key.toHex(),
-            put_res.error().message());
-      }
-    }
-    const auto &enc = codec.encodeNode(*trie.getRoot());
-    if (!enc) {
-      logger_->error("failed to encode trie root: {}", enc.error().message());
-      throw std::runtime_error(enc.error().message());
+    const auto &collection = pairs.value();
+    auto hash = storage::trie::calculateTrieHash(collection.begin(),
+                                                 collection.end());
+    if (!hash) {
+      logger_->error("failed to calculate trie root: {}",
+                     hash.error().message());
+      throw std::runtime_error(hash.error().message());
     }
-    const auto &hash = codec.hash256(enc.value());
 
-    auto res = memory_->storeBuffer(hash);
+    auto res = memory_->storeBuffer(hash.value());
     return runtime::WasmResult(res).address;
   }
 
@@ -54,6 +54,7 @@
 #include "consensus/babe/impl/babe_synchronizer_impl.hpp"
 #include "consensus/babe/impl/babe_util_impl.hpp"
 #include "consensus/babe/impl/block_executor.hpp"
+#include "consensus/babe/impl/post_state_cache_impl.hpp"
 #include "consensus/grandpa/impl/environment_impl.hpp"
 #include "consensus/grandpa/impl/grandpa_impl.hpp"
 #include "consensus/validation/babe_block_validator.hpp"
@@ -96,6 +97,8 @@
 #include "runtime/binaryen/runtime_api/parachain_host_impl.hpp"
 #include "runtime/binaryen/runtime_api/tagged_transaction_queue_impl.hpp"
 #include "runtime/binaryen/runtime_api/transaction_payment_api_impl.hpp"
+#include "runtime/common/runtime_profiler_impl.hpp"
+#include "runtime/common/runtime_properties_cache_impl.hpp"
 #include "runtime/common/storage_wasm_provider.hpp"
 #include "runtime/common/trie_storage_provider_impl.hpp"
 #include "storage/changes_trie/impl/storage_changes_tracker_impl.hpp"
@@ -108,6 +111,7 @@
 #include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
 #include "storage/trie/serialization/polkadot_codec.hpp"
 #include "storage/trie/serialization/trie_serializer_impl.hpp"
+#include "transaction_pool/impl/pool_maintainer.hpp"
 #include "transaction_pool/impl/pool_moderator_impl.hpp"
 #include "transaction_pool/impl/transaction_pool_impl.hpp"
 
@@ -556,6 +560,34 @@ namespace {
     return initialized.value();
   }
 
+  template <typename Injector>
+  sptr<runtime::RuntimeProfiler> get_runtime_profiler(
+      const Injector &injector) {
+    static auto initialized =
+        boost::optional<sptr<runtime::RuntimeProfiler>>(boost::none);
+    if (initialized) {
+      return initialized.value();
+    }
+
+    const application::AppConfiguration &config =
+        injector.template create<application::AppConfiguration const &>();
+
+    // profiled components skip measurements when there is no profiler
+    sptr<runtime::RuntimeProfiler> profiler;
+    if (config.isRuntimeProfilingEnabled()) {
+      profiler = std::make_shared<runtime::RuntimeProfilerImpl>();
+      auto app_state_manager =
+          injector.template create<sptr<application::AppStateManager>>();
+      app_state_manager->atShutdown([profiler] {
+        auto log = log::createLogger("RuntimeProfiler", "runtime");
+        log->info("Runtime calls profile:\n{}", profiler->dump());
+      });
+    }
+
+    initialized.emplace(std::move(profiler));
+    return initialized.value();
+  }
+
   template <typename Injector>
   sptr<api::ApiServiceImpl> get_jrpc_api_service(const Injector &injector) {
     static auto initialized =
@@ -732,6 +764,7 @@ namespace {
         injector.template create<sptr<crypto::Hasher>>(),
         injector.template create<sptr<authority::AuthorityUpdateObserver>>(),
         injector.template create<sptr<consensus::BabeUtil>>(),
+        injector.template create<sptr<consensus::PostStateCache>>(),
         injector.template create<sptr<boost::asio::io_context>>(),
         injector.template create<uptr<clock::Timer>>());
 
@@ -766,11 +799,15 @@ namespace {
                                Ts &&... args) {
     // default values for configurations
     api::RpcThreadPool::Configuration rpc_thread_pool_config{};
+    rpc_thread_pool_config.min_thread_number =
+        config.threadingConfig().rpc_threads;
     api::HttpSession::Configuration http_config{};
     api::WsSession::Configuration ws_config{};
+    ws_config.outbound = config.wsOutboundConfig();
     transaction_pool::PoolModeratorImpl::Params pool_moderator_config{};
     transaction_pool::TransactionPool::Limits tp_pool_limits{};
     libp2p::protocol::PingConfig ping_config{};
+    authorship::ProposerImpl::Configuration proposer_config{};
 
     return di::make_injector(
         // bind configs
@@ -780,6 +817,7 @@ namespace {
         useConfig(pool_moderator_config),
         useConfig(tp_pool_limits),
         useConfig(ping_config),
+        useConfig(proposer_config),
 
         // inherit host injector
         libp2p::injector::makeHostInjector(
@@ -991,6 +1029,10 @@ namespace {
         di::bind<runtime::TransactionPaymentApi>.template to<runtime::binaryen::TransactionPaymentApiImpl>(),
         di::bind<runtime::AccountNonceApi>.template to<runtime::binaryen::AccountNonceApiImpl>(),
         di::bind<runtime::TrieStorageProvider>.template to<runtime::TrieStorageProviderImpl>(),
+        di::bind<runtime::RuntimePropertiesCache>.template to<runtime::RuntimePropertiesCacheImpl>(),
+        di::bind<runtime::RuntimeProfiler>.to([](const auto &injector) {
+          return get_runtime_profiler(injector);
+        }),
         di::bind<transaction_pool::TransactionPool>.template to<transaction_pool::TransactionPoolImpl>(),
         di::bind<transaction_pool::PoolModerator>.template to<transaction_pool::PoolModeratorImpl>(),
         di::bind<storage::changes_trie::ChangesTracker>.template to<storage::changes_trie::StorageChangesTrackerImpl>(),
@@ -1049,6 +1091,7 @@ namespace {
         di::bind<consensus::grandpa::GrandpaObserver>.to(
             [](auto const &injector) { return get_grandpa_impl(injector); }),
         di::bind<consensus::BabeUtil>.template to<consensus::BabeUtilImpl>(),
+        di::bind<consensus::PostStateCache>.template to<consensus::PostStateCacheImpl>(),
 
         // user-defined overrides...
         std::forward<decltype(args)>(args)...);
@@ -1124,6 +1167,7 @@ namespace {
         injector.template create<sptr<storage::trie::TrieStorage>>(),
         injector.template create<sptr<primitives::BabeConfiguration>>(),
         injector.template create<sptr<authorship::Proposer>>(),
+        injector.template create<sptr<transaction_pool::TransactionPool>>(),
         injector.template create<sptr<blockchain::BlockTree>>(),
         injector.template create<sptr<network::Gossiper>>(),
         injector.template create<sptr<crypto::Sr25519Provider>>(),
@@ -1131,8 +1175,10 @@ namespace {
         injector.template create<sptr<clock::SystemClock>>(),
         injector.template create<sptr<crypto::Hasher>>(),
         injector.template create<uptr<clock::Ticker>>(),
+        injector.template create<uptr<clock::Timer>>(),
         injector.template create<sptr<authority::AuthorityUpdateObserver>>(),
-        injector.template create<sptr<consensus::BabeUtil>>());
+        injector.template create<sptr<consensus::BabeUtil>>(),
+        injector.template create<sptr<consensus::PostStateCache>>());
 
     auto protocol_factory =
         injector.template create<std::shared_ptr<network::ProtocolFactory>>();
@@ -1183,7 +1229,8 @@ namespace {
         injector.template create<sptr<clock::SteadyClock>>(),
         injector.template create<sptr<boost::asio::io_context>>(),
         injector.template create<sptr<authority::AuthorityManager>>(),
-        injector.template create<sptr<consensus::babe::Babe>>());
+        injector.template create<sptr<consensus::babe::Babe>>(),
+        injector.template create<const application::AppConfiguration &>());
 
     auto protocol_factory =
         injector.template create<std::shared_ptr<network::ProtocolFactory>>();
@@ -1279,6 +1326,12 @@ namespace kagome::injector {
     return pimpl_->injector_.create<sptr<network::SyncProtocolObserver>>();
   }
 
+  std::shared_ptr<transaction_pool::PoolMaintainer>
+  KagomeNodeInjector::injectPoolMaintainer() {
+    return pimpl_->injector_
+        .create<sptr<transaction_pool::PoolMaintainer>>();
+  }
+
   std::shared_ptr<consensus::babe::Babe> KagomeNodeInjector::injectBabe() {
     return pimpl_->injector_.create<sptr<consensus::babe::Babe>>();
   }
@@ -44,6 +44,10 @@ namespace kagome {
   namespace consensus::grandpa {
     class Grandpa;
   }
+
+  namespace transaction_pool {
+    class PoolMaintainer;
+  }
 }  // namespace kagome
 
 namespace kagome::injector {
@@ -66,6 +70,7 @@ namespace kagome::injector {
     std::shared_ptr<clock::SystemClock> injectSystemClock();
     std::shared_ptr<consensus::babe::Babe> injectBabe();
     std::shared_ptr<network::SyncProtocolObserver> injectSyncObserver();
+    std::shared_ptr<transaction_pool::PoolMaintainer> injectPoolMaintainer();
     std::shared_ptr<consensus::grandpa::Grandpa> injectGrandpa();
     std::shared_ptr<soralog::LoggingSystem> injectLoggingSystem();
 
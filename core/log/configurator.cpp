@@ -29,6 +29,7 @@ groups:
         children:
           - name: injector
           - name: application
+          - name: threads
           - name: rpc
             children:
             - name: rpc_transport
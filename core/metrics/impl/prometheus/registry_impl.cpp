@@ -78,4 +78,9 @@ namespace kagome::metrics {
     return registerMetric<Summary>(name, labels, q, max_age, age_buckets);
   }
 
+  void PrometheusRegistry::removeGaugeMetric(const std::string &name,
+                                             Gauge *metric) {
+    removeMetric<Gauge>(name, metric);
+  }
+
 }  // namespace kagome::metrics
@@ -12,6 +12,7 @@
 #include <tuple>
 #include <type_traits>
 
+#include <boost/assert.hpp>
 #include <prometheus/counter.h>
 #include <prometheus/family.h>
 #include <prometheus/gauge.h>
@@ -106,6 +107,17 @@ namespace kagome::metrics {
           typename MetricInfo<T>::dtype(var));
     }
 
+    template <typename T>
+    void removeMetric(const std::string &name, T *metric) {
+      auto impl = dynamic_cast<typename MetricInfo<T>::dtype *>(metric);
+      BOOST_ASSERT(impl);
+      dynamic_cast<prometheus::Family<typename MetricInfo<T>::type> &>(
+          family_.at(name).get())
+          .Remove(&impl->m_);
+      std::get<MetricInfo<T>::index>(metrics_).remove_if(
+          [impl](const auto &stored) { return &stored == impl; });
+    }
+
     static std::shared_ptr<prometheus::Registry> registry() {
       static auto registry = std::make_shared<prometheus::Registry>();
       return registry;
@@ -156,6 +168,8 @@ namespace kagome::metrics {
         int age_buckets,
         const std::map<std::string, std::string> &labels) override;
 
+    void removeGaugeMetric(const std::string &name, Gauge *metric) override;
+
     // it is used for test purposes
     template <typename T>
     static typename MetricInfo<T>::type *internalMetric(T *metric) {
@@ -104,6 +104,14 @@ namespace kagome::metrics {
         std::chrono::milliseconds max_age = std::chrono::seconds{60},
         int age_buckets = 5,
         const std::map<std::string, std::string> &labels = {}) = 0;
+
+    /**
+     * @brief removes gauge metrics object, so that it is no longer exposed
+     * @param name the name given at call `registerGaugeMetric`
+     * @param metric object returned by `registerGaugeMetric`, invalidated
+     */
+    virtual void removeGaugeMetric(const std::string &name,
+                                   Gauge *metric) = 0;
   };
 
 }  // namespace kagome::metrics
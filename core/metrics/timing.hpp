@@ -0,0 +1,31 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_METRICS_TIMING_HPP
+#define KAGOME_CORE_METRICS_TIMING_HPP
+
+#include <chrono>
+
+namespace kagome::metrics {
+
+  /**
+   * @return duration in seconds, which are the unit durations are observed
+   * by histograms in
+   */
+  template <typename Rep, typename Period>
+  double toSeconds(std::chrono::duration<Rep, Period> duration) {
+    return std::chrono::duration<double>(duration).count();
+  }
+
+  /**
+   * @return seconds passed by the steady clock since the given time point
+   */
+  inline double secondsSince(std::chrono::steady_clock::time_point start) {
+    return toSeconds(std::chrono::steady_clock::now() - start);
+  }
+
+}  // namespace kagome::metrics
+
+#endif  // KAGOME_CORE_METRICS_TIMING_HPP
@@ -36,8 +36,19 @@ namespace kagome::network {
   outcome::result<network::BlocksResponse>
   SyncProtocolObserverImpl::onBlocksRequest(
       const BlocksRequest &request) const {
-    if (!requested_ids_.emplace(request.id).second) {
-      return Error::DUPLICATE_REQUEST_ID;
+    OUTCOME_TRY(response, findRequestedBlocks(request));
+    fillBlocksResponse(request, response);
+    return response;
+  }
+
+  outcome::result<network::BlocksResponse>
+  SyncProtocolObserverImpl::findRequestedBlocks(
+      const BlocksRequest &request) const {
+    {
+      std::lock_guard lock(requested_ids_mutex_);
+      if (!requested_ids_.emplace(request.id).second) {
+        return Error::DUPLICATE_REQUEST_ID;
+      }
     }
 
     BlocksResponse response{request.id};
@@ -46,7 +57,7 @@ namespace kagome::network {
     auto from_hash_res = blocks_headers_->getHashById(request.from);
     if (!from_hash_res) {
       log_->warn("cannot find a requested block with id {}", request.from);
-      requested_ids_.erase(request.id);
+      releaseRequestId(request.id);
       return response;
     }
 
@@ -56,12 +67,15 @@ namespace kagome::network {
     if (!chain_hash_res) {
       log_->warn("cannot retrieve a chain of blocks: {}",
                  chain_hash_res.error().message());
-      requested_ids_.erase(request.id);
+      releaseRequestId(request.id);
       return response;
     }
 
-    // thirdly, fill the resulting response with data, which we were asked for
-    fillBlocksResponse(request, response, chain_hash_res.value());
+    // thirdly, list the found blocks; their data are read separately, as it
+    // does not need the tree
+    for (const auto &hash : chain_hash_res.value()) {
+      response.blocks.emplace_back(primitives::BlockData{hash});
+    }
     if (response.blocks.empty()) {
       SL_DEBUG(log_, "Return response: empty");
     } else if (response.blocks.size() == 1) {
@@ -76,10 +90,16 @@ namespace kagome::network {
                response.blocks.size());
     }
 
-    requested_ids_.erase(request.id);
+    releaseRequestId(request.id);
     return response;
   }
 
+  void SyncProtocolObserverImpl::releaseRequestId(
+      primitives::BlocksRequestId request_id) const {
+    std::lock_guard lock(requested_ids_mutex_);
+    requested_ids_.erase(request_id);
+  }
+
   blockchain::BlockTree::BlockHashVecRes
   SyncProtocolObserverImpl::retrieveRequestedHashes(
       const BlocksRequest &request,
@@ -114,9 +134,7 @@ namespace kagome::network {
   }
 
   void SyncProtocolObserverImpl::fillBlocksResponse(
-      const BlocksRequest &request,
-      BlocksResponse &response,
-      const std::vector<primitives::BlockHash> &hash_chain) const {
+      const BlocksRequest &request, BlocksResponse &response) const {
     auto header_needed =
         request.attributeIsSet(network::BlockAttributesBits::HEADER);
     auto body_needed =
@@ -124,9 +142,8 @@ namespace kagome::network {
     auto justification_needed =
         request.attributeIsSet(network::BlockAttributesBits::JUSTIFICATION);
 
-    for (const auto &hash : hash_chain) {
-      auto &new_block =
-          response.blocks.emplace_back(primitives::BlockData{hash});
+    for (auto &new_block : response.blocks) {
+      const auto &hash = new_block.hash;
 
       if (header_needed) {
         auto header_res = blocks_headers_->getBlockHeader(hash);
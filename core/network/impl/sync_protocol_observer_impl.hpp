@@ -8,6 +8,8 @@
 
 #include "network/sync_protocol_observer.hpp"
 
+#include <mutex>
+
 #include <libp2p/host/host.hpp>
 #include <libp2p/peer/peer_info.hpp>
 
@@ -34,18 +36,23 @@ namespace kagome::network {
     outcome::result<BlocksResponse> onBlocksRequest(
         const BlocksRequest &request) const override;
 
+    outcome::result<BlocksResponse> findRequestedBlocks(
+        const BlocksRequest &request) const override;
+
+    void fillBlocksResponse(const BlocksRequest &request,
+                            BlocksResponse &response) const override;
+
    private:
+    void releaseRequestId(primitives::BlocksRequestId request_id) const;
+
     blockchain::BlockTree::BlockHashVecRes retrieveRequestedHashes(
         const network::BlocksRequest &request,
         const primitives::BlockHash &from_hash) const;
 
-    void fillBlocksResponse(
-        const network::BlocksRequest &request,
-        network::BlocksResponse &response,
-        const std::vector<primitives::BlockHash> &hash_chain) const;
-
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<blockchain::BlockHeaderRepository> blocks_headers_;
+    // requests are served by several threads simultaneously
+    mutable std::mutex requested_ids_mutex_;
     mutable std::unordered_set<primitives::BlocksRequestId> requested_ids_;
     log::Logger log_;
   };
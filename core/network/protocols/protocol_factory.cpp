@@ -81,8 +81,10 @@ namespace kagome::network {
   }
 
   std::shared_ptr<SyncProtocol> ProtocolFactory::makeSyncProtocol() const {
+    SyncProtocol::Configuration config{};
+    config.thread_number = app_config_.threadingConfig().sync_requests_threads;
     return std::make_shared<SyncProtocol>(
-        host_, chain_spec_, sync_observer_.lock());
+        host_, chain_spec_, sync_observer_.lock(), io_context_, config);
   }
 
 }  // namespace kagome::network
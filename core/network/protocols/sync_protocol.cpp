@@ -5,6 +5,8 @@
 
 #include "network/protocols/sync_protocol.hpp"
 
+#include <boost/asio/post.hpp>
+
 #include "common/visitor.hpp"
 #include "network/adapters/protobuf_block_request.hpp"
 #include "network/adapters/protobuf_block_response.hpp"
@@ -14,20 +16,84 @@
 #include "network/rpc.hpp"
 #include "network/types/blocks_request.hpp"
 #include "network/types/blocks_response.hpp"
+#include "scale/scale.hpp"
+
+namespace {
+  constexpr const char *kBlockRequestsCounterName =
+      "kagome_sync_block_requests_total";
+  constexpr const char *kBlockRequestsInProgressGaugeName =
+      "kagome_sync_block_requests_in_progress";
+  constexpr const char *kResponseBytesCounterName =
+      "kagome_sync_block_response_bytes_total";
+
+  /**
+   * @return approximate size of the response on the wire, made of the sizes
+   * of the data of the blocks
+   */
+  size_t responseSize(const kagome::network::BlocksResponse &response) {
+    size_t size = 0;
+    for (const auto &block : response.blocks) {
+      size += block.hash.size();
+      if (block.header) {
+        size += kagome::scale::encode(*block.header).value().size();
+      }
+      if (block.body) {
+        for (const auto &extrinsic : *block.body) {
+          size += extrinsic.data.size();
+        }
+      }
+      if (block.justification) {
+        size += block.justification->data.size();
+      }
+    }
+    return size;
+  }
+}  // namespace
 
 namespace kagome::network {
 
   SyncProtocol::SyncProtocol(
       libp2p::Host &host,
       const application::ChainSpec &chain_spec,
-      std::shared_ptr<SyncProtocolObserver> sync_observer)
-      : host_(host), sync_observer_(std::move(sync_observer)) {
+      std::shared_ptr<SyncProtocolObserver> sync_observer,
+      std::shared_ptr<boost::asio::io_context> io_context,
+      const Configuration &configuration)
+      : host_(host),
+        sync_observer_(std::move(sync_observer)),
+        io_context_(std::move(io_context)),
+        config_(configuration),
+        requests_pool_("sync_requests", config_.thread_number) {
     BOOST_ASSERT(sync_observer_ != nullptr);
+    BOOST_ASSERT(io_context_ != nullptr);
     const_cast<Protocol &>(protocol_) =
         fmt::format(kSyncProtocol.data(), chain_spec.protocolId());
+
+    // initialize metrics
+    registry_->registerCounterFamily(kBlockRequestsCounterName,
+                                     "Incoming block requests by result");
+    requests_served_ = registry_->registerCounterMetric(
+        kBlockRequestsCounterName, {{"result", "served"}});
+    requests_failed_ = registry_->registerCounterMetric(
+        kBlockRequestsCounterName, {{"result", "failed"}});
+    requests_rejected_by_peer_limit_ = registry_->registerCounterMetric(
+        kBlockRequestsCounterName, {{"result", "rejected_peer_limit"}});
+    requests_rejected_by_queue_limit_ = registry_->registerCounterMetric(
+        kBlockRequestsCounterName, {{"result", "rejected_queue_limit"}});
+    requests_rejected_by_rate_limit_ = registry_->registerCounterMetric(
+        kBlockRequestsCounterName, {{"result", "rejected_rate_limit"}});
+    registry_->registerCounterFamily(kResponseBytesCounterName,
+                                     "Bytes of data of served blocks");
+    response_bytes_ =
+        registry_->registerCounterMetric(kResponseBytesCounterName);
+    registry_->registerGaugeFamily(
+        kBlockRequestsInProgressGaugeName,
+        "Incoming block requests being queued or served right now");
+    requests_in_progress_gauge_ =
+        registry_->registerGaugeMetric(kBlockRequestsInProgressGaugeName);
   }
 
   bool SyncProtocol::start() {
+    requests_pool_.start();
     host_.setProtocolHandler(protocol_, [wp = weak_from_this()](auto &&stream) {
       if (auto self = wp.lock()) {
         if (auto peer_id = stream->remotePeerId()) {
@@ -46,6 +112,7 @@ namespace kagome::network {
   }
 
   bool SyncProtocol::stop() {
+    requests_pool_.stop();
     return true;
   }
 
@@ -123,26 +190,158 @@ namespace kagome::network {
       }
       auto &block_request = block_request_res.value();
 
-      auto block_response_res =
-          self->sync_observer_->onBlocksRequest(block_request);
+      self->serveRequest(std::move(stream), std::move(block_request));
+    });
+  }
 
-      if (not block_response_res) {
-        SL_VERBOSE(
-            self->log_,
-            "Error at execute request from incoming {} stream with {}: {}",
-            self->protocol_,
-            stream->remotePeerId().value().toBase58(),
-            block_response_res.error().message());
+  void SyncProtocol::serveRequest(std::shared_ptr<Stream> stream,
+                                  BlocksRequest block_request) {
+    auto peer_id = stream->remotePeerId().value();
+
+    if (not accountRequest(peer_id)) {
+      SL_VERBOSE(log_,
+                 "Request from incoming {} stream with {} is rejected: "
+                 "the peer exceeds the rate of requests",
+                 protocol_,
+                 peer_id.toBase58());
+      requests_rejected_by_rate_limit_->inc();
+      stream->reset();
+      return;
+    }
 
-        stream->reset();
+    if (requests_pool_.queueSize() >= config_.max_queued_requests) {
+      SL_VERBOSE(log_,
+                 "Request from incoming {} stream with {} is rejected: "
+                 "queue of requests is full",
+                 protocol_,
+                 peer_id.toBase58());
+      requests_rejected_by_queue_limit_->inc();
+      stream->reset();
+      return;
+    }
+
+    if (not acquireRequestSlot(peer_id)) {
+      SL_VERBOSE(log_,
+                 "Request from incoming {} stream with {} is rejected: "
+                 "too many requests of the peer are in progress",
+                 protocol_,
+                 peer_id.toBase58());
+      requests_rejected_by_peer_limit_->inc();
+      stream->reset();
+      return;
+    }
+
+    // the block tree is changed by this thread, so the chain is found here,
+    // and only the blocks are read in the pool
+    auto block_response_res =
+        sync_observer_->findRequestedBlocks(block_request);
+    if (not block_response_res) {
+      SL_VERBOSE(log_,
+                 "Error at execute request from incoming {} stream with {}: {}",
+                 protocol_,
+                 peer_id.toBase58(),
+                 block_response_res.error().message());
+      releaseRequestSlot(peer_id);
+      requests_failed_->inc();
+      stream->reset();
+      return;
+    }
+
+    // the stream is touched and the slot is released in network thread only
+    requests_pool_.post([wp = weak_from_this(),
+                         io_context = io_context_,
+                         stream = std::move(stream),
+                         peer_id = std::move(peer_id),
+                         block_request = std::move(block_request),
+                         block_response =
+                             std::move(block_response_res.value())]() mutable {
+      auto self = wp.lock();
+      if (not self) {
+        boost::asio::post(*io_context,
+                          [stream = std::move(stream)] { stream->reset(); });
         return;
       }
-      auto &block_response = block_response_res.value();
 
-      self->writeResponse(std::move(stream), block_response);
+      self->sync_observer_->fillBlocksResponse(block_request, block_response);
+      auto bytes = responseSize(block_response);
+
+      boost::asio::post(
+          *io_context,
+          [wp = std::move(wp),
+           stream = std::move(stream),
+           peer_id = std::move(peer_id),
+           block_response = std::move(block_response),
+           bytes]() mutable {
+            auto self = wp.lock();
+            if (not self) {
+              stream->reset();
+              return;
+            }
+
+            self->releaseRequestSlot(peer_id);
+            self->accountResponse(peer_id, bytes);
+
+            self->requests_served_->inc();
+            self->writeResponse(std::move(stream), block_response);
+          });
     });
   }
 
+  bool SyncProtocol::acquireRequestSlot(const PeerId &peer_id) {
+    auto &in_progress = requests_in_progress_[peer_id];
+    if (in_progress >= config_.max_requests_per_peer) {
+      return false;
+    }
+    ++in_progress;
+    requests_in_progress_gauge_->inc();
+    return true;
+  }
+
+  void SyncProtocol::releaseRequestSlot(const PeerId &peer_id) {
+    auto it = requests_in_progress_.find(peer_id);
+    if (it == requests_in_progress_.end()) {
+      return;
+    }
+    requests_in_progress_gauge_->dec();
+    if (--it->second == 0) {
+      requests_in_progress_.erase(it);
+    }
+  }
+
+  bool SyncProtocol::accountRequest(const PeerId &peer_id) {
+    const auto now = std::chrono::steady_clock::now();
+
+    // rates of the peers which have not requested within the window are
+    // forgotten, so that the map does not grow with every peer ever seen
+    if (now - rates_swept_ >= config_.rate_window) {
+      for (auto it = request_rates_.begin(); it != request_rates_.end();) {
+        it = now - it->second.window_start >= config_.rate_window
+                 ? request_rates_.erase(it)
+                 : std::next(it);
+      }
+      rates_swept_ = now;
+    }
+
+    auto [it, inserted] = request_rates_.emplace(peer_id, RequestRate{now});
+    auto &rate = it->second;
+    if (not inserted and now - rate.window_start >= config_.rate_window) {
+      rate = RequestRate{now};
+    }
+    if (rate.requests >= config_.max_requests_per_window
+        or rate.bytes >= config_.max_response_bytes_per_window) {
+      return false;
+    }
+    ++rate.requests;
+    return true;
+  }
+
+  void SyncProtocol::accountResponse(const PeerId &peer_id, size_t bytes) {
+    response_bytes_->inc(bytes);
+    if (auto it = request_rates_.find(peer_id); it != request_rates_.end()) {
+      it->second.bytes += bytes;
+    }
+  }
+
   void SyncProtocol::writeResponse(std::shared_ptr<Stream> stream,
                                    const BlocksResponse &block_response) {
     auto read_writer = std::make_shared<ProtobufMessageReadWriter>(stream);
@@ -6,14 +6,20 @@
 #ifndef KAGOME_NETWORK_SYNCPROTOCOL
 #define KAGOME_NETWORK_SYNCPROTOCOL
 
+#include <chrono>
 #include <memory>
+#include <unordered_map>
+
 #include "network/protocol_base.hpp"
 
+#include <boost/asio/io_context.hpp>
 #include <libp2p/connection/stream.hpp>
 #include <libp2p/host/host.hpp>
 
 #include "application/chain_spec.hpp"
+#include "common/thread_pool.hpp"
 #include "log/logger.hpp"
+#include "metrics/metrics.hpp"
 #include "network/sync_protocol_observer.hpp"
 
 namespace kagome::network {
@@ -23,9 +29,33 @@ namespace kagome::network {
   using PeerId = libp2p::peer::PeerId;
   using PeerInfo = libp2p::peer::PeerInfo;
 
+  /**
+   * Serves incoming block requests and makes outgoing ones.
+   * The blocks of an incoming request are found in the network thread, as
+   * the block tree is changed by that thread only, and their data are read
+   * from DB by the dedicated bounded thread pool, so that it does not stall
+   * the network thread. Requests are rejected when a peer exceeds the limit
+   * of concurrently served requests or its rate of requests and of response
+   * bytes, or when the queue of the pool is full
+   */
   class SyncProtocol final : public ProtocolBase,
                              public std::enable_shared_from_this<SyncProtocol> {
    public:
+    struct Configuration {
+      /// amount of threads serving incoming block requests
+      size_t thread_number = 2;
+      /// max amount of requests of one peer being served simultaneously
+      size_t max_requests_per_peer = 2;
+      /// max amount of requests waiting to be served
+      size_t max_queued_requests = 64;
+      /// period the requests and response bytes of a peer are accounted over
+      std::chrono::seconds rate_window{10};
+      /// max amount of requests of one peer within the window
+      size_t max_requests_per_window = 64;
+      /// max amount of response bytes sent to one peer within the window
+      size_t max_response_bytes_per_window = 128 * 1024 * 1024;
+    };
+
     SyncProtocol() = delete;
     SyncProtocol(SyncProtocol &&) noexcept = delete;
     SyncProtocol(const SyncProtocol &) = delete;
@@ -35,7 +65,19 @@ namespace kagome::network {
 
     SyncProtocol(libp2p::Host &host,
                  const application::ChainSpec &chain_spec,
-                 std::shared_ptr<SyncProtocolObserver> sync_observer);
+                 std::shared_ptr<SyncProtocolObserver> sync_observer,
+                 std::shared_ptr<boost::asio::io_context> io_context,
+                 const Configuration &configuration);
+
+    SyncProtocol(libp2p::Host &host,
+                 const application::ChainSpec &chain_spec,
+                 std::shared_ptr<SyncProtocolObserver> sync_observer,
+                 std::shared_ptr<boost::asio::io_context> io_context)
+        : SyncProtocol(host,
+                       chain_spec,
+                       std::move(sync_observer),
+                       std::move(io_context),
+                       Configuration{}) {}
 
     const Protocol &protocol() const override {
       return protocol_;
@@ -69,9 +111,58 @@ namespace kagome::network {
                           &&response_handler);
 
    private:
+    /// Executes request in the pool and writes response from network thread
+    void serveRequest(std::shared_ptr<Stream> stream,
+                      BlocksRequest block_request);
+
+    /// @return false if the peer has reached the limit of served requests
+    bool acquireRequestSlot(const PeerId &peer_id);
+
+    void releaseRequestSlot(const PeerId &peer_id);
+
+    /**
+     * Accounts a request of the peer in the current window of its rate
+     * @return false if the peer has exceeded the limits of the window
+     */
+    bool accountRequest(const PeerId &peer_id);
+
+    /// Accounts bytes of a response in the current window of the peer rate
+    void accountResponse(const PeerId &peer_id, size_t bytes);
+
+    /// Requests and response bytes of a peer within the window
+    struct RequestRate {
+      std::chrono::steady_clock::time_point window_start;
+      size_t requests = 0;
+      size_t bytes = 0;
+    };
+
     libp2p::Host &host_;
     std::shared_ptr<SyncProtocolObserver> sync_observer_;
+    std::shared_ptr<boost::asio::io_context> io_context_;
+    const Configuration config_;
     const libp2p::peer::Protocol protocol_;
+
+    common::ThreadPool requests_pool_;
+
+    /// amount of requests in progress by peer; accessed from network thread
+    /// only
+    std::unordered_map<PeerId, size_t> requests_in_progress_;
+
+    /// rates of the peers; accessed from network thread only
+    std::unordered_map<PeerId, RequestRate> request_rates_;
+    /// when the rates of the peers were checked for expiration last time
+    std::chrono::steady_clock::time_point rates_swept_;
+
+    // metrics
+    metrics::RegistryPtr registry_ = metrics::createRegistry();
+    metrics::Counter *requests_served_;
+    metrics::Counter *requests_failed_;
+    metrics::Counter *requests_rejected_by_peer_limit_;
+    metrics::Counter *requests_rejected_by_queue_limit_;
+    metrics::Counter *requests_rejected_by_rate_limit_;
+    metrics::Counter *response_bytes_;
+    metrics::Gauge *requests_in_progress_gauge_;
+
     log::Logger log_ = log::createLogger("SyncProtocol", "protocols");
   };
 
@@ -19,12 +19,31 @@ namespace kagome::network {
     virtual ~SyncProtocolObserver() = default;
 
     /**
-     * Process a blocks request
+     * Process a blocks request, that is find the blocks and fill the response
+     * with their data
      * @param request to be processed
      * @return blocks request or error
      */
     virtual outcome::result<BlocksResponse> onBlocksRequest(
         const BlocksRequest &request) const = 0;
+
+    /**
+     * Find the blocks asked by a request. The block tree is read, so it is to
+     * be called from the thread which changes the tree
+     * @param request to be processed
+     * @return response with hashes of the blocks only, or error
+     */
+    virtual outcome::result<BlocksResponse> findRequestedBlocks(
+        const BlocksRequest &request) const = 0;
+
+    /**
+     * Read the data of the found blocks from the storage. The block tree is
+     * not read, so it may be called from any thread
+     * @param request the blocks are found for
+     * @param response made by findRequestedBlocks
+     */
+    virtual void fillBlocksResponse(const BlocksRequest &request,
+                                    BlocksResponse &response) const = 0;
   };
 }  // namespace kagome::network
 
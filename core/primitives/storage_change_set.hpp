@@ -0,0 +1,34 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_PRIMITIVES_STORAGE_CHANGE_SET_HPP
+#define KAGOME_CORE_PRIMITIVES_STORAGE_CHANGE_SET_HPP
+
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "common/buffer.hpp"
+#include "primitives/common.hpp"
+
+namespace kagome::primitives {
+
+  /**
+   * Values of storage entries at the given block, as reported by
+   * state_queryStorage and state_queryStorageAt
+   */
+  struct StorageChangeSet {
+    using Change = std::pair<common::Buffer, boost::optional<common::Buffer>>;
+
+    /// Block the values belong to
+    BlockHash block;
+
+    /// Keys and their values; none stands for a missing entry
+    std::vector<Change> changes;
+  };
+
+}  // namespace kagome::primitives
+
+#endif  // KAGOME_CORE_PRIMITIVES_STORAGE_CHANGE_SET_HPP
@@ -12,18 +12,24 @@ namespace kagome::runtime::binaryen {
 
   CoreFactoryImpl::CoreFactoryImpl(
       std::shared_ptr<storage::changes_trie::ChangesTracker> changes_tracker,
-      std::shared_ptr<blockchain::BlockHeaderRepository> header_repo)
+      std::shared_ptr<blockchain::BlockHeaderRepository> header_repo,
+      std::shared_ptr<RuntimePropertiesCache> cache)
       : changes_tracker_{std::move(changes_tracker)},
-        header_repo_{std::move(header_repo)} {
+        header_repo_{std::move(header_repo)},
+        cache_{std::move(cache)} {
     BOOST_ASSERT(changes_tracker_);
     BOOST_ASSERT(header_repo_);
+    BOOST_ASSERT(cache_);
   }
 
   std::unique_ptr<Core> CoreFactoryImpl::createWithCode(
       std::shared_ptr<RuntimeEnvironmentFactory> runtime_env_factory,
       std::shared_ptr<WasmProvider> wasm_provider) {
-    return std::make_unique<CoreImpl>(
-        runtime_env_factory, wasm_provider, changes_tracker_, header_repo_);
+    return std::make_unique<CoreImpl>(runtime_env_factory,
+                                      wasm_provider,
+                                      changes_tracker_,
+                                      header_repo_,
+                                      cache_);
   }
 
 }  // namespace kagome::runtime::binaryen
@@ -8,6 +8,7 @@
 
 #include "runtime/binaryen/core_factory.hpp"
 #include "runtime/binaryen/runtime_environment_factory_impl.hpp"
+#include "runtime/runtime_properties_cache.hpp"
 
 namespace kagome::blockchain {
   class BlockHeaderRepository;
@@ -22,7 +23,8 @@ namespace kagome::runtime::binaryen {
    public:
     CoreFactoryImpl(
         std::shared_ptr<storage::changes_trie::ChangesTracker> changes_tracker,
-        std::shared_ptr<blockchain::BlockHeaderRepository> header_repo);
+        std::shared_ptr<blockchain::BlockHeaderRepository> header_repo,
+        std::shared_ptr<RuntimePropertiesCache> cache);
     ~CoreFactoryImpl() override = default;
 
     std::unique_ptr<Core> createWithCode(
@@ -32,6 +34,7 @@ namespace kagome::runtime::binaryen {
    private:
     std::shared_ptr<storage::changes_trie::ChangesTracker> changes_tracker_;
     std::shared_ptr<blockchain::BlockHeaderRepository> header_repo_;
+    std::shared_ptr<RuntimePropertiesCache> cache_;
   };
 
 }  // namespace kagome::runtime::binaryen
@@ -18,32 +18,36 @@ namespace kagome::runtime::binaryen {
       const std::shared_ptr<RuntimeEnvironmentFactory> &runtime_env_factory,
       std::shared_ptr<WasmProvider> wasm_provider,
       std::shared_ptr<storage::changes_trie::ChangesTracker> changes_tracker,
-      std::shared_ptr<blockchain::BlockHeaderRepository> header_repo)
+      std::shared_ptr<blockchain::BlockHeaderRepository> header_repo,
+      std::shared_ptr<RuntimePropertiesCache> cache)
       : RuntimeApi(runtime_env_factory),
         wasm_provider_{std::move(wasm_provider)},
         changes_tracker_{std::move(changes_tracker)},
-        header_repo_{std::move(header_repo)} {
+        header_repo_{std::move(header_repo)},
+        cache_{std::move(cache)} {
     BOOST_ASSERT(wasm_provider_ != nullptr);
     BOOST_ASSERT(changes_tracker_ != nullptr);
     BOOST_ASSERT(header_repo_ != nullptr);
+    BOOST_ASSERT(cache_ != nullptr);
   }
 
   outcome::result<Version> CoreImpl::version(
       const boost::optional<primitives::BlockHash> &block_hash) {
+    CallConfig config{.persistency = CallPersistency::ISOLATED,
+                      .runtime_env_config = RuntimeEnvironmentFactory::Config{
+                          .wasm_provider = wasm_provider_}};
+    boost::optional<storage::trie::RootHash> state_root;
     if (block_hash) {
       OUTCOME_TRY(header, header_repo_->getBlockHeader(block_hash.value()));
-      return executeAt<Version>(
-          "Core_version",
-          header.state_root,
-          CallConfig{.persistency = CallPersistency::ISOLATED,
-                     .runtime_env_config = RuntimeEnvironmentFactory::Config{
-                         .wasm_provider = wasm_provider_}});
+      state_root = header.state_root;
     }
-    return execute<Version>(
-        "Core_version",
-        CallConfig{.persistency = CallPersistency::ISOLATED,
-                   .runtime_env_config = RuntimeEnvironmentFactory::Config{
-                       .wasm_provider = wasm_provider_}});
+    OUTCOME_TRY(code_hash, codeHash(state_root, config));
+    return cache_->getVersion(code_hash, [&]() -> outcome::result<Version> {
+      if (state_root) {
+        return executeAt<Version>("Core_version", state_root.value(), config);
+      }
+      return execute<Version>("Core_version", config);
+    });
   }
 
   outcome::result<void> CoreImpl::execute_block(
@@ -10,6 +10,7 @@
 #include "runtime/core.hpp"
 
 #include "blockchain/block_header_repository.hpp"
+#include "runtime/runtime_properties_cache.hpp"
 #include "storage/changes_trie/changes_tracker.hpp"
 
 namespace kagome::runtime::binaryen {
@@ -20,7 +21,8 @@ namespace kagome::runtime::binaryen {
         const std::shared_ptr<RuntimeEnvironmentFactory> &runtime_env_factory,
         std::shared_ptr<WasmProvider> wasm_provider,
         std::shared_ptr<storage::changes_trie::ChangesTracker> changes_tracker,
-        std::shared_ptr<blockchain::BlockHeaderRepository> header_repo);
+        std::shared_ptr<blockchain::BlockHeaderRepository> header_repo,
+        std::shared_ptr<RuntimePropertiesCache> cache);
 
     ~CoreImpl() override = default;
 
@@ -40,6 +42,7 @@ namespace kagome::runtime::binaryen {
     std::shared_ptr<WasmProvider> wasm_provider_;
     std::shared_ptr<storage::changes_trie::ChangesTracker> changes_tracker_;
     std::shared_ptr<blockchain::BlockHeaderRepository> header_repo_;
+    std::shared_ptr<RuntimePropertiesCache> cache_;
   };
 }  // namespace kagome::runtime::binaryen
 
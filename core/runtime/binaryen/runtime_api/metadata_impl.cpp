@@ -10,22 +10,31 @@ namespace kagome::runtime::binaryen {
 
   MetadataImpl::MetadataImpl(
       const std::shared_ptr<RuntimeEnvironmentFactory> &runtime_env_factory,
-      std::shared_ptr<blockchain::BlockHeaderRepository> header_repo)
-      : RuntimeApi(runtime_env_factory), header_repo_(std::move(header_repo)) {
+      std::shared_ptr<blockchain::BlockHeaderRepository> header_repo,
+      std::shared_ptr<RuntimePropertiesCache> cache)
+      : RuntimeApi(runtime_env_factory),
+        header_repo_(std::move(header_repo)),
+        cache_(std::move(cache)) {
     BOOST_ASSERT(header_repo_ != nullptr);
+    BOOST_ASSERT(cache_ != nullptr);
   }
 
   outcome::result<OpaqueMetadata> MetadataImpl::metadata(
       const boost::optional<primitives::BlockHash> &block_hash) {
+    CallConfig config{.persistency = CallPersistency::EPHEMERAL};
+    boost::optional<storage::trie::RootHash> state_root;
     if (block_hash) {
       OUTCOME_TRY(header, header_repo_->getBlockHeader(block_hash.value()));
-      return executeAt<OpaqueMetadata>(
-          "Metadata_metadata",
-          header.state_root,
-          CallConfig{.persistency = CallPersistency::EPHEMERAL});
+      state_root = header.state_root;
     }
-    return execute<OpaqueMetadata>(
-        "Metadata_metadata",
-        CallConfig{.persistency = CallPersistency::EPHEMERAL});
+    OUTCOME_TRY(code_hash, codeHash(state_root, config));
+    return cache_->getMetadata(
+        code_hash, [&]() -> outcome::result<OpaqueMetadata> {
+          if (state_root) {
+            return executeAt<OpaqueMetadata>(
+                "Metadata_metadata", state_root.value(), config);
+          }
+          return execute<OpaqueMetadata>("Metadata_metadata", config);
+        });
   }
 }  // namespace kagome::runtime::binaryen
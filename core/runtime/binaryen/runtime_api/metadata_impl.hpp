@@ -10,6 +10,7 @@
 #include "runtime/metadata.hpp"
 
 #include "blockchain/block_header_repository.hpp"
+#include "runtime/runtime_properties_cache.hpp"
 
 namespace kagome::runtime::binaryen {
 
@@ -17,7 +18,8 @@ namespace kagome::runtime::binaryen {
    public:
     explicit MetadataImpl(
         const std::shared_ptr<RuntimeEnvironmentFactory> &runtime_env_factory,
-        std::shared_ptr<blockchain::BlockHeaderRepository> header_repo);
+        std::shared_ptr<blockchain::BlockHeaderRepository> header_repo,
+        std::shared_ptr<RuntimePropertiesCache> cache);
 
     ~MetadataImpl() override = default;
 
@@ -26,6 +28,7 @@ namespace kagome::runtime::binaryen {
 
    private:
     std::shared_ptr<blockchain::BlockHeaderRepository> header_repo_;
+    std::shared_ptr<RuntimePropertiesCache> cache_;
   };
 }  // namespace kagome::runtime::binaryen
 
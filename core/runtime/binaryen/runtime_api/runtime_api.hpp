@@ -21,6 +21,7 @@
 #include "runtime/binaryen/wasm_executor.hpp"
 #include "runtime/wasm_memory.hpp"
 #include "runtime/wasm_provider.hpp"
+#include "runtime/runtime_profiler.hpp"
 #include "runtime/wasm_result.hpp"
 #include "scale/scale.hpp"
 
@@ -86,6 +87,17 @@ namespace kagome::runtime::binaryen {
     }
 
    protected:
+    /**
+     * @return hash of the runtime code the call with \arg config is executed
+     * with at \arg state_root, the latest state if none
+     */
+    outcome::result<common::Hash256> codeHash(
+        const boost::optional<storage::trie::RootHash> &state_root,
+        const CallConfig &config) {
+      return runtime_env_factory_->getCodeHash(state_root,
+                                               config.runtime_env_config);
+    }
+
     /**
      * @brief executes wasm export method returning non-void result
      * @tparam R result type including void
@@ -166,14 +178,31 @@ namespace kagome::runtime::binaryen {
 
       wasm::Name wasm_name = std::string(name);
 
+      auto profiler = runtime_env_factory_->profiler();
+      auto start = profiler != nullptr ? RuntimeProfiler::Clock::now()
+                                       : RuntimeProfiler::Clock::time_point{};
+
       OUTCOME_TRY(res, executor_.call(*module_instance, wasm_name, ll));
 
       if constexpr (!std::is_same_v<void, R>) {
         WasmResult r(res.geti64());
         auto buffer = memory->loadN(r.address, r.length);
+        if (profiler != nullptr) {
+          profiler->record(RuntimeProfiler::CallKind::ENTRY_POINT,
+                           name,
+                           RuntimeProfiler::Clock::now() - start,
+                           uint64_t{len} + r.length);
+        }
         return scale::decode<R>(std::move(buffer));
       }
 
+      if (profiler != nullptr) {
+        profiler->record(RuntimeProfiler::CallKind::ENTRY_POINT,
+                         name,
+                         RuntimeProfiler::Clock::now() - start,
+                         len);
+      }
+
       if (opt_batch) {
         OUTCOME_TRY(opt_batch.value()->writeBack());
       }
@@ -21,4 +21,17 @@ namespace kagome::runtime::binaryen {
         source,
         ext);
   }
+
+  outcome::result<primitives::TransactionValidity>
+  TaggedTransactionQueueImpl::validate_transaction(
+      const storage::trie::RootHash &state_root,
+      primitives::TransactionSource source,
+      const primitives::Extrinsic &ext) {
+    return executeAt<TransactionValidity>(
+        "TaggedTransactionQueue_validate_transaction",
+        state_root,
+        CallConfig{.persistency = CallPersistency::EPHEMERAL},
+        source,
+        ext);
+  }
 }  // namespace kagome::runtime::binaryen
@@ -22,6 +22,11 @@ namespace kagome::runtime::binaryen {
     outcome::result<primitives::TransactionValidity> validate_transaction(
         primitives::TransactionSource source,
         const primitives::Extrinsic &ext) override;
+
+    outcome::result<primitives::TransactionValidity> validate_transaction(
+        const storage::trie::RootHash &state_root,
+        primitives::TransactionSource source,
+        const primitives::Extrinsic &ext) override;
   };
 }  // namespace kagome::runtime::binaryen
 
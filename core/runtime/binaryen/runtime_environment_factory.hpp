@@ -12,6 +12,7 @@
 
 namespace kagome::runtime {
   class WasmProvider;
+  class RuntimeProfiler;
 }
 
 namespace kagome::runtime::binaryen {
@@ -53,6 +54,21 @@ namespace kagome::runtime::binaryen {
 
     virtual outcome::result<RuntimeEnvironment> makeEphemeralAt(
         const storage::trie::RootHash &state_root) = 0;
+
+    /**
+     * @param state_root state to take the runtime code from, the latest one
+     * if none
+     * @return hash of the runtime code which environments are made with
+     */
+    virtual outcome::result<common::Hash256> getCodeHash(
+        const boost::optional<storage::trie::RootHash> &state_root,
+        const Config &config) = 0;
+
+    /**
+     * @return profiler which calls of the environments made by the factory
+     * are reported to, nullptr if profiling is disabled
+     */
+    virtual std::shared_ptr<RuntimeProfiler> profiler() const = 0;
   };
 
 }  // namespace kagome::runtime::binaryen
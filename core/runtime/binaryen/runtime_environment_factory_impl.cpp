@@ -35,14 +35,16 @@ namespace kagome::runtime::binaryen {
       std::shared_ptr<WasmModuleFactory> module_factory,
       std::shared_ptr<WasmProvider> wasm_provider,
       std::shared_ptr<TrieStorageProvider> storage_provider,
-      std::shared_ptr<crypto::Hasher> hasher)
+      std::shared_ptr<crypto::Hasher> hasher,
+      std::shared_ptr<RuntimeProfiler> profiler)
       : core_factory_{std::move(core_factory)},
         memory_factory_{std::move(memory_factory)},
         storage_provider_{std::move(storage_provider)},
         wasm_provider_{std::move(wasm_provider)},
         host_api_factory_{std::move(host_api_factory)},
         module_factory_{std::move(module_factory)},
-        hasher_{std::move(hasher)} {
+        hasher_{std::move(hasher)},
+        profiler_{std::move(profiler)} {
     BOOST_ASSERT(core_factory_);
     BOOST_ASSERT(memory_factory_);
     BOOST_ASSERT(wasm_provider_);
@@ -114,6 +116,47 @@ namespace kagome::runtime::binaryen {
         wasm_provider_->getStateCodeAt(storage_provider_->getLatestRoot()));
   }
 
+  outcome::result<common::Hash256> RuntimeEnvironmentFactoryImpl::getCodeHash(
+      const boost::optional<storage::trie::RootHash> &state_root,
+      const Config &config) {
+    auto wasm_provider = config.wasm_provider.get_value_or(wasm_provider_);
+    const auto root = state_root.has_value()
+                          ? state_root.value()
+                          : storage_provider_->getLatestRoot();
+    // code of another provider is not determined by the state
+    const bool code_of_state = wasm_provider == wasm_provider_;
+    if (code_of_state) {
+      std::lock_guard lock(code_hashes_mutex_);
+      if (auto it = code_hashes_.find(root); it != code_hashes_.end()) {
+        return it->second;
+      }
+    }
+
+    const auto &state_code = wasm_provider->getStateCodeAt(root);
+    if (state_code.empty()) {
+      return Error::EMPTY_STATE_CODE;
+    }
+    // the same hash modules are cached by
+    auto code_hash = hasher_->twox_256(state_code);
+
+    if (code_of_state) {
+      std::lock_guard lock(code_hashes_mutex_);
+      if (code_hashes_.emplace(root, code_hash).second) {
+        code_hashes_order_.push_back(root);
+        if (code_hashes_order_.size() > kMaxCodeHashes) {
+          code_hashes_.erase(code_hashes_order_.front());
+          code_hashes_order_.pop_front();
+        }
+      }
+    }
+    return code_hash;
+  }
+
+  std::shared_ptr<RuntimeProfiler> RuntimeEnvironmentFactoryImpl::profiler()
+      const {
+    return profiler_;
+  }
+
   outcome::result<RuntimeEnvironment>
   RuntimeEnvironmentFactoryImpl::createRuntimeEnvironment(
       const common::Buffer &state_code) {
@@ -140,7 +183,8 @@ namespace kagome::runtime::binaryen {
                                                      shared_from_this(),
                                                      memory_factory_,
                                                      host_api_factory_,
-                                                     storage_provider_);
+                                                     storage_provider_,
+                                                     profiler_);
     }
 
     if (!module) {
@@ -167,7 +211,8 @@ namespace kagome::runtime::binaryen {
                                                    shared_from_this(),
                                                    memory_factory_,
                                                    host_api_factory_,
-                                                   storage_provider_);
+                                                   storage_provider_,
+                                                   profiler_);
 
     OUTCOME_TRY(module,
                 module_factory_->createModule(
@@ -8,6 +8,8 @@
 
 #include "runtime/binaryen/runtime_environment_factory.hpp"
 
+#include <deque>
+
 #include "common/blob.hpp"
 #include "crypto/hasher.hpp"
 #include "host_api/host_api_factory.hpp"
@@ -16,6 +18,7 @@
 #include "runtime/binaryen/module/wasm_module_factory.hpp"
 #include "runtime/binaryen/runtime_environment.hpp"
 #include "runtime/binaryen/runtime_external_interface.hpp"
+#include "runtime/runtime_profiler.hpp"
 #include "runtime/trie_storage_provider.hpp"
 #include "runtime/wasm_provider.hpp"
 #include "storage/trie/trie_batches.hpp"
@@ -36,6 +39,10 @@ namespace kagome::runtime::binaryen {
    public:
     enum class Error { EMPTY_STATE_CODE = 1, NO_PERSISTENT_BATCH = 2 };
 
+    /// Number of states which code hashes are kept, oldest ones are evicted
+    /// first
+    static constexpr size_t kMaxCodeHashes = 64;
+
     RuntimeEnvironmentFactoryImpl(
         std::shared_ptr<CoreFactory> core_factory,
         std::shared_ptr<BinaryenWasmMemoryFactory> memory_factory,
@@ -43,7 +50,8 @@ namespace kagome::runtime::binaryen {
         std::shared_ptr<WasmModuleFactory> module_factory,
         std::shared_ptr<WasmProvider> wasm_provider,
         std::shared_ptr<TrieStorageProvider> storage_provider,
-        std::shared_ptr<crypto::Hasher> hasher);
+        std::shared_ptr<crypto::Hasher> hasher,
+        std::shared_ptr<RuntimeProfiler> profiler);
 
     outcome::result<RuntimeEnvironment> makeIsolated(
         const Config &config) override;
@@ -66,6 +74,17 @@ namespace kagome::runtime::binaryen {
     outcome::result<RuntimeEnvironment> makeEphemeralAt(
         const storage::trie::RootHash &state_root) override;
 
+    /**
+     * Code hashes of the states taken from the storage are remembered by state
+     * root, so that the code is read and hashed once per state, and not on
+     * every lookup
+     */
+    outcome::result<common::Hash256> getCodeHash(
+        const boost::optional<storage::trie::RootHash> &state_root,
+        const Config &config) override;
+
+    std::shared_ptr<RuntimeProfiler> profiler() const override;
+
    private:
     outcome::result<RuntimeEnvironment> createRuntimeEnvironment(
         const common::Buffer &state_code);
@@ -83,10 +102,15 @@ namespace kagome::runtime::binaryen {
     std::shared_ptr<host_api::HostApiFactory> host_api_factory_;
     std::shared_ptr<WasmModuleFactory> module_factory_;
     std::shared_ptr<crypto::Hasher> hasher_;
+    std::shared_ptr<RuntimeProfiler> profiler_;
 
     std::mutex modules_mutex_;
     std::map<common::Hash256, std::shared_ptr<WasmModule>> modules_;
 
+    std::mutex code_hashes_mutex_;
+    std::map<storage::trie::RootHash, common::Hash256> code_hashes_;
+    std::deque<storage::trie::RootHash> code_hashes_order_;
+
     static thread_local std::shared_ptr<RuntimeExternalInterface>
         external_interface_;
   };
@@ -8,6 +8,8 @@
 
 #include <binaryen/shell-interface.h>
 
+#include <unordered_map>
+
 #include "log/logger.hpp"
 
 namespace kagome::host_api {
@@ -18,6 +20,7 @@ namespace kagome::host_api {
 namespace kagome::runtime {
   class TrieStorageProvider;
   class WasmMemory;
+  class RuntimeProfiler;
 
   namespace binaryen {
     class CoreFactory;
@@ -40,12 +43,15 @@ namespace kagome::runtime::binaryen {
 
   class RuntimeExternalInterface : public wasm::ShellExternalInterface {
    public:
+    struct HostFunction;
+
     RuntimeExternalInterface(
         std::shared_ptr<CoreFactory> core_factory,
         std::shared_ptr<RuntimeEnvironmentFactory> runtime_env_factory,
         std::shared_ptr<BinaryenWasmMemoryFactory> wasm_memory_factory,
         const std::shared_ptr<host_api::HostApiFactory> &host_api_factory,
-        std::shared_ptr<TrieStorageProvider> storage_provider);
+        std::shared_ptr<TrieStorageProvider> storage_provider,
+        std::shared_ptr<RuntimeProfiler> profiler = nullptr);
 
     wasm::Literal callImport(wasm::Function *import,
                              wasm::LiteralList &arguments) override;
@@ -55,6 +61,19 @@ namespace kagome::runtime::binaryen {
     void reset() const;
 
    private:
+    /**
+     * Calls the host function \arg import refers to. The function is looked
+     * up by name on the first call of the import only
+     */
+    wasm::Literal dispatchImport(wasm::Function *import,
+                                 wasm::LiteralList &arguments);
+
+    /**
+     * Finds the host function \arg import is bound to, terminates the program
+     * if there is none
+     */
+    const HostFunction &resolveImport(wasm::Function *import);
+
     /**
      * Checks that the number of arguments is as expected and terminates the
      * program if it is not
@@ -64,6 +83,18 @@ namespace kagome::runtime::binaryen {
                         size_t actual);
 
     std::unique_ptr<host_api::HostApi> host_api_;
+    struct ResolvedImport {
+      // names are interned, so checking that the import at the cached address
+      // is still the same is a pointer comparison
+      wasm::Name base;
+      const HostFunction *function = nullptr;
+    };
+    std::unordered_map<const wasm::Function *, ResolvedImport>
+        resolved_imports_;
+    // owned by host_api_, used to count bytes moved by profiled calls
+    WasmMemoryImpl *memory_;
+    // nullptr unless profiling is enabled
+    std::shared_ptr<RuntimeProfiler> profiler_;
     log::Logger logger_ = log::createLogger("RuntimeExternalInterface", "wasm");
   };
 
@@ -228,6 +228,7 @@ namespace kagome::runtime::binaryen {
   common::Buffer WasmMemoryImpl::loadN(kagome::runtime::WasmPointer addr,
                                        kagome::runtime::WasmSize n) const {
     BOOST_ASSERT(size_ > addr and size_ - addr >= n);
+    transferred_bytes_ += n;
     common::Buffer res;
     res.reserve(n);
     for (auto i = addr; i < addr + n; i++) {
@@ -239,6 +240,7 @@ namespace kagome::runtime::binaryen {
   std::string WasmMemoryImpl::loadStr(kagome::runtime::WasmPointer addr,
                                       kagome::runtime::WasmSize length) const {
     BOOST_ASSERT(size_ > addr and size_ - addr >= length);
+    transferred_bytes_ += length;
     std::string res;
     res.reserve(length);
     for (auto i = addr; i < addr + length; i++) {
@@ -272,6 +274,7 @@ namespace kagome::runtime::binaryen {
                                    gsl::span<const uint8_t> value) {
     const auto size = static_cast<size_t>(value.size());
     BOOST_ASSERT(offset_ > addr and offset_ - addr >= size);
+    transferred_bytes_ += size;
     for (size_t i = addr, j = 0; i < addr + size; i++, j++) {
       memory_->set(i, value[j]);
     }
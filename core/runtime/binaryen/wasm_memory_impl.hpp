@@ -104,6 +104,14 @@ namespace kagome::runtime::binaryen {
     size_t getAllocatedChunksNum() const;
     size_t getDeallocatedChunksNum() const;
 
+    /**
+     * @return number of bytes copied by loadN, loadStr and storeBuffer since
+     * the memory was created, allows to measure the traffic of a host call
+     */
+    uint64_t transferredBytes() const {
+      return transferred_bytes_;
+    }
+
    private:
     wasm::ShellExternalInterface::Memory *memory_;
     WasmSize size_;
@@ -122,6 +130,9 @@ namespace kagome::runtime::binaryen {
     // map containing addresses to the deallocated MemoryImpl chunks
     std::map<WasmPointer, WasmSize> deallocated_;
 
+    // counted by const load methods too
+    mutable uint64_t transferred_bytes_ = 0;
+
     template <typename T>
     static bool aligned(const char *address) {
       static_assert(!(sizeof(T) & (sizeof(T) - 1)), "must be a power of 2");
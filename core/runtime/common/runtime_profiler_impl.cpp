@@ -0,0 +1,134 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/common/runtime_profiler_impl.hpp"
+
+#include <algorithm>
+
+#include <fmt/format.h>
+
+#include "metrics/timing.hpp"
+
+namespace {
+  constexpr const char *kCallsCounterName = "kagome_runtime_calls_total";
+  constexpr const char *kSecondsCounterName =
+      "kagome_runtime_call_seconds_total";
+  constexpr const char *kBytesCounterName = "kagome_runtime_call_bytes_total";
+
+  const char *kindLabel(kagome::runtime::RuntimeProfiler::CallKind kind) {
+    using CallKind = kagome::runtime::RuntimeProfiler::CallKind;
+    switch (kind) {
+      case CallKind::HOST_FUNCTION:
+        return "host_function";
+      case CallKind::ENTRY_POINT:
+        return "entry_point";
+    }
+    return "unknown";
+  }
+}  // namespace
+
+namespace kagome::runtime {
+
+  RuntimeProfilerImpl::RuntimeProfilerImpl() {
+    registry_->registerCounterFamily(
+        kCallsCounterName, "Number of calls between the node and the runtime");
+    registry_->registerCounterFamily(
+        kSecondsCounterName,
+        "Time spent in calls between the node and the runtime");
+    registry_->registerCounterFamily(
+        kBytesCounterName,
+        "Bytes moved through the Wasm memory by calls between the node and "
+        "the runtime");
+  }
+
+  RuntimeProfilerImpl::Entry &RuntimeProfilerImpl::entry(
+      CallKind kind, std::string_view name) {
+    auto &entries =
+        kind == CallKind::HOST_FUNCTION ? host_functions_ : entry_points_;
+    if (auto it = entries.find(name); it != entries.end()) {
+      return it->second;
+    }
+    auto &entry = entries[std::string(name)];
+    std::map<std::string, std::string> labels{{"kind", kindLabel(kind)},
+                                              {"function", std::string(name)}};
+    entry.calls_counter =
+        registry_->registerCounterMetric(kCallsCounterName, labels);
+    entry.seconds_counter =
+        registry_->registerCounterMetric(kSecondsCounterName, labels);
+    entry.bytes_counter =
+        registry_->registerCounterMetric(kBytesCounterName, labels);
+    return entry;
+  }
+
+  void RuntimeProfilerImpl::record(CallKind kind,
+                                   std::string_view name,
+                                   Clock::duration time,
+                                   uint64_t bytes) {
+    std::lock_guard lock{mutex_};
+    auto &stats = entry(kind, name);
+    ++stats.calls;
+    stats.time += time;
+    stats.bytes += bytes;
+    stats.calls_counter->inc();
+    stats.seconds_counter->inc(metrics::toSeconds(time));
+    stats.bytes_counter->inc(bytes);
+  }
+
+  std::vector<RuntimeProfiler::CallStats> RuntimeProfilerImpl::stats(
+      CallKind kind) const {
+    std::vector<CallStats> result;
+    {
+      std::lock_guard lock{mutex_};
+      const auto &entries =
+          kind == CallKind::HOST_FUNCTION ? host_functions_ : entry_points_;
+      result.reserve(entries.size());
+      for (const auto &[name, entry] : entries) {
+        if (entry.calls != 0) {
+          result.push_back(
+              CallStats{name, entry.calls, entry.time, entry.bytes});
+        }
+      }
+    }
+    std::sort(result.begin(), result.end(), [](const auto &a, const auto &b) {
+      return a.time > b.time;
+    });
+    return result;
+  }
+
+  void RuntimeProfilerImpl::reset() {
+    std::lock_guard lock{mutex_};
+    // Prometheus counters are monotonic, so only the own statistics are reset
+    for (auto *entries : {&host_functions_, &entry_points_}) {
+      for (auto &[_, entry] : *entries) {
+        entry.calls = 0;
+        entry.time = {};
+        entry.bytes = 0;
+      }
+    }
+  }
+
+  std::string RuntimeProfilerImpl::dump() const {
+    std::string result;
+    for (auto kind : {CallKind::ENTRY_POINT, CallKind::HOST_FUNCTION}) {
+      result += fmt::format("{:<56} {:>10} {:>12} {:>10} {:>14}\n",
+                            kindLabel(kind),
+                            "calls",
+                            "seconds",
+                            "avg us",
+                            "bytes");
+      for (const auto &s : stats(kind)) {
+        auto seconds = metrics::toSeconds(s.time);
+        result += fmt::format("{:<56} {:>10} {:>12.6f} {:>10.3f} {:>14}\n",
+                              s.name,
+                              s.calls,
+                              seconds,
+                              seconds * 1e6 / s.calls,
+                              s.bytes);
+      }
+    }
+    return result;
+  }
+
+}  // namespace kagome::runtime
@@ -0,0 +1,63 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_RUNTIME_COMMON_RUNTIME_PROFILER_IMPL_HPP
+#define KAGOME_CORE_RUNTIME_COMMON_RUNTIME_PROFILER_IMPL_HPP
+
+#include "runtime/runtime_profiler.hpp"
+
+#include <map>
+#include <mutex>
+
+#include "metrics/metrics.hpp"
+
+namespace kagome::runtime {
+
+  /**
+   * Keeps the statistics in memory and mirrors them to Prometheus counters
+   * labelled with the kind and the name of the called function
+   */
+  class RuntimeProfilerImpl final : public RuntimeProfiler {
+   public:
+    RuntimeProfilerImpl();
+    ~RuntimeProfilerImpl() override = default;
+
+    void record(CallKind kind,
+                std::string_view name,
+                Clock::duration time,
+                uint64_t bytes) override;
+
+    std::vector<CallStats> stats(CallKind kind) const override;
+
+    void reset() override;
+
+    std::string dump() const override;
+
+   private:
+    struct Entry {
+      uint64_t calls = 0;
+      Clock::duration time{};
+      uint64_t bytes = 0;
+
+      metrics::Counter *calls_counter = nullptr;
+      metrics::Counter *seconds_counter = nullptr;
+      metrics::Counter *bytes_counter = nullptr;
+    };
+
+    // std::less<> allows to look up by string_view without allocations
+    using Entries = std::map<std::string, Entry, std::less<>>;
+
+    Entry &entry(CallKind kind, std::string_view name);
+
+    mutable std::mutex mutex_;
+    Entries host_functions_;
+    Entries entry_points_;
+
+    metrics::RegistryPtr registry_ = metrics::createRegistry();
+  };
+
+}  // namespace kagome::runtime
+
+#endif  // KAGOME_CORE_RUNTIME_COMMON_RUNTIME_PROFILER_IMPL_HPP
@@ -0,0 +1,53 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/common/runtime_properties_cache_impl.hpp"
+
+namespace kagome::runtime {
+
+  outcome::result<primitives::Version> RuntimePropertiesCacheImpl::getVersion(
+      const common::Hash256 &code_hash,
+      const std::function<outcome::result<primitives::Version>()>
+          &obtain_version) {
+    return get(versions_, code_hash, obtain_version);
+  }
+
+  outcome::result<primitives::OpaqueMetadata>
+  RuntimePropertiesCacheImpl::getMetadata(
+      const common::Hash256 &code_hash,
+      const std::function<outcome::result<primitives::OpaqueMetadata>()>
+          &obtain_metadata) {
+    return get(metadata_, code_hash, obtain_metadata);
+  }
+
+  template <typename T>
+  outcome::result<T> RuntimePropertiesCacheImpl::get(
+      Cache<T> &cache,
+      const common::Hash256 &code_hash,
+      const std::function<outcome::result<T>()> &obtain_value) {
+    {
+      std::lock_guard lock(mutex_);
+      auto it = cache.values.find(code_hash);
+      if (it != cache.values.end()) {
+        return it->second;
+      }
+    }
+
+    // runtime call is made without the lock; concurrent misses for the same
+    // code just obtain the same value twice
+    OUTCOME_TRY(value, obtain_value());
+
+    std::lock_guard lock(mutex_);
+    if (cache.values.emplace(code_hash, value).second) {
+      cache.order.push_back(code_hash);
+      if (cache.order.size() > kMaxCodes) {
+        cache.values.erase(cache.order.front());
+        cache.order.pop_front();
+      }
+    }
+    return std::move(value);
+  }
+
+}  // namespace kagome::runtime
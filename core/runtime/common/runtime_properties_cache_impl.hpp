@@ -0,0 +1,56 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_RUNTIME_COMMON_RUNTIME_PROPERTIES_CACHE_IMPL_HPP
+#define KAGOME_CORE_RUNTIME_COMMON_RUNTIME_PROPERTIES_CACHE_IMPL_HPP
+
+#include "runtime/runtime_properties_cache.hpp"
+
+#include <deque>
+#include <map>
+#include <mutex>
+
+namespace kagome::runtime {
+
+  class RuntimePropertiesCacheImpl final : public RuntimePropertiesCache {
+   public:
+    /// Number of runtime codes which properties are kept, oldest ones are
+    /// evicted first
+    static constexpr size_t kMaxCodes = 8;
+
+    RuntimePropertiesCacheImpl() = default;
+    ~RuntimePropertiesCacheImpl() override = default;
+
+    outcome::result<primitives::Version> getVersion(
+        const common::Hash256 &code_hash,
+        const std::function<outcome::result<primitives::Version>()>
+            &obtain_version) override;
+
+    outcome::result<primitives::OpaqueMetadata> getMetadata(
+        const common::Hash256 &code_hash,
+        const std::function<outcome::result<primitives::OpaqueMetadata>()>
+            &obtain_metadata) override;
+
+   private:
+    template <typename T>
+    struct Cache {
+      std::map<common::Hash256, T> values;
+      std::deque<common::Hash256> order;
+    };
+
+    template <typename T>
+    outcome::result<T> get(
+        Cache<T> &cache,
+        const common::Hash256 &code_hash,
+        const std::function<outcome::result<T>()> &obtain_value);
+
+    std::mutex mutex_;
+    Cache<primitives::Version> versions_;
+    Cache<primitives::OpaqueMetadata> metadata_;
+  };
+
+}  // namespace kagome::runtime
+
+#endif  // KAGOME_CORE_RUNTIME_COMMON_RUNTIME_PROPERTIES_CACHE_IMPL_HPP
@@ -0,0 +1,73 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_RUNTIME_RUNTIME_PROFILER_HPP
+#define KAGOME_CORE_RUNTIME_RUNTIME_PROFILER_HPP
+
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace kagome::runtime {
+
+  /**
+   * Collects statistics of calls crossing the boundary between the node and
+   * the Wasm runtime: host functions called by the runtime and entry points
+   * of the runtime called by the node.
+   * Profiling is optional, components which report calls keep a nullable
+   * pointer to the profiler and skip measurements when it is absent
+   */
+  class RuntimeProfiler {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class CallKind {
+      HOST_FUNCTION,  // ext_* function imported by the runtime
+      ENTRY_POINT     // function exported by the runtime, e.g. Core_version
+    };
+
+    struct CallStats {
+      std::string name;
+      uint64_t calls = 0;
+      Clock::duration time{};
+      /// bytes copied between the host and the Wasm memory
+      uint64_t bytes = 0;
+    };
+
+    virtual ~RuntimeProfiler() = default;
+
+    /**
+     * Accounts one finished call
+     * @param kind whether it is a host function or a runtime entry point
+     * @param name name of the called function
+     * @param time time spent in the call, including nested calls
+     * @param bytes number of bytes moved in or out of the Wasm memory
+     */
+    virtual void record(CallKind kind,
+                        std::string_view name,
+                        Clock::duration time,
+                        uint64_t bytes) = 0;
+
+    /**
+     * @return statistics of the functions of \arg kind collected since the
+     * start or the last reset, the most time consuming ones first
+     */
+    virtual std::vector<CallStats> stats(CallKind kind) const = 0;
+
+    /**
+     * Drops the collected statistics
+     */
+    virtual void reset() = 0;
+
+    /**
+     * @return human-readable table of the collected statistics
+     */
+    virtual std::string dump() const = 0;
+  };
+
+}  // namespace kagome::runtime
+
+#endif  // KAGOME_CORE_RUNTIME_RUNTIME_PROFILER_HPP
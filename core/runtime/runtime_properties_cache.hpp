@@ -0,0 +1,50 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_RUNTIME_RUNTIME_PROPERTIES_CACHE_HPP
+#define KAGOME_CORE_RUNTIME_RUNTIME_PROPERTIES_CACHE_HPP
+
+#include <functional>
+
+#include "common/blob.hpp"
+#include "outcome/outcome.hpp"
+#include "primitives/opaque_metadata.hpp"
+#include "primitives/version.hpp"
+
+namespace kagome::runtime {
+
+  /**
+   * Cache of the properties of runtime, which depend only on its code: the
+   * version and the metadata. Values are keyed by hash of the runtime code,
+   * so they are shared by all the blocks with the same code
+   */
+  class RuntimePropertiesCache {
+   public:
+    virtual ~RuntimePropertiesCache() = default;
+
+    /**
+     * @param code_hash hash of the runtime code
+     * @param obtain_version called to get the version unless it is cached
+     * @return version of the runtime with the given code
+     */
+    virtual outcome::result<primitives::Version> getVersion(
+        const common::Hash256 &code_hash,
+        const std::function<outcome::result<primitives::Version>()>
+            &obtain_version) = 0;
+
+    /**
+     * @param code_hash hash of the runtime code
+     * @param obtain_metadata called to get the metadata unless it is cached
+     * @return metadata of the runtime with the given code
+     */
+    virtual outcome::result<primitives::OpaqueMetadata> getMetadata(
+        const common::Hash256 &code_hash,
+        const std::function<outcome::result<primitives::OpaqueMetadata>()>
+            &obtain_metadata) = 0;
+  };
+
+}  // namespace kagome::runtime
+
+#endif  // KAGOME_CORE_RUNTIME_RUNTIME_PROPERTIES_CACHE_HPP
@@ -9,6 +9,7 @@
 #include "primitives/common.hpp"
 #include "primitives/extrinsic.hpp"
 #include "primitives/transaction_validity.hpp"
+#include "storage/trie/types.hpp"
 
 namespace kagome::runtime {
 
@@ -28,6 +29,18 @@ namespace kagome::runtime {
     virtual outcome::result<primitives::TransactionValidity>
     validate_transaction(primitives::TransactionSource source,
                         const primitives::Extrinsic &ext) = 0;
+
+    /**
+     * Calls the TaggedTransactionQueue_validate_transaction function from wasm
+     * code at the given state
+     * @param state_root root of the state transaction is validated at
+     * @param ext extrinsic containing transaction to be validated
+     * @return structure with information about transaction validity
+     */
+    virtual outcome::result<primitives::TransactionValidity>
+    validate_transaction(const storage::trie::RootHash &state_root,
+                         primitives::TransactionSource source,
+                         const primitives::Extrinsic &ext) = 0;
   };
 
 }  // namespace kagome::runtime
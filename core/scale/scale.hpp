@@ -31,7 +31,49 @@ namespace kagome::scale {
     } catch (std::system_error &e) {
       return outcome::failure(e.code());
     }
-    return s.data();
+    return std::move(s).data();
+  }
+
+  /**
+   * @brief calculates size of encoded data without encoding it
+   * @tparam Args primitive types to be encoded
+   * @param args data to encode
+   * @return number of bytes encoded data takes
+   */
+  template <typename... Args>
+  outcome::result<size_t> encodedSize(const Args &... args) {
+    ScaleEncoderStream s{true};
+    try {
+      (s << ... << args);
+    } catch (std::system_error &e) {
+      return outcome::failure(e.code());
+    }
+    return s.size();
+  }
+
+  /**
+   * @brief encodes data appending it to the provided buffer, which is
+   * extended exactly once
+   * @tparam Args primitive types to be encoded
+   * @param out buffer to append encoded data to, left intact on failure
+   * @param args data to encode
+   */
+  template <typename... Args>
+  outcome::result<void> encodeTo(std::vector<uint8_t> &out,
+                                 const Args &... args) {
+    OUTCOME_TRY(size, encodedSize(args...));
+    const auto initial_size = out.size();
+    ScaleEncoderStream s{std::move(out)};
+    s.reserve(size);
+    try {
+      (s << ... << args);
+    } catch (std::system_error &e) {
+      out = std::move(s).data();
+      out.resize(initial_size);
+      return outcome::failure(e.code());
+    }
+    out = std::move(s).data();
+    return outcome::success();
   }
 
   /**
@@ -117,10 +117,20 @@ namespace kagome::scale {
   }
 
   ScaleDecoderStream &ScaleDecoderStream::operator>>(std::string &v) {
-    std::vector<uint8_t> collection;
-    *this >> collection;
-    v.clear();
-    v.append(collection.begin(), collection.end());
+    gsl::span<const uint8_t> bytes;
+    *this >> bytes;
+    v.assign(bytes.begin(), bytes.end());
+    return *this;
+  }
+
+  ScaleDecoderStream &ScaleDecoderStream::operator>>(
+      gsl::span<const uint8_t> &v) {
+    CompactInteger size;
+    *this >> size;
+    if (size > span_.size()) {
+      common::raise(DecodeError::NOT_ENOUGH_DATA);
+    }
+    v = nextBytes(size.convert_to<size_t>());
     return *this;
   }
 
@@ -135,4 +145,14 @@ namespace kagome::scale {
     ++current_index_;
     return *current_iterator_++;
   }
+
+  gsl::span<const uint8_t> ScaleDecoderStream::nextBytes(size_t n) {
+    if (not hasMore(n)) {
+      common::raise(DecodeError::NOT_ENOUGH_DATA);
+    }
+    auto bytes = span_.subspan(current_index_, n);
+    current_index_ += n;
+    current_iterator_ += n;
+    return bytes;
+  }
 }  // namespace kagome::scale
@@ -7,7 +7,9 @@
 #define KAGOME_CORE_SCALE_SCALE_DECODER_STREAM_HPP
 
 #include <array>
+#include <cstring>
 
+#include <boost/endian/conversion.hpp>
 #include <boost/multiprecision/cpp_int.hpp>
 #include <boost/optional.hpp>
 #include <boost/variant.hpp>
@@ -118,15 +120,15 @@ namespace kagome::scale {
       // check bool
       if constexpr (std::is_same<I, bool>::value) {
         v = decodeBool();
-        return *this;
-      }
-      // check byte
-      if constexpr (sizeof(T) == 1u) {
+      } else if constexpr (sizeof(T) == 1u) {
+        // check byte
         v = nextByte();
-        return *this;
+      } else {
+        // decode any other integer
+        I le{};
+        std::memcpy(&le, nextBytes(sizeof(I)).data(), sizeof(I));
+        v = boost::endian::little_to_native(le);
       }
-      // decode any other integer
-      v = detail::decodeInteger<I>(*this);
       return *this;
     }
 
@@ -186,6 +188,20 @@ namespace kagome::scale {
 
       auto item_count = size.convert_to<size_type>();
 
+      // integers are copied at once, after making sure they are all there
+      if constexpr (is_bulk_copyable<mutableT>) {
+        if (item_count > span_.size()) {
+          common::raise(DecodeError::NOT_ENOUGH_DATA);
+        }
+        auto bytes = nextBytes(item_count * sizeof(mutableT));
+        std::vector<mutableT> vec(item_count);
+        if (item_count != 0) {
+          std::memcpy(vec.data(), bytes.data(), bytes.size());
+        }
+        v = std::move(vec);
+        return *this;
+      }
+
       std::vector<mutableT> vec;
       try {
         vec.resize(item_count);
@@ -201,6 +217,14 @@ namespace kagome::scale {
       return *this;
     }
 
+    /**
+     * @brief decodes byte sequence without copying it
+     * @param v span to point to the bytes of the sequence in the decoded
+     * data, which must outlive the span
+     * @return reference to stream
+     */
+    ScaleDecoderStream &operator>>(gsl::span<const uint8_t> &v);
+
     /**
      * @brief decodes array of items
      * @tparam T item type
@@ -211,6 +235,12 @@ namespace kagome::scale {
     template <class T, size_t size>
     ScaleDecoderStream &operator>>(std::array<T, size> &a) {
       using mutableT = std::remove_const_t<T>;
+      if constexpr (is_bulk_copyable<mutableT>) {
+        std::memcpy(const_cast<mutableT *>(a.data()),  // NOLINT
+                    nextBytes(size * sizeof(T)).data(),
+                    size * sizeof(T));
+        return *this;
+      }
       for (size_t i = 0u; i < size; ++i) {
         *this >> const_cast<mutableT &>(a[i]);  // NOLINT
       }
@@ -248,6 +278,13 @@ namespace kagome::scale {
      */
     uint8_t nextByte();
 
+    /**
+     * @brief takes n bytes from stream and advances current byte iterator
+     * by n
+     * @return view of the bytes in the decoded data
+     */
+    gsl::span<const uint8_t> nextBytes(size_t n);
+
     using ByteSpan = gsl::span<const uint8_t>;
     using SpanIterator = ByteSpan::const_iterator;
     using SizeType = ByteSpan::size_type;
@@ -260,6 +297,13 @@ namespace kagome::scale {
     }
 
    private:
+    /// Integers which in-memory representation matches their encoding
+    template <class T>
+    static constexpr bool is_bulk_copyable =
+        std::is_integral_v<T> and not std::is_same_v<T, bool>
+        and (sizeof(T) == 1
+             or boost::endian::order::native == boost::endian::order::little);
+
     bool decodeBool();
     /**
      * @brief special case of optional values as described in specification
@@ -100,24 +100,54 @@ namespace kagome::scale {
         v >>= 8;
       }
 
-      for (const uint8_t c : result) {
-        out << c;
-      }
+      out.write(result);
     }
   }  // namespace
 
-  ByteArray ScaleEncoderStream::data() const {
-    ByteArray buffer(stream_.size(), 0u);
-    for (auto &&[it, dest] = std::pair(stream_.begin(), buffer.begin());
-         it != stream_.end();
-         ++it, ++dest) {
-      *dest = *it;
+  ScaleEncoderStream::ScaleEncoderStream(bool drop_data)
+      : drop_data_{drop_data} {}
+
+  ScaleEncoderStream::ScaleEncoderStream(std::vector<uint8_t> buffer)
+      : stream_{std::move(buffer)} {}
+
+  ByteArray ScaleEncoderStream::data() const & {
+    return stream_;
+  }
+
+  ByteArray ScaleEncoderStream::data() && {
+    return std::move(stream_);
+  }
+
+  size_t ScaleEncoderStream::size() const {
+    return bytes_written_;
+  }
+
+  void ScaleEncoderStream::reserve(size_t bytes) {
+    if (not drop_data_) {
+      stream_.reserve(stream_.size() + bytes);
     }
-    return buffer;
   }
 
-  ScaleEncoderStream &ScaleEncoderStream::putByte(uint8_t v) {
-    stream_.push_back(v);
+  ScaleEncoderStream &ScaleEncoderStream::write(gsl::span<const uint8_t> v) {
+    if (not drop_data_) {
+      stream_.insert(stream_.end(), v.begin(), v.end());
+    }
+    bytes_written_ += v.size();
+    return *this;
+  }
+
+  ScaleEncoderStream &ScaleEncoderStream::encodeLength(size_t length) {
+    // lengths of all practical collections fit first three categories,
+    // which do not need to go through CompactInteger
+    if (length < compact::EncodingCategoryLimits::kMinUint16) {
+      encodeFirstCategory(static_cast<uint8_t>(length), *this);
+    } else if (length < compact::EncodingCategoryLimits::kMinUint32) {
+      encodeSecondCategory(static_cast<uint16_t>(length), *this);
+    } else if (length < compact::EncodingCategoryLimits::kMinBigInteger) {
+      encodeThirdCategory(static_cast<uint32_t>(length), *this);
+    } else {
+      encodeCompactInteger(CompactInteger{length}, *this);
+    }
     return *this;
   }
 
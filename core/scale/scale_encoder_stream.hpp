@@ -6,8 +6,10 @@
 #ifndef KAGOME_CORE_SCALE_SCALE_ENCODER_STREAM_HPP
 #define KAGOME_CORE_SCALE_SCALE_ENCODER_STREAM_HPP
 
-#include <deque>
+#include <cstring>
+#include <vector>
 
+#include <boost/endian/conversion.hpp>
 #include <boost/optional.hpp>
 #include <boost/variant.hpp>
 #include <gsl/span>
@@ -17,17 +19,48 @@
 namespace kagome::scale {
   /**
    * @class ScaleEncoderStream designed to scale-encode data to stream
+   * Data is written to a contiguous buffer, byte ranges and arrays of
+   * integers are copied at once. A stream constructed with drop_data set
+   * only counts bytes, which allows to learn size of encoded data and
+   * allocate the buffer once
    */
   class ScaleEncoderStream {
    public:
     // special tag to differentiate encoding streams from others
     static constexpr auto is_encoder_stream = true;
 
+    ScaleEncoderStream() = default;
+
+    /**
+     * @param drop_data if true, the stream only counts encoded bytes
+     */
+    explicit ScaleEncoderStream(bool drop_data);
+
+    /**
+     * @param buffer to append encoded data to, is returned by data() &&
+     */
+    explicit ScaleEncoderStream(std::vector<uint8_t> buffer);
+
     /// Getters
     /**
      * @return vector of bytes containing encoded data
      */
-    std::vector<uint8_t> data() const;
+    std::vector<uint8_t> data() const &;
+
+    /**
+     * @return buffer containing encoded data, without copying it
+     */
+    std::vector<uint8_t> data() &&;
+
+    /**
+     * @return number of bytes written to the stream
+     */
+    size_t size() const;
+
+    /**
+     * @brief reserves space for the given number of bytes to be written
+     */
+    void reserve(size_t bytes);
 
     /**
      * @brief scale-encodes pair of values
@@ -103,6 +136,10 @@ namespace kagome::scale {
      */
     template <class T>
     ScaleEncoderStream &operator<<(const std::vector<T> &c) {
+      if constexpr (is_bulk_copyable<T>) {
+        encodeLength(c.size());
+        return writeIntegers(c.data(), c.size());
+      }
       return encodeCollection(c.size(), c.begin(), c.end());
     }
 
@@ -144,9 +181,20 @@ namespace kagome::scale {
      */
     template <class T>
     ScaleEncoderStream &operator<<(const gsl::span<T> &v) {
+      if constexpr (is_bulk_copyable<std::remove_const_t<T>>) {
+        encodeLength(v.size());
+        return writeIntegers(v.data(), v.size());
+      }
       return encodeCollection(v.size(), v.begin(), v.end());
     }
 
+    /**
+     * @brief appends sequence of bytes as is, without length prefix
+     * @param v bytes sequence
+     * @return reference to stream
+     */
+    ScaleEncoderStream &write(gsl::span<const uint8_t> v);
+
     /**
      * @brief scale-encodes array of items
      * @tparam T item type
@@ -156,6 +204,9 @@ namespace kagome::scale {
      */
     template <typename T, size_t size>
     ScaleEncoderStream &operator<<(const std::array<T, size> &a) {
+      if constexpr (is_bulk_copyable<T>) {
+        return writeIntegers(a.data(), size);
+      }
       for (const auto &e : a) {
         *this << e;
       }
@@ -189,7 +240,8 @@ namespace kagome::scale {
      * @return reference to stream
      */
     ScaleEncoderStream &operator<<(std::string_view sv) {
-      return encodeCollection(sv.size(), sv.begin(), sv.end());
+      encodeLength(sv.size());
+      return writeIntegers(sv.data(), sv.size());
     }
 
     /**
@@ -206,15 +258,15 @@ namespace kagome::scale {
       if constexpr (std::is_same<I, bool>::value) {
         uint8_t byte = (v ? 1u : 0u);
         return putByte(byte);
-      }
-      // put byte
-      if constexpr (sizeof(T) == 1u) {
-        // to avoid infinite recursion
+      } else if constexpr (sizeof(T) == 1u) {
+        // put byte, to avoid infinite recursion
         return putByte(static_cast<uint8_t>(v));
+      } else {
+        // encode any other integer
+        auto le = boost::endian::native_to_little(static_cast<I>(v));
+        return write(gsl::make_span(reinterpret_cast<const uint8_t *>(&le),
+                                    sizeof(I)));
       }
-      // encode any other integer
-      detail::encodeInteger<I>(v, *this);
-      return *this;
     }
 
     /**
@@ -225,6 +277,22 @@ namespace kagome::scale {
     ScaleEncoderStream &operator<<(const CompactInteger &v);
 
    protected:
+    /// Integers which in-memory representation matches their encoding
+    template <class T>
+    static constexpr bool is_bulk_copyable =
+        std::is_integral_v<T> and not std::is_same_v<T, bool>
+        and (sizeof(T) == 1
+             or boost::endian::order::native == boost::endian::order::little);
+
+    /// compact-encodes length of collection
+    ScaleEncoderStream &encodeLength(size_t length);
+
+    template <class T>
+    ScaleEncoderStream &writeIntegers(const T *data, size_t count) {
+      return write(gsl::make_span(reinterpret_cast<const uint8_t *>(data),
+                                  count * sizeof(T)));
+    }
+
     template <size_t I, class... Ts>
     void encodeElementOfTuple(const std::tuple<Ts...> &v) {
       *this << std::get<I>(v);
@@ -271,11 +339,20 @@ namespace kagome::scale {
      * @param v byte value
      * @return reference to stream
      */
-    ScaleEncoderStream &putByte(uint8_t v);
+    ScaleEncoderStream &putByte(uint8_t v) {
+      if (not drop_data_) {
+        stream_.push_back(v);
+      }
+      ++bytes_written_;
+      return *this;
+    }
 
    private:
     ScaleEncoderStream &encodeOptionalBool(const boost::optional<bool> &v);
-    std::deque<uint8_t> stream_;
+
+    bool drop_data_ = false;
+    size_t bytes_written_ = 0;
+    std::vector<uint8_t> stream_;
   };
 
 }  // namespace kagome::scale
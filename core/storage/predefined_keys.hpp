@@ -20,6 +20,12 @@ namespace kagome::storage {
   inline const common::Buffer kLastFinalizedBlockHashLookupKey =
       common::Buffer().put(":kagome:last_finalized_block_hash");
 
+  inline const common::Buffer kCanonicalNumberIndexLookupKey =
+      common::Buffer().put(":kagome:canonical_number_index");
+
+  inline const common::Buffer kLastFinalizedEpochDigestsLookupKey =
+      common::Buffer().put(":kagome:last_finalized_epoch_digests");
+
   inline const common::Buffer kLastBabeEpochNumberLookupKey =
       common::Buffer().put(":kagome:last_babe_epoch_number");
 
@@ -6,6 +6,8 @@
 #ifndef KAGOME_TRIE_CODEC_HPP
 #define KAGOME_TRIE_CODEC_HPP
 
+#include <gsl/span>
+
 #include "common/blob.hpp"
 #include "common/buffer.hpp"
 #include "storage/trie/node.hpp"
@@ -30,11 +32,11 @@ namespace kagome::storage::trie {
 
     /**
      * @brief Decode node from bytes
-     * @param encoded_data a buffer containing encoded representation of a node
+     * @param encoded_data bytes containing encoded representation of a node
      * @return a node in the trie
      */
     virtual outcome::result<std::shared_ptr<Node>> decodeNode(
-        const common::Buffer &encoded_data) const = 0;
+        gsl::span<const uint8_t> encoded_data) const = 0;
 
     /**
      * @brief Get the merkle value of a node
@@ -43,6 +45,15 @@ namespace kagome::storage::trie {
      */
     virtual common::Buffer merkleValue(const common::Buffer &buf) const = 0;
 
+    /**
+     * @brief Get the merkle values of several nodes, which may be faster than
+     * getting them one by one
+     * @param bufs byte representations of the nodes
+     * @return merkle values of \param bufs in the same order
+     */
+    virtual std::vector<common::Buffer> merkleValues(
+        const std::vector<common::Buffer> &bufs) const = 0;
+
     /**
      * @brief Get the hash of a node
      * @param buf byte representation of the node
@@ -33,7 +33,9 @@ namespace kagome::storage::trie {
   }
 
   PolkadotTrieCursorImpl::PolkadotTrieCursorImpl(const PolkadotTrie &trie)
-      : trie_{trie}, current_{nullptr} {}
+      : trie_{trie}, current_{nullptr} {
+    last_visited_child_.reserve(kReservedPathLength);
+  }
 
   outcome::result<std::unique_ptr<PolkadotTrieCursorImpl>>
   PolkadotTrieCursorImpl::createAt(const common::Buffer &key,
@@ -117,6 +119,7 @@ namespace kagome::storage::trie {
       return outcome::success();
     }
     visited_root_ = true;
+    last_visited_child_.clear();
     auto nibbles = PolkadotCodec::keyToNibbles(key);
     gsl::span<const uint8_t> left_nibbles(nibbles);
     BOOST_ASSERT(left_nibbles.size() >= 0);
@@ -385,9 +388,11 @@ namespace kagome::storage::trie {
   }
 
   auto PolkadotTrieCursorImpl::constructLastVisitedChildPath(
-      const common::Buffer &key) -> outcome::result<std::list<TriePathEntry>> {
+      const common::Buffer &key)
+      -> outcome::result<std::vector<TriePathEntry>> {
     OUTCOME_TRY(path, trie_.getPath(trie_.getRoot(), codec_.keyToNibbles(key)));
-    std::list<TriePathEntry> last_visited_child;
+    std::vector<TriePathEntry> last_visited_child;
+    last_visited_child.reserve(std::max(path.size(), kReservedPathLength));
     for (auto &&[branch, idx] : path) {
       last_visited_child.emplace_back(branch, idx);
     }
@@ -8,6 +8,8 @@
 
 #include "storage/trie/polkadot_trie/polkadot_trie_cursor.hpp"
 
+#include <vector>
+
 #include "storage/trie/serialization/polkadot_codec.hpp"
 
 namespace kagome::storage::trie {
@@ -18,6 +20,10 @@ namespace kagome::storage::trie {
    public:
     using NodeType = PolkadotNode::Type;
 
+    /// Path length for which memory is reserved in advance; the path grows
+    /// by a branch per level of the trie
+    static constexpr size_t kReservedPathLength = 16;
+
     enum class Error {
       // operation cannot be performed for cursor position is not valid
       // due to an error, reaching the end or not calling next() after
@@ -89,11 +95,11 @@ namespace kagome::storage::trie {
         BranchPtr node, uint8_t min_idx) const;
 
     /**
-     * Constructs a list of branch nodes on the path from the root to the node
+     * Constructs the branch nodes on the path from the root to the node
      * with the given \arg key
      */
     auto constructLastVisitedChildPath(const common::Buffer &key)
-        -> outcome::result<std::list<TriePathEntry>>;
+        -> outcome::result<std::vector<TriePathEntry>>;
 
     common::Buffer collectKey() const;
 
@@ -101,7 +107,9 @@ namespace kagome::storage::trie {
     PolkadotCodec codec_;
     NodePtr current_;
     bool visited_root_ = false;
-    std::list<TriePathEntry> last_visited_child_;
+    // the path is only extended and shortened at its end, a vector keeps it
+    // in one allocation which is reused when the cursor moves or seeks
+    std::vector<TriePathEntry> last_visited_child_;
   };
 
 }  // namespace kagome::storage::trie
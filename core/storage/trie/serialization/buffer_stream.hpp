@@ -20,7 +20,7 @@ namespace kagome::storage::trie {
     using index_type = gsl::span<const uint8_t>::index_type;
 
    public:
-    explicit BufferStream(const common::Buffer &buf) : data_{buf.asVector()} {}
+    explicit BufferStream(gsl::span<const uint8_t> data) : data_{data} {}
 
     bool hasMore(index_type num_bytes) const {
       return data_.size() >= num_bytes;
@@ -32,6 +32,10 @@ namespace kagome::storage::trie {
       return byte;
     }
 
+    void skip(index_type num_bytes) {
+      data_ = data_.subspan(num_bytes);
+    }
+
     gsl::span<const uint8_t> leftBytes() const {
       return data_;
     }
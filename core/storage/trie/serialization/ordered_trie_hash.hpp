@@ -6,11 +6,12 @@
 #ifndef KAGOME_ORDERED_TRIE_HASH_HPP
 #define KAGOME_ORDERED_TRIE_HASH_HPP
 
+#include <algorithm>
+#include <numeric>
+
 #include "common/buffer.hpp"
-#include "crypto/hasher.hpp"
 #include "scale/scale.hpp"
-#include "storage/trie/polkadot_trie/polkadot_trie_impl.hpp"
-#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_root_builder.hpp"
 
 namespace kagome::storage::trie {
 
@@ -24,26 +25,57 @@ namespace kagome::storage::trie {
   template <typename It>
   outcome::result<common::Buffer> calculateOrderedTrieHash(const It &begin,
                                                            const It &end) {
-    PolkadotTrieImpl trie;
-    PolkadotCodec codec;
-    // empty root
-    if (begin == end) {
-      static const auto empty_root = common::Buffer{}.put(codec.hash256({0}));
-      return empty_root;
-    }
     // clang-format off
     static_assert(
         std::is_same_v<std::decay_t<decltype(*begin)>, common::Buffer>);
     // clang-format on
-    It it = begin;
-    scale::CompactInteger key = 0;
-    while (it != end) {
-      OUTCOME_TRY(enc, scale::encode(key++));
-      OUTCOME_TRY(trie.put(common::Buffer{enc}, *it));
-      it++;
+    // values are accessed in the order of their keys, so the ones made on
+    // the fly by the iterator are kept
+    std::vector<common::Buffer> copies;
+    std::vector<const common::Buffer *> values;
+    if constexpr (std::is_lvalue_reference_v<decltype(*begin)>) {
+      for (It it = begin; it != end; ++it) {
+        values.push_back(&*it);
+      }
+    } else {
+      copies.assign(begin, end);
+      for (const auto &value : copies) {
+        values.push_back(&value);
+      }
+    }
+
+    // the keys are written one after another, key_ends[i] is where the key
+    // of the i-th value ends
+    scale::ScaleEncoderStream keys;
+    std::vector<size_t> key_ends;
+    key_ends.reserve(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+      keys << scale::CompactInteger{i};
+      key_ends.push_back(keys.size());
     }
-    OUTCOME_TRY(enc, codec.encodeNode(*trie.getRoot()));
-    return common::Buffer{codec.hash256(enc)};
+    auto keys_data = std::move(keys).data();
+    auto key = [&](size_t i) {
+      auto key_begin = i == 0 ? 0 : key_ends[i - 1];
+      return gsl::make_span(keys_data).subspan(key_begin,
+                                               key_ends[i] - key_begin);
+    };
+
+    // compact encoding does not keep the order of indices, e.g. 0x04 of 1
+    // goes after 0x01 0x01 of 64
+    std::vector<size_t> order(values.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+      auto l = key(lhs), r = key(rhs);
+      return std::lexicographical_compare(
+          l.begin(), l.end(), r.begin(), r.end());
+    });
+
+    TrieRootBuilder builder;
+    for (auto i : order) {
+      OUTCOME_TRY(builder.push(key(i), *values[i]));
+    }
+    OUTCOME_TRY(root, builder.finish());
+    return common::Buffer{root};
   }
 
   template <typename ContainerType>
@@ -52,6 +84,37 @@ namespace kagome::storage::trie {
     return calculateOrderedTrieHash(container.begin(), container.end());
   }
 
+  /**
+   * Calculates the hash of a Merkle tree containing the key-value pairs from
+   * the provided range [begin; end). If a key repeats, the latest value is
+   * taken
+   * @tparam It an iterator type of a container of pairs of common::Buffers
+   * @return the Merkle tree root hash of the tree containing provided pairs
+   */
+  template <typename It>
+  outcome::result<common::Buffer> calculateTrieHash(const It &begin,
+                                                    const It &end) {
+    std::vector<It> pairs;
+    for (It it = begin; it != end; ++it) {
+      pairs.push_back(it);
+    }
+    std::stable_sort(
+        pairs.begin(), pairs.end(), [](const It &lhs, const It &rhs) {
+          return lhs->first < rhs->first;
+        });
+
+    TrieRootBuilder builder;
+    for (auto it = pairs.begin(); it != pairs.end(); ++it) {
+      auto next = std::next(it);
+      if (next != pairs.end() and (*next)->first == (*it)->first) {
+        continue;
+      }
+      OUTCOME_TRY(builder.push((*it)->first, (*it)->second));
+    }
+    OUTCOME_TRY(root, builder.finish());
+    return common::Buffer{root};
+  }
+
 }  // namespace kagome::storage::trie
 
 #endif  // KAGOME_ORDERED_TRIE_HASH_HPP
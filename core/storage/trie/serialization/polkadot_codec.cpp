@@ -87,6 +87,31 @@ namespace kagome::storage::trie {
     return Buffer{hash256(buf)};
   }
 
+  std::vector<common::Buffer> PolkadotCodec::merkleValues(
+      const std::vector<common::Buffer> &bufs) const {
+    std::vector<common::Buffer> values;
+    values.reserve(bufs.size());
+    std::vector<uint8_t *> outs;
+    std::vector<const uint8_t *> ins;
+    std::vector<size_t> sizes;
+    for (auto &buf : bufs) {
+      if (buf.size() < common::Hash256::size()) {
+        values.emplace_back(buf);
+        continue;
+      }
+      auto &value = values.emplace_back(common::Hash256::size(), 0);
+      outs.push_back(value.data());
+      ins.push_back(buf.data());
+      sizes.push_back(buf.size());
+    }
+    blake2b_many(outs.data(),
+                 common::Hash256::size(),
+                 ins.data(),
+                 sizes.data(),
+                 outs.size());
+    return values;
+  }
+
   common::Hash256 PolkadotCodec::hash256(const common::Buffer &buf) const {
     common::Hash256 out;
 
@@ -211,7 +236,7 @@ namespace kagome::storage::trie {
   }
 
   outcome::result<std::shared_ptr<Node>> PolkadotCodec::decodeNode(
-      const common::Buffer &encoded_data) const {
+      gsl::span<const uint8_t> encoded_data) const {
     BufferStream stream{encoded_data};
     // decode the header with the node type and the partial key length
     OUTCOME_TRY(header, decodeHeader(stream));
@@ -222,8 +247,14 @@ namespace kagome::storage::trie {
     // specification)
     switch (type) {
       case PolkadotNode::Type::Leaf: {
-        OUTCOME_TRY(value, scale::decode<Buffer>(stream.leftBytes()));
-        return std::make_shared<LeafNode>(partial_key, value);
+        scale::ScaleDecoderStream ss(stream.leftBytes());
+        gsl::span<const uint8_t> value;
+        try {
+          ss >> value;
+        } catch (std::system_error &e) {
+          return outcome::failure(e.code());
+        }
+        return std::make_shared<LeafNode>(partial_key, Buffer{value});
       }
       case PolkadotNode::Type::BranchEmptyValue:
       case PolkadotNode::Type::BranchWithValue: {
@@ -266,19 +297,19 @@ namespace kagome::storage::trie {
       size_t nibbles_num, BufferStream &stream) const {
     // length in bytes is length in nibbles over two round up
     auto byte_length = nibbles_num / 2 + nibbles_num % 2;
-    Buffer partial_key;
-    partial_key.reserve(byte_length);
-    while (byte_length-- != 0) {
-      if (not stream.hasMore(1)) {
-        return Error::INPUT_TOO_SMALL;
-      }
-      partial_key.putUint8(stream.next());
+    if (not stream.hasMore(byte_length)) {
+      return Error::INPUT_TOO_SMALL;
     }
+    auto partial_key = stream.leftBytes().first(byte_length);
+    stream.skip(byte_length);
     // array of nibbles is much more convenient than array of bytes, though it
     // wastes some memory
-    KeyNibbles partial_key_nibbles = keyToNibbles(partial_key);
-    if (nibbles_num % 2 == 1) {
-      partial_key_nibbles = partial_key_nibbles.subbuffer(1);
+    KeyNibbles partial_key_nibbles{Buffer(nibbles_num, 0)};
+    // the first nibble of a key of odd length is padding
+    const size_t padding = nibbles_num % 2;
+    for (size_t i = padding; i < byte_length * 2; ++i) {
+      const uint8_t byte = partial_key[i / 2];
+      partial_key_nibbles[i - padding] = i % 2 == 0 ? byte >> 4u : byte & 0xfu;
     }
     return partial_key_nibbles;
   }
@@ -300,14 +331,14 @@ namespace kagome::storage::trie {
     scale::ScaleDecoderStream ss(stream.leftBytes());
 
     // decode the branch value if needed
-    common::Buffer value;
     if (type == PolkadotNode::Type::BranchWithValue) {
+      gsl::span<const uint8_t> value;
       try {
         ss >> value;
       } catch (std::system_error &e) {
         return outcome::failure(e.code());
       }
-      node->value = value;
+      node->value = common::Buffer{value};
     }
 
     uint8_t i = 0;
@@ -318,13 +349,14 @@ namespace kagome::storage::trie {
         children_bitmap &= ~(1u << i);
         // read the hash of the child and make a dummy node from it for this
         // child in the processed branch
-        common::Buffer child_hash;
+        gsl::span<const uint8_t> child_hash;
         try {
           ss >> child_hash;
         } catch (std::system_error &e) {
           return outcome::failure(e.code());
         }
-        node->children.at(i) = std::make_shared<DummyNode>(child_hash);
+        node->children.at(i) =
+            std::make_shared<DummyNode>(common::Buffer{child_hash});
       }
       i++;
     }
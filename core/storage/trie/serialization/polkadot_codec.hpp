@@ -33,10 +33,17 @@ namespace kagome::storage::trie {
     outcome::result<Buffer> encodeNode(const Node &node) const override;
 
     outcome::result<std::shared_ptr<Node>> decodeNode(
-        const common::Buffer &encoded_data) const override;
+        gsl::span<const uint8_t> encoded_data) const override;
 
     common::Buffer merkleValue(const Buffer &buf) const override;
 
+    /**
+     * Hashes the nodes which are long enough for it at once, in parallel
+     * lanes of vector registers if the CPU supports it
+     */
+    std::vector<common::Buffer> merkleValues(
+        const std::vector<common::Buffer> &bufs) const override;
+
     common::Hash256 hash256(const Buffer &buf) const override;
 
     /**
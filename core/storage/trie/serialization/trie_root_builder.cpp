@@ -0,0 +1,170 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/serialization/trie_root_builder.hpp"
+
+#include <algorithm>
+
+#include "crypto/blake2/blake2b.h"
+#include "scale/scale_encoder_stream.hpp"
+#include "storage/trie/polkadot_trie/polkadot_node.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+
+OUTCOME_CPP_DEFINE_CATEGORY(kagome::storage::trie, TrieRootBuilder::Error, e) {
+  using E = kagome::storage::trie::TrieRootBuilder::Error;
+  switch (e) {
+    case E::UNSORTED_KEYS:
+      return "keys of a trie must be pushed in the ascending order";
+  }
+  return "unknown error";
+}
+
+namespace kagome::storage::trie {
+
+  namespace {
+    common::Hash256 hash256(gsl::span<const uint8_t> data) {
+      common::Hash256 out;
+      blake2b(out.data(),
+              common::Hash256::size(),
+              nullptr,
+              0,
+              data.data(),
+              data.size());
+      return out;
+    }
+  }  // namespace
+
+  outcome::result<void> TrieRootBuilder::push(gsl::span<const uint8_t> key,
+                                              gsl::span<const uint8_t> value) {
+    key_.clear();
+    for (auto byte : key) {
+      key_.push_back(byte >> 4u);
+      key_.push_back(byte & 0xfu);
+    }
+
+    if (open_frames_ != 0) {
+      auto [last_it, it] = std::mismatch(
+          last_key_.begin(), last_key_.end(), key_.begin(), key_.end());
+      // the key must not be a prefix of the last key or less than it
+      if (it == key_.end()
+          or (last_it != last_key_.end() and *last_it > *it)) {
+        return Error::UNSORTED_KEYS;
+      }
+      // the last key and all the nodes on the path to it that are deeper
+      // than the common prefix won't get more children
+      OUTCOME_TRY(closeFrames(last_it - last_key_.begin()));
+    }
+
+    auto &frame = openFrame(key_.size());
+    frame.has_value = true;
+    frame.value.assign(value.begin(), value.end());
+    last_key_.swap(key_);
+    return outcome::success();
+  }
+
+  outcome::result<common::Hash256> TrieRootBuilder::finish() {
+    if (open_frames_ == 0) {
+      static const auto empty_root = hash256(std::vector<uint8_t>{0});
+      return empty_root;
+    }
+    OUTCOME_TRY(closeFrames(frames_.front().depth));
+    OUTCOME_TRY(encodeNode(frames_.front(), 0));
+    open_frames_ = 0;
+    // the root is hashed regardless of the encoding size
+    return hash256(encoding_);
+  }
+
+  TrieRootBuilder::Frame &TrieRootBuilder::openFrame(size_t depth) {
+    if (open_frames_ == frames_.size()) {
+      frames_.emplace_back();
+    }
+    auto &frame = frames_[open_frames_++];
+    frame.depth = depth;
+    frame.has_value = false;
+    frame.value.clear();
+    frame.children_bitmap = 0;
+    frame.children.clear();
+    return frame;
+  }
+
+  outcome::result<void> TrieRootBuilder::closeFrames(size_t depth) {
+    while (open_frames_ != 0 and frames_[open_frames_ - 1].depth > depth) {
+      const auto &frame = frames_[--open_frames_];
+      auto parent_depth = depth;
+      if (open_frames_ != 0) {
+        parent_depth = std::max(depth, frames_[open_frames_ - 1].depth);
+      }
+      // the partial key starts after the index of the node in its parent
+      OUTCOME_TRY(encodeNode(frame, parent_depth + 1));
+
+      if (open_frames_ == 0 or frames_[open_frames_ - 1].depth < depth) {
+        // reuses the frame just closed, which is already encoded
+        openFrame(depth);
+      }
+      auto &parent = frames_[open_frames_ - 1];
+      parent.children_bitmap |= 1u << last_key_[parent_depth];
+      scale::ScaleEncoderStream s{std::move(parent.children)};
+      if (encoding_.size() < common::Hash256::size()) {
+        s << gsl::make_span(encoding_);
+      } else {
+        auto hash = hash256(encoding_);
+        s << gsl::make_span(hash);
+      }
+      parent.children = std::move(s).data();
+    }
+    return outcome::success();
+  }
+
+  outcome::result<void> TrieRootBuilder::encodeNode(const Frame &frame,
+                                                    size_t key_begin) {
+    using Type = PolkadotNode::Type;
+
+    auto nibbles = frame.depth - key_begin;
+    if (nibbles > 0xffffu) {
+      return PolkadotCodec::Error::TOO_MANY_NIBBLES;
+    }
+    auto type = Type::Leaf;
+    if (frame.children_bitmap != 0) {
+      type = frame.has_value ? Type::BranchWithValue : Type::BranchEmptyValue;
+    }
+
+    encoding_.clear();
+    scale::ScaleEncoderStream s{std::move(encoding_)};
+
+    // header, the same as PolkadotCodec::encodeHeader makes
+    uint8_t head = static_cast<uint8_t>(type) << 6u;
+    if (nibbles < 63u) {
+      s << static_cast<uint8_t>(head | nibbles);
+    } else {
+      s << static_cast<uint8_t>(head | 63u);
+      for (nibbles -= 63u; nibbles >= 0xffu; nibbles -= 0xffu) {
+        s << uint8_t{0xff};
+      }
+      s << static_cast<uint8_t>(nibbles);
+    }
+
+    // partial key, an odd nibble goes to a byte of its own
+    auto nibble = last_key_.begin() + key_begin;
+    auto key_end = last_key_.begin() + frame.depth;
+    if ((key_end - nibble) % 2 != 0) {
+      s << *nibble++;
+    }
+    for (; nibble != key_end; nibble += 2) {
+      s << static_cast<uint8_t>((*nibble << 4u) | *(nibble + 1));
+    }
+
+    if (type != Type::Leaf) {
+      s << frame.children_bitmap;
+    }
+    if (frame.has_value) {
+      s << gsl::make_span(frame.value);
+    }
+    s.write(frame.children);
+
+    encoding_ = std::move(s).data();
+    return outcome::success();
+  }
+
+}  // namespace kagome::storage::trie
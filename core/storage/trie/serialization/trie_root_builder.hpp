@@ -0,0 +1,92 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_STORAGE_TRIE_TRIE_ROOT_BUILDER_HPP
+#define KAGOME_STORAGE_TRIE_TRIE_ROOT_BUILDER_HPP
+
+#include <vector>
+
+#include <gsl/span>
+
+#include "common/blob.hpp"
+#include "outcome/outcome.hpp"
+
+namespace kagome::storage::trie {
+
+  /**
+   * Calculates the root hash of a trie from its key-value pairs, which are
+   * pushed in the ascending order of keys. A node is encoded and hashed as
+   * soon as no more keys can get under it, so only the nodes on the path to
+   * the last pushed key are kept in memory and no trie is built.
+   * The root is the same as the one of a PolkadotTrieImpl filled with these
+   * pairs and encoded by PolkadotCodec
+   */
+  class TrieRootBuilder {
+   public:
+    enum class Error {
+      UNSORTED_KEYS = 1,  ///< key is not greater than the previous one
+    };
+
+    /**
+     * Adds a key-value pair to the trie
+     * @param key must be greater than the keys pushed before
+     * @param value is copied, so may be released after the call
+     */
+    outcome::result<void> push(gsl::span<const uint8_t> key,
+                               gsl::span<const uint8_t> value);
+
+    /**
+     * Encodes the rest of the nodes and makes the builder ready for a new
+     * trie
+     * @return root hash of the pushed pairs, which is the hash of an empty
+     * trie if there were none
+     */
+    outcome::result<common::Hash256> finish();
+
+   private:
+    /**
+     * Node on the path to the last pushed key, to which children may still
+     * be added. Frames are reused for the following nodes to keep the
+     * allocated memory
+     */
+    struct Frame {
+      /// number of nibbles in the path from the root to the end of the node
+      size_t depth = 0;
+      bool has_value = false;
+      std::vector<uint8_t> value;
+      uint16_t children_bitmap = 0;
+      /// scale-encoded merkle values of the children added so far
+      std::vector<uint8_t> children;
+    };
+
+    Frame &openFrame(size_t depth);
+
+    /**
+     * Encodes the open nodes deeper than \arg depth and adds them to their
+     * parents, opening a branch at \arg depth if they have no parent yet
+     */
+    outcome::result<void> closeFrames(size_t depth);
+
+    /**
+     * Puts the encoding of \arg frame to encoding_
+     * @param key_begin index of the first nibble of the node partial key in
+     * last_key_
+     */
+    outcome::result<void> encodeNode(const Frame &frame, size_t key_begin);
+
+    std::vector<Frame> frames_;
+    size_t open_frames_ = 0;
+    /// nibbles of the last pushed key
+    std::vector<uint8_t> last_key_;
+    /// nibbles of the key being pushed
+    std::vector<uint8_t> key_;
+    std::vector<uint8_t> encoding_;
+  };
+
+}  // namespace kagome::storage::trie
+
+OUTCOME_HPP_DECLARE_ERROR(kagome::storage::trie, TrieRootBuilder::Error);
+
+#endif  // KAGOME_STORAGE_TRIE_TRIE_ROOT_BUILDER_HPP
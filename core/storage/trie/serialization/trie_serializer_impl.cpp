@@ -52,18 +52,7 @@ namespace kagome::storage::trie {
   outcome::result<RootHash> TrieSerializerImpl::storeRootNode(
       PolkadotNode &node) {
     auto batch = backend_->batch();
-    using T = PolkadotNode::Type;
-
-    // if node is a branch node, its children must be stored to the storage
-    // before it, as their hashes, which are used as database keys, are a part
-    // of its encoded representation required to save it to the storage
-    if (node.getTrieType() == T::BranchEmptyValue
-        || node.getTrieType() == T::BranchWithValue) {
-      auto &branch = dynamic_cast<BranchNode &>(node);
-      OUTCOME_TRY(storeChildren(branch, *batch));
-    }
-
-    OUTCOME_TRY(enc, codec_->encodeNode(node));
+    OUTCOME_TRY(enc, encodeWithChildren(node, *batch));
     auto key = codec_->hash256(enc);
     OUTCOME_TRY(batch->put(Buffer{key}, enc));
     OUTCOME_TRY(batch->commit());
@@ -71,7 +60,7 @@ namespace kagome::storage::trie {
     return key;
   }
 
-  outcome::result<common::Buffer> TrieSerializerImpl::storeNode(
+  outcome::result<common::Buffer> TrieSerializerImpl::encodeWithChildren(
       PolkadotNode &node, BufferBatch &batch) {
     using T = PolkadotNode::Type;
 
@@ -83,22 +72,28 @@ namespace kagome::storage::trie {
       auto &branch = dynamic_cast<BranchNode &>(node);
       OUTCOME_TRY(storeChildren(branch, batch));
     }
-    OUTCOME_TRY(enc, codec_->encodeNode(node));
-    auto key = Buffer{codec_->merkleValue(enc)};
-    OUTCOME_TRY(batch.put(key, enc));
-    return key;
+    return codec_->encodeNode(node);
   }
 
   outcome::result<void> TrieSerializerImpl::storeChildren(BranchNode &branch,
                                                           BufferBatch &batch) {
-    for (auto &child : branch.children) {
+    std::vector<size_t> indices;
+    std::vector<common::Buffer> encodings;
+    for (size_t i = 0; i < branch.children.size(); ++i) {
+      auto &child = branch.children[i];
       if (child and not child->isDummy()) {
-        OUTCOME_TRY(hash, storeNode(*child, batch));
-        // when a node is written to the storage, it is replaced with a dummy
-        // node to avoid memory waste
-        child = std::make_shared<DummyNode>(hash);
+        OUTCOME_TRY(enc, encodeWithChildren(*child, batch));
+        indices.push_back(i);
+        encodings.push_back(std::move(enc));
       }
     }
+    auto keys = codec_->merkleValues(encodings);
+    for (size_t i = 0; i < indices.size(); ++i) {
+      OUTCOME_TRY(batch.put(keys[i], encodings[i]));
+      // when a node is written to the storage, it is replaced with a dummy
+      // node to avoid memory waste
+      branch.children[indices[i]] = std::make_shared<DummyNode>(keys[i]);
+    }
     return outcome::success();
   }
 
@@ -41,8 +41,16 @@ namespace kagome::storage::trie {
      * avoid memory waste
      */
     outcome::result<RootHash> storeRootNode(PolkadotNode &node);
-    outcome::result<common::Buffer> storeNode(PolkadotNode &node,
-                                              BufferBatch &batch);
+    /**
+     * Stores the descendants of \arg node if it is a branch
+     * @return encoding of the node itself, which is not stored yet
+     */
+    outcome::result<common::Buffer> encodeWithChildren(PolkadotNode &node,
+                                                       BufferBatch &batch);
+    /**
+     * Stores the children of \arg branch, the merkle values of the children
+     * of one branch are calculated at once
+     */
     outcome::result<void> storeChildren(BranchNode &branch, BufferBatch &batch);
     /**
      * Fetches a node from the storage. A nullptr is returned in case that there
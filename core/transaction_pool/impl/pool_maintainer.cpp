@@ -0,0 +1,398 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "transaction_pool/impl/pool_maintainer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+#include <boost/asio/post.hpp>
+
+#include "common/visitor.hpp"
+#include "metrics/timing.hpp"
+#include "scale/scale.hpp"
+#include "transaction_pool/transaction_pool_error.hpp"
+
+namespace {
+  constexpr const char *kRemovedCounterName =
+      "kagome_tx_pool_maintenance_removed_total";
+  constexpr const char *kUpdatedCounterName =
+      "kagome_tx_pool_maintenance_updated_total";
+  constexpr const char *kRequeuedCounterName =
+      "kagome_tx_pool_maintenance_requeued_total";
+  constexpr const char *kRevalidationHistogramName =
+      "kagome_tx_pool_revalidation_seconds";
+  constexpr const char *kMaintenanceHistogramName =
+      "kagome_tx_pool_maintenance_seconds";
+}  // namespace
+
+namespace kagome::transaction_pool {
+
+  using primitives::events::ChainEventType;
+  using primitives::events::ExtrinsicLifecycleEvent;
+
+  PoolMaintainer::PoolMaintainer(
+      std::shared_ptr<application::AppStateManager> app_state_manager,
+      std::shared_ptr<TransactionPool> pool,
+      std::shared_ptr<blockchain::BlockTree> block_tree,
+      std::shared_ptr<runtime::TaggedTransactionQueue> tx_queue,
+      std::shared_ptr<crypto::Hasher> hasher,
+      primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
+      primitives::events::ExtrinsicSubscriptionEnginePtr ext_sub_engine,
+      std::shared_ptr<subscription::ExtrinsicEventKeyRepository> ext_key_repo,
+      std::shared_ptr<boost::asio::io_context> io_context)
+      : pool_{std::move(pool)},
+        block_tree_{std::move(block_tree)},
+        tx_queue_{std::move(tx_queue)},
+        hasher_{std::move(hasher)},
+        chain_sub_engine_{std::move(chain_sub_engine)},
+        ext_sub_engine_{std::move(ext_sub_engine)},
+        ext_key_repo_{std::move(ext_key_repo)},
+        io_context_{std::move(io_context)} {
+    BOOST_ASSERT(app_state_manager != nullptr);
+    BOOST_ASSERT(pool_ != nullptr);
+    BOOST_ASSERT(block_tree_ != nullptr);
+    BOOST_ASSERT(tx_queue_ != nullptr);
+    BOOST_ASSERT(hasher_ != nullptr);
+    BOOST_ASSERT(chain_sub_engine_ != nullptr);
+    BOOST_ASSERT(ext_sub_engine_ != nullptr);
+    BOOST_ASSERT(ext_key_repo_ != nullptr);
+    BOOST_ASSERT(io_context_ != nullptr);
+
+    // initialize metrics
+    registry_->registerCounterFamily(
+        kRemovedCounterName,
+        "Number of transactions removed from the pool by maintenance");
+    stale_removed_ = registry_->registerCounterMetric(kRemovedCounterName,
+                                                      {{"reason", "stale"}});
+    invalid_removed_ = registry_->registerCounterMetric(
+        kRemovedCounterName, {{"reason", "invalid"}});
+    registry_->registerCounterFamily(
+        kUpdatedCounterName,
+        "Number of pooled transactions which validity was changed");
+    updated_ = registry_->registerCounterMetric(kUpdatedCounterName);
+    registry_->registerCounterFamily(
+        kRequeuedCounterName,
+        "Number of transactions of retracted blocks returned to the pool");
+    requeued_ = registry_->registerCounterMetric(kRequeuedCounterName);
+    registry_->registerHistogramFamily(
+        kRevalidationHistogramName,
+        "Time taken to validate a batch of transactions");
+    revalidation_time_ = registry_->registerHistogramMetric(
+        kRevalidationHistogramName,
+        {0.001, 0.005, 0.01, 0.05, 0.1, 0.5, 1, 5, 10});
+    registry_->registerHistogramFamily(
+        kMaintenanceHistogramName,
+        "Time taken to update the pool on a new best block");
+    maintenance_time_ = registry_->registerHistogramMetric(
+        kMaintenanceHistogramName,
+        {0.0001, 0.0005, 0.001, 0.005, 0.01, 0.05, 0.1, 0.5, 1});
+
+    app_state_manager->takeControl(*this);
+  }
+
+  bool PoolMaintainer::prepare() {
+    chain_sub_ = std::make_shared<primitives::events::ChainEventSubscriber>(
+        chain_sub_engine_, nullptr);
+    auto set_id = chain_sub_->generateSubscriptionSetId();
+    chain_sub_->subscribe(set_id, ChainEventType::kNewHeads);
+    chain_sub_->subscribe(set_id, ChainEventType::kFinalizedHeads);
+    chain_sub_->setCallback(
+        [wp = weak_from_this()](auto,
+                                auto &,
+                                const ChainEventType &type,
+                                const primitives::events::ChainEventParams
+                                    &params) {
+          auto self = wp.lock();
+          if (not self) {
+            return;
+          }
+          if (type == ChainEventType::kNewHeads) {
+            self->onNewHead(
+                boost::get<primitives::events::ref_t<
+                    const primitives::BlockHeader>>(params)
+                    .get());
+          } else if (type == ChainEventType::kFinalizedHeads) {
+            self->onFinalized();
+          }
+        });
+    return true;
+  }
+
+  bool PoolMaintainer::start() {
+    best_block_ = block_tree_->deepestLeaf();
+    auto header_res = block_tree_->getBlockHeader(best_block_.hash);
+    if (not header_res) {
+      logger_->error("Can't get header of the best block {}: {}",
+                     best_block_.hash.toHex(),
+                     header_res.error().message());
+      return false;
+    }
+    best_state_root_ = header_res.value().state_root;
+    return true;
+  }
+
+  void PoolMaintainer::stop() {
+    chain_sub_.reset();
+  }
+
+  void PoolMaintainer::onNewHead(const primitives::BlockHeader &header) {
+    auto hash = hasher_->blake2b_256(scale::encode(header).value());
+    primitives::BlockInfo new_head{header.number, hash};
+    // the event is fired while the block is being imported; the pool is
+    // updated afterwards, so that import is not delayed
+    boost::asio::post(*io_context_,
+                      [wp = weak_from_this(),
+                       new_head,
+                       state_root = header.state_root] {
+      auto self = wp.lock();
+      if (not self or self->block_tree_->deepestLeaf() != new_head) {
+        return;
+      }
+      auto start = std::chrono::steady_clock::now();
+
+      auto retracted = self->collectRetracted(new_head);
+      if (not retracted.empty()) {
+        SL_DEBUG(self->logger_,
+                 "{} extrinsics of retracted blocks are queued to be returned "
+                 "to the pool",
+                 retracted.size());
+        self->retracted_.insert(self->retracted_.end(),
+                                std::make_move_iterator(retracted.begin()),
+                                std::make_move_iterator(retracted.end()));
+      }
+      self->best_block_ = new_head;
+      self->best_state_root_ = state_root;
+      self->removeStale(new_head);
+
+      self->maintenance_time_->observe(metrics::secondsSince(start));
+      self->scheduleRevalidation();
+    });
+  }
+
+  void PoolMaintainer::onFinalized() {
+    boost::asio::post(*io_context_, [wp = weak_from_this()] {
+      if (auto self = wp.lock()) {
+        self->scheduleRevalidation();
+      }
+    });
+  }
+
+  std::vector<PoolMaintainer::Candidate> PoolMaintainer::collectRetracted(
+      const primitives::BlockInfo &new_best) const {
+    std::vector<Candidate> retracted;
+    if (best_block_.hash == primitives::BlockHash{}) {
+      return retracted;
+    }
+
+    // blocks of the old best chain, which are not ancestors of the new best
+    // block, are retracted
+    auto block = best_block_;
+    for (size_t depth = 0; depth < kMaxRetractedDepth; ++depth) {
+      if (block.hash == new_best.hash
+          or block_tree_->hasDirectChain(block.hash, new_best.hash)) {
+        break;
+      }
+      auto header_res = block_tree_->getBlockHeader(block.hash);
+      if (not header_res) {
+        break;
+      }
+      auto &header = header_res.value();
+      if (auto body_res = block_tree_->getBlockBody(block.hash)) {
+        for (auto &ext : body_res.value()) {
+          auto hash = hasher_->blake2b_256(ext.data);
+          retracted.push_back(Candidate{std::move(ext), hash, {}, {}});
+        }
+      }
+      block = primitives::BlockInfo{header.number - 1, header.parent_hash};
+    }
+    return retracted;
+  }
+
+  void PoolMaintainer::removeStale(const primitives::BlockInfo &best) {
+    auto removed_res = pool_->removeStale(best.hash);
+    if (not removed_res) {
+      logger_->warn("Can't remove stale transactions at block #{} ({}): {}",
+                    best.number,
+                    best.hash.toHex(),
+                    removed_res.error().message());
+      return;
+    }
+    if (auto removed = removed_res.value().size(); removed != 0) {
+      SL_DEBUG(logger_,
+               "{} stale transactions are removed at block #{}",
+               removed,
+               best.number);
+      stale_removed_->inc(removed);
+    }
+  }
+
+  void PoolMaintainer::scheduleRevalidation() {
+    if (revalidation_in_progress_) {
+      return;
+    }
+
+    auto candidates = std::move(retracted_);
+    retracted_.clear();
+
+    for (auto &[hash, tx] : pool_->getPendingTransactions()) {
+      if (candidates.size() >= kRevalidationBatchSize) {
+        break;
+      }
+      if (revalidated_.emplace(hash).second) {
+        candidates.push_back(Candidate{tx->ext, hash, *tx, {}});
+      }
+    }
+    // all of pooled transactions are visited since the round started, so the
+    // next event starts a new one
+    if (candidates.size() < kRevalidationBatchSize) {
+      revalidated_.clear();
+    }
+
+    if (candidates.empty()) {
+      return;
+    }
+
+    revalidation_in_progress_ = true;
+    validateChunk(Revalidation{best_state_root_, std::move(candidates)});
+  }
+
+  void PoolMaintainer::validateChunk(Revalidation revalidation) {
+    auto start = std::chrono::steady_clock::now();
+    auto &candidates = revalidation.candidates;
+    auto end = std::min(revalidation.validated + kRevalidationChunkSize,
+                        candidates.size());
+    for (; revalidation.validated < end; ++revalidation.validated) {
+      auto &candidate = candidates[revalidation.validated];
+      auto source = candidate.pooled.has_value()
+                        ? primitives::TransactionSource::External
+                        : primitives::TransactionSource::InBlock;
+      auto validity_res = tx_queue_->validate_transaction(
+          revalidation.state_root, source, candidate.ext);
+      if (validity_res) {
+        candidate.validity = std::move(validity_res.value());
+      } else {
+        SL_DEBUG(logger_,
+                 "Validation of extrinsic {} failed: {}",
+                 candidate.hash.toHex(),
+                 validity_res.error().message());
+      }
+    }
+    revalidation.elapsed += std::chrono::steady_clock::now() - start;
+
+    if (revalidation.validated < candidates.size()) {
+      // the rest is validated after handlers queued meanwhile, e.g. import
+      // of a block
+      boost::asio::post(
+          *io_context_,
+          [wp = weak_from_this(),
+           revalidation = std::move(revalidation)]() mutable {
+            if (auto self = wp.lock()) {
+              self->validateChunk(std::move(revalidation));
+            }
+          });
+      return;
+    }
+
+    revalidation_time_->observe(metrics::toSeconds(revalidation.elapsed));
+    applyValidation(std::move(candidates));
+  }
+
+  void PoolMaintainer::applyValidation(std::vector<Candidate> candidates) {
+    revalidation_in_progress_ = false;
+
+    const auto valid_till = [this](Transaction::Longevity longevity) {
+      return longevity
+                     > std::numeric_limits<Transaction::Longevity>::max()
+                           - best_block_.number
+                 ? std::numeric_limits<Transaction::Longevity>::max()
+                 : best_block_.number + longevity;
+    };
+
+    size_t invalid = 0;
+    size_t updated = 0;
+    size_t requeued = 0;
+    for (auto &candidate : candidates) {
+      // runtime failed to validate, so the transaction is kept as is
+      if (not candidate.validity.has_value()) {
+        continue;
+      }
+
+      visit_in_place(
+          candidate.validity.value(),
+          [&](const primitives::ValidTransaction &valid) {
+            Transaction tx;
+            if (candidate.pooled.has_value()) {
+              tx = std::move(candidate.pooled.value());
+              if (tx.priority == valid.priority
+                  and tx.requires == valid.requires
+                  and tx.provides == valid.provides) {
+                return;
+              }
+              // transaction is reinserted to be placed in the pool according
+              // to the actual priority and tags
+              if (not pool_->removeOne(candidate.hash)) {
+                return;
+              }
+              ++updated;
+            } else {
+              tx.ext = std::move(candidate.ext);
+              tx.bytes = tx.ext.data.size();
+              tx.hash = candidate.hash;
+              tx.valid_till = valid_till(valid.longevity);
+              tx.should_propagate = valid.propagate;
+              ++requeued;
+            }
+            tx.priority = valid.priority;
+            tx.requires = valid.requires;
+            tx.provides = valid.provides;
+            if (auto res = pool_->submitOne(std::move(tx)); not res) {
+              SL_DEBUG(logger_,
+                       "Extrinsic {} is not returned to the pool: {}",
+                       candidate.hash.toHex(),
+                       res.error().message());
+            }
+          },
+          [&](const primitives::TransactionValidityError &error) {
+            // unknown validity may be resolved later, so such transactions
+            // are kept, while invalid ones are removed
+            if (candidate.pooled.has_value()
+                and boost::get<primitives::InvalidTransaction>(&error)
+                        != nullptr) {
+              if (pool_->removeOne(candidate.hash)) {
+                notifyInvalid(candidate.pooled.value());
+                ++invalid;
+              }
+            }
+          });
+    }
+
+    if (invalid != 0 or updated != 0 or requeued != 0) {
+      logger_->verbose(
+          "Transaction pool is revalidated: {} removed as invalid, {} updated, "
+          "{} returned from retracted blocks",
+          invalid,
+          updated,
+          requeued);
+    }
+    invalid_removed_->inc(invalid);
+    updated_->inc(updated);
+    requeued_->inc(requeued);
+
+    if (not retracted_.empty()) {
+      scheduleRevalidation();
+    }
+  }
+
+  void PoolMaintainer::notifyInvalid(const Transaction &tx) {
+    if (auto key = ext_key_repo_->getEventKey(tx); key.has_value()) {
+      ext_sub_engine_->notify(key.value(),
+                              ExtrinsicLifecycleEvent::Invalid(key.value()));
+      ext_key_repo_->dropTransaction(tx.observed_id.value());
+    }
+  }
+
+}  // namespace kagome::transaction_pool
@@ -0,0 +1,145 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_TRANSACTION_POOL_POOL_MAINTAINER_HPP
+#define KAGOME_TRANSACTION_POOL_POOL_MAINTAINER_HPP
+
+#include <chrono>
+#include <unordered_set>
+
+#include <boost/asio/io_context.hpp>
+
+#include "application/app_state_manager.hpp"
+#include "blockchain/block_tree.hpp"
+#include "crypto/hasher.hpp"
+#include "log/logger.hpp"
+#include "metrics/metrics.hpp"
+#include "primitives/event_types.hpp"
+#include "runtime/tagged_transaction_queue.hpp"
+#include "storage/trie/types.hpp"
+#include "subscription/extrinsic_event_key_repository.hpp"
+#include "transaction_pool/transaction_pool.hpp"
+
+namespace kagome::transaction_pool {
+
+  /**
+   * Keeps the transaction pool consistent with the chain. On a new best block
+   * it drops stale transactions and returns extrinsics of retracted blocks
+   * to the pool; on new best and finalized blocks it re-validates a bounded
+   * batch of pooled transactions at the state of the best block. Everything
+   * runs in the main io_context, as the runtime and its storage are not
+   * thread-safe; validation is split into small chunks, so that block import
+   * and production are not delayed behind a whole batch
+   */
+  class PoolMaintainer final
+      : public std::enable_shared_from_this<PoolMaintainer> {
+   public:
+    /// Max amount of transactions re-validated at once
+    static constexpr size_t kRevalidationBatchSize = 256;
+
+    /// Max amount of transactions validated by one handler of io_context
+    static constexpr size_t kRevalidationChunkSize = 16;
+
+    /// Max depth of retracted branch which extrinsics are returned to the pool
+    static constexpr size_t kMaxRetractedDepth = 64;
+
+    PoolMaintainer(
+        std::shared_ptr<application::AppStateManager> app_state_manager,
+        std::shared_ptr<TransactionPool> pool,
+        std::shared_ptr<blockchain::BlockTree> block_tree,
+        std::shared_ptr<runtime::TaggedTransactionQueue> tx_queue,
+        std::shared_ptr<crypto::Hasher> hasher,
+        primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
+        primitives::events::ExtrinsicSubscriptionEnginePtr ext_sub_engine,
+        std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
+            ext_key_repo,
+        std::shared_ptr<boost::asio::io_context> io_context);
+
+    /** @see AppStateManager::takeControl */
+    bool prepare();
+
+    /** @see AppStateManager::takeControl */
+    bool start();
+
+    /** @see AppStateManager::takeControl */
+    void stop();
+
+   private:
+    /// Transaction of the pool being re-validated, or extrinsic of retracted
+    /// block being returned to the pool
+    struct Candidate {
+      primitives::Extrinsic ext;
+      Transaction::Hash hash;
+      /// pooled transaction, none for extrinsic of retracted block
+      boost::optional<Transaction> pooled;
+      /// none if validation failed
+      boost::optional<primitives::TransactionValidity> validity;
+    };
+
+    /// Batch of candidates being validated at the state of the best block
+    struct Revalidation {
+      storage::trie::RootHash state_root;
+      std::vector<Candidate> candidates;
+      /// number of candidates validated so far
+      size_t validated = 0;
+      /// time spent on validation so far
+      std::chrono::steady_clock::duration elapsed{};
+    };
+
+    void onNewHead(const primitives::BlockHeader &header);
+
+    void onFinalized();
+
+    /// Returns extrinsics of blocks of the old best chain which are not part
+    /// of the new one
+    std::vector<Candidate> collectRetracted(
+        const primitives::BlockInfo &new_best) const;
+
+    void removeStale(const primitives::BlockInfo &best);
+
+    /// Starts validation of retracted extrinsics queued so far and of the next
+    /// batch of pooled transactions, unless validation is already in progress
+    void scheduleRevalidation();
+
+    /// Validates the next chunk of candidates and schedules the rest, or
+    /// applies the result once all of them are validated
+    void validateChunk(Revalidation revalidation);
+
+    void applyValidation(std::vector<Candidate> candidates);
+
+    void notifyInvalid(const Transaction &tx);
+
+    std::shared_ptr<TransactionPool> pool_;
+    std::shared_ptr<blockchain::BlockTree> block_tree_;
+    std::shared_ptr<runtime::TaggedTransactionQueue> tx_queue_;
+    std::shared_ptr<crypto::Hasher> hasher_;
+    primitives::events::ChainSubscriptionEnginePtr chain_sub_engine_;
+    primitives::events::ChainEventSubscriberPtr chain_sub_;
+    primitives::events::ExtrinsicSubscriptionEnginePtr ext_sub_engine_;
+    std::shared_ptr<subscription::ExtrinsicEventKeyRepository> ext_key_repo_;
+    std::shared_ptr<boost::asio::io_context> io_context_;
+
+    primitives::BlockInfo best_block_;
+    storage::trie::RootHash best_state_root_;
+    std::vector<Candidate> retracted_;
+    std::unordered_set<Transaction::Hash> revalidated_;
+    bool revalidation_in_progress_ = false;
+
+    log::Logger logger_ =
+        log::createLogger("TransactionPoolMaintainer", "transactions");
+
+    // metrics
+    metrics::RegistryPtr registry_ = metrics::createRegistry();
+    metrics::Counter *stale_removed_;
+    metrics::Counter *invalid_removed_;
+    metrics::Counter *updated_;
+    metrics::Counter *requeued_;
+    metrics::Histogram *revalidation_time_;
+    metrics::Histogram *maintenance_time_;
+  };
+
+}  // namespace kagome::transaction_pool
+
+#endif  // KAGOME_TRANSACTION_POOL_POOL_MAINTAINER_HPP
@@ -36,11 +36,13 @@ namespace kagome::transaction_pool {
   }
 
   outcome::result<void> TransactionPoolImpl::submitOne(Transaction &&tx) {
+    std::lock_guard lock{mutex_};
     return submitOne(std::make_shared<Transaction>(std::move(tx)));
   }
 
   outcome::result<void> TransactionPoolImpl::submit(
       std::vector<Transaction> txs) {
+    std::lock_guard lock{mutex_};
     for (auto &tx : txs) {
       OUTCOME_TRY(submitOne(std::make_shared<Transaction>(std::move(tx))));
     }
@@ -131,7 +133,7 @@ namespace kagome::transaction_pool {
   void TransactionPoolImpl::addTransactionAsWaiting(
       const std::shared_ptr<Transaction> &tx) {
     for (auto &tag : tx->requires) {
-      tx_waits_tag_.emplace(tag, tx);
+      addToIndex(tx_waits_tag_, tag, tx->hash);
     }
     if (auto key = ext_key_repo_->getEventKey(*tx); key.has_value()) {
       sub_engine_->notify(key.value(),
@@ -141,6 +143,12 @@ namespace kagome::transaction_pool {
 
   outcome::result<Transaction> TransactionPoolImpl::removeOne(
       const Transaction::Hash &tx_hash) {
+    std::lock_guard lock{mutex_};
+    return removeTransaction(tx_hash);
+  }
+
+  outcome::result<Transaction> TransactionPoolImpl::removeTransaction(
+      const Transaction::Hash &tx_hash) {
     auto tx_node = imported_txs_.extract(tx_hash);
     if (tx_node.empty()) {
       SL_TRACE(logger_,
@@ -164,8 +172,9 @@ namespace kagome::transaction_pool {
 
   void TransactionPoolImpl::remove(
       const std::vector<Transaction::Hash> &tx_hashes) {
+    std::lock_guard lock{mutex_};
     for (auto &tx_hash : tx_hashes) {
-      [[maybe_unused]] auto result = removeOne(tx_hash);
+      [[maybe_unused]] auto result = removeTransaction(tx_hash);
     }
   }
 
@@ -176,6 +185,11 @@ namespace kagome::transaction_pool {
       auto tx = postponed_txs.front().lock();
       postponed_txs.pop_front();
 
+      // transaction might be removed from the pool while it was postponed
+      if (not tx or imported_txs_.count(tx->hash) == 0 or isInReady(tx)) {
+        continue;
+      }
+
       auto result = processTransaction(tx);
       if (result.has_error()
           && result.error() == TransactionPoolError::POOL_IS_FULL) {
@@ -190,29 +204,34 @@ namespace kagome::transaction_pool {
   void TransactionPoolImpl::delTransactionAsWaiting(
       const std::shared_ptr<Transaction> &tx) {
     for (auto &tag : tx->requires) {
-      auto range = tx_waits_tag_.equal_range(tag);
-      for (auto i = range.first; i != range.second;) {
-        if (i->second.lock() == tx) {
-          tx_waits_tag_.erase(i);
-          break;
-        }
-      }
+      removeFromIndex(tx_waits_tag_, tag, tx->hash);
     }
   }
 
   std::map<Transaction::Hash, std::shared_ptr<Transaction>>
   TransactionPoolImpl::getReadyTransactions() const {
+    std::lock_guard lock{mutex_};
     std::map<Transaction::Hash, std::shared_ptr<Transaction>> ready;
-    std::for_each(ready_txs_.begin(), ready_txs_.end(), [&ready](auto it) {
-      if (auto tx = it.second.lock()) {
-        ready.emplace(it.first, std::move(tx));
-      }
-    });
+    for (auto &entry : ready_queue_) {
+      ready.emplace(entry.tx->hash, entry.tx);
+    }
     return ready;
   }
 
-  const std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>
-      &TransactionPoolImpl::getPendingTransactions() const {
+  std::vector<std::shared_ptr<const Transaction>>
+  TransactionPoolImpl::getBestReadyTransactions() const {
+    std::lock_guard lock{mutex_};
+    std::vector<std::shared_ptr<const Transaction>> ready;
+    ready.reserve(ready_queue_.size());
+    for (auto &entry : ready_queue_) {
+      ready.emplace_back(entry.tx);
+    }
+    return ready;
+  }
+
+  std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>
+  TransactionPoolImpl::getPendingTransactions() const {
+    std::lock_guard lock{mutex_};
     return imported_txs_;
   }
 
@@ -220,6 +239,8 @@ namespace kagome::transaction_pool {
       const primitives::BlockId &at) {
     OUTCOME_TRY(number, header_repo_->getNumberById(at));
 
+    std::lock_guard lock{mutex_};
+
     std::vector<Transaction::Hash> remove_to;
 
     for (auto &[txHash, tx] : imported_txs_) {
@@ -228,89 +249,132 @@ namespace kagome::transaction_pool {
       }
     }
 
+    std::vector<Transaction> removed;
+    removed.reserve(remove_to.size());
     for (auto &tx_hash : remove_to) {
-      OUTCOME_TRY(tx, removeOne(tx_hash));
+      OUTCOME_TRY(tx, removeTransaction(tx_hash));
       if (auto key = ext_key_repo_->getEventKey(tx); key.has_value()) {
         sub_engine_->notify(key.value(),
                             ExtrinsicLifecycleEvent::Dropped(key.value()));
         ext_key_repo_->dropTransaction(tx.observed_id.value());
       }
+      removed.emplace_back(std::move(tx));
     }
 
     moderator_->updateBan();
 
-    return outcome::success();
+    return removed;
+  }
+
+  void TransactionPoolImpl::addToIndex(TagIndex &index,
+                                       const Transaction::Tag &tag,
+                                       const Transaction::Hash &hash) {
+    index[tag].insert(hash);
+  }
+
+  void TransactionPoolImpl::removeFromIndex(TagIndex &index,
+                                            const Transaction::Tag &tag,
+                                            const Transaction::Hash &hash) {
+    if (auto it = index.find(tag); it != index.end()) {
+      it->second.erase(hash);
+      // empty entries are not kept, so presence of tag means it is used
+      if (it->second.empty()) {
+        index.erase(it);
+      }
+    }
   }
 
   bool TransactionPoolImpl::isInReady(
       const std::shared_ptr<const Transaction> &tx) const {
-    auto i = ready_txs_.find(tx->hash);
-    return i != ready_txs_.end() && !i->second.expired();
+    return ready_txs_.count(tx->hash) != 0;
   }
 
   bool TransactionPoolImpl::checkForReady(
       const std::shared_ptr<const Transaction> &tx) const {
     return std::all_of(
         tx->requires.begin(), tx->requires.end(), [this](auto &&tag) {
-          auto range = tx_provides_tag_.equal_range(tag);
-          return range.first != range.second;
+          return tx_provides_tag_.count(tag) != 0;
         });
   }
 
   void TransactionPoolImpl::setReady(const std::shared_ptr<Transaction> &tx) {
-    if (auto [_, ok] = ready_txs_.emplace(tx->hash, tx); ok) {
-      if (auto key = ext_key_repo_->getEventKey(*tx); key.has_value()) {
+    // transactions unblocked by the tags provided by the ones becoming ready
+    // are processed iteratively, as chains of dependent transactions might be
+    // long
+    std::vector<std::shared_ptr<Transaction>> unblocked{tx};
+    while (not unblocked.empty()) {
+      auto ready_tx = std::move(unblocked.back());
+      unblocked.pop_back();
+      if (isInReady(ready_tx)) {
+        continue;
+      }
+      if (not hasSpaceInReady()) {
+        postponeTransaction(ready_tx);
+        continue;
+      }
+
+      auto it = ready_queue_.emplace(ReadyEntry{ready_tx, next_ready_seq_++});
+      ready_txs_.emplace(ready_tx->hash, it.first);
+      if (auto key = ext_key_repo_->getEventKey(*ready_tx); key.has_value()) {
         sub_engine_->notify(key.value(),
                             ExtrinsicLifecycleEvent::Ready(key.value()));
       }
-      commitRequiredTags(tx);
-      commitProvidedTags(tx);
+      commitRequiredTags(ready_tx);
+      commitProvidedTags(ready_tx, unblocked);
     }
   }
 
   void TransactionPoolImpl::commitRequiredTags(
       const std::shared_ptr<Transaction> &tx) {
     for (auto &tag : tx->requires) {
-      auto range = tx_waits_tag_.equal_range(tag);
-      for (auto i = range.first; i != range.second;) {
-        auto ci = i++;
-        if (ci->second.lock() == tx) {
-          auto node = tx_waits_tag_.extract(ci);
-          tx_depends_on_tag_.emplace(std::move(node.key()),
-                                     std::move(node.mapped()));
-        }
-      }
+      removeFromIndex(tx_waits_tag_, tag, tx->hash);
+      addToIndex(tx_depends_on_tag_, tag, tx->hash);
     }
   }
 
   void TransactionPoolImpl::commitProvidedTags(
-      const std::shared_ptr<Transaction> &tx) {
+      const std::shared_ptr<Transaction> &tx,
+      std::vector<std::shared_ptr<Transaction>> &unblocked) {
     for (auto &tag : tx->provides) {
-      tx_provides_tag_.emplace(tag, tx);
+      addToIndex(tx_provides_tag_, tag, tx->hash);
 
-      provideTag(tag);
+      provideTag(tag, unblocked);
     }
   }
 
-  void TransactionPoolImpl::provideTag(const Transaction::Tag &tag) {
-    auto range = tx_waits_tag_.equal_range(tag);
-    for (auto it = range.first; it != range.second;) {
-      auto tx = (it++)->second.lock();
-      if (checkForReady(tx)) {
-        if (hasSpaceInReady()) {
-          setReady(tx);
-        } else {
-          postponeTransaction(tx);
+  void TransactionPoolImpl::provideTag(
+      const Transaction::Tag &tag,
+      std::vector<std::shared_ptr<Transaction>> &unblocked) {
+    auto waiting = tx_waits_tag_.find(tag);
+    if (waiting == tx_waits_tag_.end()) {
+      return;
+    }
+    for (auto &hash : waiting->second) {
+      if (auto it = imported_txs_.find(hash); it != imported_txs_.end()) {
+        if (checkForReady(it->second)) {
+          unblocked.push_back(it->second);
         }
       }
     }
   }
 
   void TransactionPoolImpl::unsetReady(const std::shared_ptr<Transaction> &tx) {
-    if (auto tx_node = ready_txs_.extract(tx->hash); !tx_node.empty()) {
-      rollbackRequiredTags(tx);
-      rollbackProvidedTags(tx);
-      if (auto key = ext_key_repo_->getEventKey(*tx); key.has_value()) {
+    // transactions which lost providers of the tags they require are processed
+    // iteratively, as chains of dependent transactions might be long
+    std::vector<std::shared_ptr<Transaction>> orphaned{tx};
+    while (not orphaned.empty()) {
+      auto orphan = std::move(orphaned.back());
+      orphaned.pop_back();
+      auto it = ready_txs_.find(orphan->hash);
+      if (it == ready_txs_.end()) {
+        continue;
+      }
+      ready_queue_.erase(it->second);
+      ready_txs_.erase(it);
+
+      rollbackRequiredTags(orphan);
+      rollbackProvidedTags(orphan, orphaned);
+      if (auto key = ext_key_repo_->getEventKey(*orphan); key.has_value()) {
         sub_engine_->notify(key.value(),
                             ExtrinsicLifecycleEvent::Future(key.value()));
       }
@@ -320,39 +384,40 @@ namespace kagome::transaction_pool {
   void TransactionPoolImpl::rollbackRequiredTags(
       const std::shared_ptr<Transaction> &tx) {
     for (auto &tag : tx->requires) {
-      tx_waits_tag_.emplace(tag, tx);
+      removeFromIndex(tx_depends_on_tag_, tag, tx->hash);
+      addToIndex(tx_waits_tag_, tag, tx->hash);
     }
   }
 
   void TransactionPoolImpl::rollbackProvidedTags(
-      const std::shared_ptr<Transaction> &tx) {
+      const std::shared_ptr<Transaction> &tx,
+      std::vector<std::shared_ptr<Transaction>> &orphaned) {
     for (auto &tag : tx->provides) {
-      auto range = tx_provides_tag_.equal_range(tag);
-      for (auto i = range.first; i != range.second; ++i) {
-        if (i->second.lock() == tx) {
-          tx_provides_tag_.erase(i);
-          break;
-        }
-      }
+      removeFromIndex(tx_provides_tag_, tag, tx->hash);
 
-      unprovideTag(tag);
+      unprovideTag(tag, orphaned);
     }
   }
 
-  void TransactionPoolImpl::unprovideTag(const Transaction::Tag &tag) {
-    if (tx_provides_tag_.find(tag) == tx_provides_tag_.end()) {
-      for (auto it = tx_depends_on_tag_.find(tag);
-           it != tx_depends_on_tag_.end();
-           it = tx_depends_on_tag_.find(tag)) {
-        if (auto tx = it->second.lock()) {
-          unsetReady(tx);
-        }
-        tx_depends_on_tag_.erase(it);
+  void TransactionPoolImpl::unprovideTag(
+      const Transaction::Tag &tag,
+      std::vector<std::shared_ptr<Transaction>> &orphaned) {
+    if (tx_provides_tag_.count(tag) != 0) {
+      return;
+    }
+    auto depending = tx_depends_on_tag_.find(tag);
+    if (depending == tx_depends_on_tag_.end()) {
+      return;
+    }
+    for (auto &hash : depending->second) {
+      if (auto it = imported_txs_.find(hash); it != imported_txs_.end()) {
+        orphaned.push_back(it->second);
       }
     }
   }
 
   TransactionPoolImpl::Status TransactionPoolImpl::getStatus() const {
+    std::lock_guard lock{mutex_};
     return Status{ready_txs_.size(), imported_txs_.size() - ready_txs_.size()};
   }
 
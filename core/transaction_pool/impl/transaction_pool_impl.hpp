@@ -6,6 +6,14 @@
 #ifndef KAGOME_TRANSACTION_POOL_IMPL_HPP
 #define KAGOME_TRANSACTION_POOL_IMPL_HPP
 
+#include <list>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <boost/container_hash/hash.hpp>
+
 #include "blockchain/block_header_repository.hpp"
 #include "log/logger.hpp"
 #include "outcome/outcome.hpp"
@@ -34,8 +42,8 @@ namespace kagome::transaction_pool {
     TransactionPoolImpl &operator=(TransactionPoolImpl &&) = delete;
     TransactionPoolImpl &operator=(const TransactionPoolImpl &) = delete;
 
-    const std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>
-        &getPendingTransactions() const override;
+    std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>
+    getPendingTransactions() const override;
 
     outcome::result<void> submitOne(Transaction &&tx) override;
     outcome::result<void> submit(std::vector<Transaction> txs) override;
@@ -47,14 +55,58 @@ namespace kagome::transaction_pool {
     std::map<Transaction::Hash, std::shared_ptr<Transaction>>
     getReadyTransactions() const override;
 
+    std::vector<std::shared_ptr<const Transaction>> getBestReadyTransactions()
+        const override;
+
     outcome::result<std::vector<Transaction>> removeStale(
         const primitives::BlockId &at) override;
 
     Status getStatus() const override;
 
    private:
+    struct TagHash {
+      size_t operator()(const Transaction::Tag &tag) const {
+        return boost::hash_range(tag.begin(), tag.end());
+      }
+    };
+
+    /// Hashes of transactions related to specific tags
+    using TagIndex = std::unordered_map<Transaction::Tag,
+                                        std::unordered_set<Transaction::Hash>,
+                                        TagHash>;
+
+    struct ReadyEntry {
+      std::shared_ptr<Transaction> tx;
+      /// Ordinal number of the moment transaction became ready
+      uint64_t seq;
+    };
+
+    /// Puts transactions of higher priority first, and earlier ones among
+    /// transactions of the same priority
+    struct ReadyOrder {
+      bool operator()(const ReadyEntry &lhs, const ReadyEntry &rhs) const {
+        if (lhs.tx->priority != rhs.tx->priority) {
+          return lhs.tx->priority > rhs.tx->priority;
+        }
+        return lhs.seq < rhs.seq;
+      }
+    };
+
+    using ReadyQueue = std::set<ReadyEntry, ReadyOrder>;
+
+    static void addToIndex(TagIndex &index,
+                           const Transaction::Tag &tag,
+                           const Transaction::Hash &hash);
+
+    static void removeFromIndex(TagIndex &index,
+                                const Transaction::Tag &tag,
+                                const Transaction::Hash &hash);
+
     outcome::result<void> submitOne(const std::shared_ptr<Transaction> &tx);
 
+    outcome::result<Transaction> removeTransaction(
+        const Transaction::Hash &tx_hash);
+
     outcome::result<void> processTransaction(
         const std::shared_ptr<Transaction> &tx);
 
@@ -78,17 +130,25 @@ namespace kagome::transaction_pool {
     /// Process postponed transactions (in case appearing space for them)
     void processPostponedTransactions();
 
-    void provideTag(const Transaction::Tag &tag);
+    /// Collects waiting transactions which become ready by providing of tag
+    void provideTag(const Transaction::Tag &tag,
+                    std::vector<std::shared_ptr<Transaction>> &unblocked);
 
-    void unprovideTag(const Transaction::Tag &tag);
+    /// Collects ready transactions which lose the last provider of tag
+    void unprovideTag(const Transaction::Tag &tag,
+                      std::vector<std::shared_ptr<Transaction>> &orphaned);
 
     void commitRequiredTags(const std::shared_ptr<Transaction> &tx);
 
-    void commitProvidedTags(const std::shared_ptr<Transaction> &tx);
+    void commitProvidedTags(
+        const std::shared_ptr<Transaction> &tx,
+        std::vector<std::shared_ptr<Transaction>> &unblocked);
 
     void rollbackRequiredTags(const std::shared_ptr<Transaction> &tx);
 
-    void rollbackProvidedTags(const std::shared_ptr<Transaction> &tx);
+    void rollbackProvidedTags(
+        const std::shared_ptr<Transaction> &tx,
+        std::vector<std::shared_ptr<Transaction>> &orphaned);
 
     bool checkForReady(const std::shared_ptr<const Transaction> &tx) const;
 
@@ -109,27 +169,33 @@ namespace kagome::transaction_pool {
     /// bans stale and invalid transactions for some amount of time
     std::unique_ptr<PoolModerator> moderator_;
 
+    /// Guards the state below, which is taken by the public methods only
+    mutable std::mutex mutex_;
+
     /// All of imported transaction, contained in the pool
     std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>
         imported_txs_;
 
-    /// Collection transaction with full-satisfied dependencies
-    std::unordered_map<Transaction::Hash, std::weak_ptr<Transaction>>
-        ready_txs_;
+    /// Transactions with full-satisfied dependencies, from the best one
+    ReadyQueue ready_queue_;
+
+    /// Positions of ready transactions in the queue
+    std::unordered_map<Transaction::Hash, ReadyQueue::iterator> ready_txs_;
+
+    /// Ordinal number of the next transaction becoming ready
+    uint64_t next_ready_seq_ = 0;
 
     /// List of ready transaction over limit. It will be process first of all
     std::list<std::weak_ptr<Transaction>> postponed_txs_;
 
-    /// Transactions which provides specific tags
-    std::multimap<Transaction::Tag, std::weak_ptr<Transaction>>
-        tx_provides_tag_;
+    /// Ready transactions which provides specific tags
+    TagIndex tx_provides_tag_;
 
-    /// Transactions with resolved requirement of a specific tag
-    std::multimap<Transaction::Tag, std::weak_ptr<Transaction>>
-        tx_depends_on_tag_;
+    /// Ready transactions with resolved requirement of a specific tag
+    TagIndex tx_depends_on_tag_;
 
     /// Transactions with unresolved require of specific tags
-    std::multimap<Transaction::Tag, std::weak_ptr<Transaction>> tx_waits_tag_;
+    TagIndex tx_waits_tag_;
 
     Limits limits_;
   };
@@ -15,6 +15,11 @@ namespace kagome::transaction_pool {
 
   using primitives::Transaction;
 
+  /**
+   * Pool of transactions to be included in blocks. It is used by the threads
+   * serving RPC requests as well as by the main one, so the results are
+   * copies which stay valid while the pool is changed
+   */
   class TransactionPool {
    public:
     struct Status;
@@ -25,9 +30,8 @@ namespace kagome::transaction_pool {
     /**
      * @return pending transactions
      */
-    virtual const std::unordered_map<Transaction::Hash,
-                                     std::shared_ptr<Transaction>>
-        &getPendingTransactions() const = 0;
+    virtual std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>
+    getPendingTransactions() const = 0;
 
     /**
      * Import one verified transaction to the pool. If it has unresolved
@@ -65,6 +69,15 @@ namespace kagome::transaction_pool {
     virtual std::map<Transaction::Hash, std::shared_ptr<Transaction>>
     getReadyTransactions() const = 0;
 
+    /**
+     * @return ready transactions starting from the best one: in order of
+     * priority, and in order of becoming ready among transactions of the same
+     * priority. Only pointers are copied, their number is bounded by
+     * Limits::max_ready_num
+     */
+    virtual std::vector<std::shared_ptr<const Transaction>>
+    getBestReadyTransactions() const = 0;
+
     /**
      * Remove from the pool and temporarily ban transactions which longevity is
      * expired
@@ -85,8 +98,8 @@ namespace kagome::transaction_pool {
   };
 
   struct TransactionPool::Limits {
-    static constexpr size_t kDefaultMaxReadyNum = 128;
-    static constexpr size_t kDefaultCapacity = 512;
+    static constexpr size_t kDefaultMaxReadyNum = 8192;
+    static constexpr size_t kDefaultCapacity = 16384;
 
     size_t max_ready_num = kDefaultMaxReadyNum;
     size_t capacity = kDefaultCapacity;
@@ -0,0 +1,58 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/jrpc/pubsub_notification.hpp"
+
+#include <limits>
+
+#include <gtest/gtest.h>
+
+using kagome::api::PreparedNotification;
+
+/**
+ * @given notification prepared around a serialized result
+ * @when it is completed with a subscription id
+ * @then the message is the json-rpc notification of the result for that
+ * subscription
+ */
+TEST(PubsubNotificationTest, EnvelopesResult) {
+  auto notification =
+      PreparedNotification::make("chain_newHead", R"({"number":"0x1"})");
+
+  ASSERT_EQ(notification.withSetId(42),
+            R"({"jsonrpc":"2.0","method":"chain_newHead","id":0,)"
+            R"("params":{"result":{"number":"0x1"},"subscription":42}})");
+}
+
+/**
+ * @given one notification prepared for several sessions
+ * @when it is completed with different subscription ids
+ * @then the messages differ only in the subscription id
+ */
+TEST(PubsubNotificationTest, SharedBetweenSubscriptions) {
+  auto notification = PreparedNotification::make("state_storage", "null");
+
+  ASSERT_EQ(notification.withSetId(1),
+            R"({"jsonrpc":"2.0","method":"state_storage","id":0,)"
+            R"("params":{"result":null,"subscription":1}})");
+  ASSERT_EQ(notification.withSetId(std::numeric_limits<uint32_t>::max()),
+            R"({"jsonrpc":"2.0","method":"state_storage","id":0,)"
+            R"("params":{"result":null,"subscription":4294967295}})");
+}
+
+/**
+ * @given result which itself contains a subscription field
+ * @when notification is prepared around it
+ * @then the result is kept as is @and the subscription id is placed after it
+ */
+TEST(PubsubNotificationTest, ResultIsNotInspected) {
+  constexpr auto result = R"({"subscription":4294967295})";
+  auto notification = PreparedNotification::make("state_storage", result);
+
+  ASSERT_EQ(notification.withSetId(7),
+            R"({"jsonrpc":"2.0","method":"state_storage","id":0,)"
+            R"("params":{"result":{"subscription":4294967295},)"
+            R"("subscription":7}})");
+}
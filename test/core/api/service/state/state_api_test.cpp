@@ -12,18 +12,21 @@
 #include "mock/core/api/service/state/state_api_mock.hpp"
 #include "mock/core/blockchain/block_header_repository_mock.hpp"
 #include "mock/core/blockchain/block_tree_mock.hpp"
+#include "mock/core/clock/clock_mock.hpp"
 #include "mock/core/runtime/core_mock.hpp"
 #include "mock/core/runtime/metadata_mock.hpp"
 #include "mock/core/storage/trie/polkadot_trie_cursor_mock.h"
 #include "mock/core/storage/trie/trie_batches_mock.hpp"
 #include "mock/core/storage/trie/trie_storage_mock.hpp"
 #include "primitives/block_header.hpp"
+#include "storage/trie/polkadot_trie/trie_error.hpp"
 #include "testutil/literals.hpp"
 #include "testutil/outcome.hpp"
 
 using kagome::api::StateApiMock;
 using kagome::blockchain::BlockHeaderRepositoryMock;
 using kagome::blockchain::BlockTreeMock;
+using kagome::clock::SteadyClockMock;
 using kagome::common::Buffer;
 using kagome::primitives::BlockHash;
 using kagome::primitives::BlockHeader;
@@ -50,8 +53,10 @@ namespace kagome::api {
     auto runtime_core = std::make_shared<CoreMock>();
     auto metadata = std::make_shared<MetadataMock>();
 
+    auto clock = std::make_shared<SteadyClockMock>();
+
     api::StateApiImpl api{
-        block_header_repo, storage, block_tree, runtime_core, metadata};
+        block_header_repo, storage, block_tree, runtime_core, metadata, clock};
 
     EXPECT_CALL(*block_tree, getLastFinalized())
         .WillOnce(testing::Return(BlockInfo(42, "D"_hash256)));
@@ -77,6 +82,110 @@ namespace kagome::api {
     ASSERT_EQ(r1, "1"_buf);
   }
 
+  /**
+   * @given state api @and chain of four blocks, two of which have the same
+   * state
+   * @when storage of a set of keys with duplicates is queried over the chain
+   * @then the first block reports values of all the keys, the following ones
+   * only the changed values @and the state of each block is read once
+   */
+  TEST(StateApiTest, QueryStorage) {
+    auto storage = std::make_shared<TrieStorageMock>();
+    auto block_header_repo = std::make_shared<BlockHeaderRepositoryMock>();
+    auto block_tree = std::make_shared<BlockTreeMock>();
+    auto runtime_core = std::make_shared<CoreMock>();
+    auto metadata = std::make_shared<MetadataMock>();
+
+    auto clock = std::make_shared<SteadyClockMock>();
+
+    api::StateApiImpl api{
+        block_header_repo, storage, block_tree, runtime_core, metadata, clock};
+
+    EXPECT_CALL(*block_header_repo, getNumberByHash("A"_hash256))
+        .WillOnce(Return(1));
+    EXPECT_CALL(*block_header_repo, getNumberByHash("D"_hash256))
+        .WillOnce(Return(4));
+    EXPECT_CALL(*block_tree, getChainByBlocks("A"_hash256, "D"_hash256))
+        .WillOnce(Return(std::vector{
+            "A"_hash256, "B"_hash256, "C"_hash256, "D"_hash256}));
+    std::map<BlockHash, kagome::storage::trie::RootHash> roots{
+        {"A"_hash256, "1"_hash256},
+        {"B"_hash256, "2"_hash256},
+        {"C"_hash256, "2"_hash256},
+        {"D"_hash256, "3"_hash256}};
+    for (auto &[block, root] : roots) {
+      EXPECT_CALL(*block_header_repo,
+                  getBlockHeader(primitives::BlockId{block}))
+          .WillOnce(Return(BlockHeader{.state_root = root}));
+    }
+
+    std::map<kagome::storage::trie::RootHash, std::map<Buffer, Buffer>> states{
+        {"1"_hash256, {{"a"_buf, "1"_buf}}},
+        {"2"_hash256, {{"a"_buf, "1"_buf}, {"b"_buf, "2"_buf}}},
+        {"3"_hash256, {{"a"_buf, "3"_buf}, {"b"_buf, "2"_buf}}}};
+    EXPECT_CALL(*storage, getEphemeralBatchAt(_))
+        .Times(3)
+        .WillRepeatedly(testing::Invoke([&](auto &root) {
+          auto batch = std::make_unique<EphemeralTrieBatchMock>();
+          EXPECT_CALL(*batch, get(_))
+              .WillRepeatedly(testing::Invoke(
+                  [&state = states.at(root)](
+                      auto &key) -> outcome::result<Buffer> {
+                    if (auto it = state.find(key); it != state.end()) {
+                      return it->second;
+                    }
+                    return kagome::storage::trie::TrieError::NO_VALUE;
+                  }));
+          return batch;
+        }));
+
+    EXPECT_OUTCOME_TRUE(
+        change_sets,
+        api.queryStorage(
+            {"b"_buf, "a"_buf, "a"_buf}, "A"_hash256, "D"_hash256));
+    ASSERT_EQ(change_sets.size(), 3);
+    ASSERT_EQ(change_sets[0].block, "A"_hash256);
+    ASSERT_THAT(change_sets[0].changes,
+                ElementsAre(std::pair{"a"_buf, boost::make_optional("1"_buf)},
+                            std::pair{"b"_buf, boost::optional<Buffer>{}}));
+    ASSERT_EQ(change_sets[1].block, "B"_hash256);
+    ASSERT_THAT(
+        change_sets[1].changes,
+        ElementsAre(std::pair{"b"_buf, boost::make_optional("2"_buf)}));
+    ASSERT_EQ(change_sets[2].block, "D"_hash256);
+    ASSERT_THAT(
+        change_sets[2].changes,
+        ElementsAre(std::pair{"a"_buf, boost::make_optional("3"_buf)}));
+  }
+
+  /**
+   * @given state api
+   * @when storage is queried over the range longer than allowed
+   * @then an error is returned without reading any state
+   */
+  TEST(StateApiTest, QueryStorageRangeIsLimited) {
+    auto storage = std::make_shared<TrieStorageMock>();
+    auto block_header_repo = std::make_shared<BlockHeaderRepositoryMock>();
+    auto block_tree = std::make_shared<BlockTreeMock>();
+    auto runtime_core = std::make_shared<CoreMock>();
+    auto metadata = std::make_shared<MetadataMock>();
+
+    auto clock = std::make_shared<SteadyClockMock>();
+
+    api::StateApiImpl api{
+        block_header_repo, storage, block_tree, runtime_core, metadata, clock};
+
+    EXPECT_CALL(*block_header_repo, getNumberByHash("A"_hash256))
+        .WillOnce(Return(1));
+    EXPECT_CALL(*block_header_repo, getNumberByHash("Z"_hash256))
+        .WillOnce(Return(1 + StateApiImpl::kMaxBlockRange));
+    EXPECT_CALL(*storage, getEphemeralBatchAt(_)).Times(0);
+
+    EXPECT_OUTCOME_ERROR(res,
+                         api.queryStorage({"a"_buf}, "A"_hash256, "Z"_hash256),
+                         StateApiImpl::Error::MAX_BLOCK_RANGE_EXCEEDED);
+  }
+
   class GetKeysPagedTest : public ::testing::Test {
    public:
     void SetUp() override {
@@ -86,8 +195,16 @@ namespace kagome::api {
       auto runtime_core = std::make_shared<CoreMock>();
       auto metadata = std::make_shared<MetadataMock>();
 
-      api_ = std::make_shared<api::StateApiImpl>(
-          block_header_repo_, storage, block_tree_, runtime_core, metadata);
+      ON_CALL(*clock_, now()).WillByDefault(testing::Invoke([this] {
+        return now_;
+      }));
+
+      api_ = std::make_shared<api::StateApiImpl>(block_header_repo_,
+                                                 storage,
+                                                 block_tree_,
+                                                 runtime_core,
+                                                 metadata,
+                                                 clock_);
 
       EXPECT_CALL(*block_tree_, getLastFinalized())
           .WillOnce(testing::Return(BlockInfo(42, "D"_hash256)));
@@ -98,6 +215,7 @@ namespace kagome::api {
 
       EXPECT_CALL(*storage, getEphemeralBatchAt(_))
           .WillRepeatedly(testing::Invoke([this](auto &root) {
+            ++batches_opened_;
             auto batch = std::make_unique<EphemeralTrieBatchMock>();
             EXPECT_CALL(*batch, trieCursorProxy())
                 .WillRepeatedly(
@@ -110,9 +228,13 @@ namespace kagome::api {
    protected:
     std::shared_ptr<BlockHeaderRepositoryMock> block_header_repo_;
     std::shared_ptr<BlockTreeMock> block_tree_;
+    std::shared_ptr<SteadyClockMock> clock_ =
+        std::make_shared<testing::NiceMock<SteadyClockMock>>();
+    SteadyClockMock::TimePoint now_{};
+    size_t batches_opened_ = 0;
     std::shared_ptr<api::StateApiImpl> api_;
 
-    const std::map<Buffer, Buffer> lex_sorted_vals{
+    std::map<Buffer, Buffer> lex_sorted_vals{
         {"0102"_hex2buf, "0102"_hex2buf},
         {"0103"_hex2buf, "0103"_hex2buf},
         {"010304"_hex2buf, "010304"_hex2buf},
@@ -180,6 +302,80 @@ namespace kagome::api {
                             "06070803"_hex2buf));
   }
 
+  /**
+   * @given state api with cursor over predefined set of key-vals
+   * @when getPairsPaged is invoked for two consecutive pages
+   * @then pairs of both pages are returned @and the second page continues
+   * with the cursor of the first one instead of opening the state again
+   */
+  TEST_F(GetKeysPagedTest, NextPageReusesCursor) {
+    EXPECT_OUTCOME_TRUE(
+        first, api_->getPairsPaged("06"_hex2buf, 2, boost::none, boost::none));
+    ASSERT_THAT(first,
+                ElementsAre(std::pair{"06"_hex2buf, "06"_hex2buf},
+                            std::pair{"0607"_hex2buf, "0607"_hex2buf}));
+
+    EXPECT_OUTCOME_TRUE(
+        second,
+        api_->getPairsPaged("06"_hex2buf, 2, "0607"_hex2buf, "D"_hash256));
+    ASSERT_THAT(second,
+                ElementsAre(std::pair{"060708"_hex2buf, "060708"_hex2buf},
+                            std::pair{"06070801"_hex2buf, "06070801"_hex2buf}));
+    ASSERT_EQ(batches_opened_, 1);
+  }
+
+  /**
+   * @given state api with cursor over predefined set of key-vals
+   * @when the next page is requested after the kept cursor has expired
+   * @then the state is opened again @and the page is still correct
+   */
+  TEST_F(GetKeysPagedTest, ExpiredCursorIsNotReused) {
+    EXPECT_OUTCOME_TRUE(
+        first, api_->getKeysPaged("06"_hex2buf, 2, boost::none, boost::none));
+    ASSERT_THAT(first, ElementsAre("06"_hex2buf, "0607"_hex2buf));
+
+    now_ += StorageCursorCache::kTtl + std::chrono::seconds{1};
+    primitives::BlockId did = "D"_hash256;
+    EXPECT_CALL(*block_header_repo_, getBlockHeader(did))
+        .WillOnce(testing::Return(BlockHeader{.state_root = "CDE"_hash256}));
+
+    EXPECT_OUTCOME_TRUE(
+        second,
+        api_->getKeysPaged("06"_hex2buf, 2, "0607"_hex2buf, "D"_hash256));
+    ASSERT_THAT(second, ElementsAre("060708"_hex2buf, "06070801"_hex2buf));
+    ASSERT_EQ(batches_opened_, 2);
+  }
+
+  /**
+   * @given state api with cursor over predefined set of key-vals
+   * @when getPairs invoked with prefix
+   * @then all pairs with provided prefix are returned
+   */
+  TEST_F(GetKeysPagedTest, GetPairsReturnsWholePrefix) {
+    EXPECT_OUTCOME_TRUE(val, api_->getPairs("0607"_hex2buf, boost::none));
+    ASSERT_THAT(val,
+                ElementsAre(std::pair{"0607"_hex2buf, "0607"_hex2buf},
+                            std::pair{"060708"_hex2buf, "060708"_hex2buf},
+                            std::pair{"06070801"_hex2buf, "06070801"_hex2buf},
+                            std::pair{"06070802"_hex2buf, "06070802"_hex2buf},
+                            std::pair{"06070803"_hex2buf, "06070803"_hex2buf}));
+  }
+
+  /**
+   * @given state api with a value under the prefix that alone is as big as
+   * the response size limit
+   * @when getPairs invoked with that prefix
+   * @then MAX_RESPONSE_SIZE_EXCEEDED is returned instead of the pairs
+   */
+  TEST_F(GetKeysPagedTest, GetPairsRejectsTooLargeResponse) {
+    lex_sorted_vals.emplace(
+        "060709"_hex2buf, Buffer(StateApiImpl::kMaxPairsResponseSize, 0));
+
+    EXPECT_OUTCOME_ERROR(res,
+                         api_->getPairs("06"_hex2buf, boost::none),
+                         StateApiImpl::Error::MAX_RESPONSE_SIZE_EXCEEDED);
+  }
+
   /**
    * @given state api
    * @when get a runtime version for the given block hash
@@ -192,8 +388,10 @@ namespace kagome::api {
     auto runtime_core = std::make_shared<CoreMock>();
     auto metadata = std::make_shared<MetadataMock>();
 
+    auto clock = std::make_shared<SteadyClockMock>();
+
     api::StateApiImpl api{
-        block_header_repo, storage, block_tree, runtime_core, metadata};
+        block_header_repo, storage, block_tree, runtime_core, metadata, clock};
 
     primitives::Version test_version{.spec_name = "dummy_sn",
                                      .impl_name = "dummy_in",
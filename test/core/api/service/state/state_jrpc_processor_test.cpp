@@ -28,7 +28,11 @@ class StateJrpcProcessorTest : public testing::Test {
     kCallType_SubscribeRuntimeVersion,
     kCallType_UnsubscribeRuntimeVersion,
     kCallType_GetKeysPaged,
+    kCallType_GetPairs,
+    kCallType_GetPairsPaged,
     kCallType_GetStorage,
+    kCallType_QueryStorage,
+    kCallType_QueryStorageAt,
     kCallType_StorageSubscribe,
     kCallType_StorageUnsubscribe,
     kCallType_GetMetadata,
@@ -74,6 +78,16 @@ class StateJrpcProcessorTest : public testing::Test {
           call_contexts_.emplace(std::make_pair(
               CallType::kCallType_GetKeysPaged, CallContext{.handler = f}));
         }));
+    EXPECT_CALL(*server, registerHandler("state_getPairs", _))
+        .WillOnce(testing::Invoke([&](auto &name, auto &&f) {
+          call_contexts_.emplace(std::make_pair(CallType::kCallType_GetPairs,
+                                                CallContext{.handler = f}));
+        }));
+    EXPECT_CALL(*server, registerHandler("state_getPairsPaged", _))
+        .WillOnce(testing::Invoke([&](auto &name, auto &&f) {
+          call_contexts_.emplace(std::make_pair(
+              CallType::kCallType_GetPairsPaged, CallContext{.handler = f}));
+        }));
     EXPECT_CALL(*server, registerHandler("state_getStorage", _))
         .WillOnce(testing::Invoke([&](auto &name, auto &&f) {
           call_contexts_.emplace(std::make_pair(CallType::kCallType_GetStorage,
@@ -84,6 +98,16 @@ class StateJrpcProcessorTest : public testing::Test {
           call_contexts_.emplace(std::make_pair(CallType::kCallType_GetStorage,
                                                 CallContext{.handler = f}));
         }));
+    EXPECT_CALL(*server, registerHandler("state_queryStorage", _))
+        .WillOnce(testing::Invoke([&](auto &name, auto &&f) {
+          call_contexts_.emplace(std::make_pair(
+              CallType::kCallType_QueryStorage, CallContext{.handler = f}));
+        }));
+    EXPECT_CALL(*server, registerHandler("state_queryStorageAt", _))
+        .WillOnce(testing::Invoke([&](auto &name, auto &&f) {
+          call_contexts_.emplace(std::make_pair(
+              CallType::kCallType_QueryStorageAt, CallContext{.handler = f}));
+        }));
     EXPECT_CALL(*server, registerHandler("state_subscribeStorage", _))
         .WillOnce(testing::Invoke([&](auto &name, auto &&f) {
           call_contexts_.emplace(std::make_pair(
@@ -168,6 +192,65 @@ TEST_F(StateJrpcProcessorTest, InvalidParams) {
                jsonrpc::InvalidParametersFault);
 }
 
+/**
+ * @given a request of state_getPairsPaged with prefix, amount and prev_key
+ * @when processing it
+ * @then the request is successfully processed @and the response contains
+ * key-value pairs
+ */
+TEST_F(StateJrpcProcessorTest, ProcessGetPairsPagedRequest) {
+  EXPECT_CALL(*state_api,
+              getPairsPaged(boost::make_optional("01"_hex2buf),
+                            2,
+                            boost::make_optional("0102"_hex2buf),
+                            boost::optional<kagome::primitives::BlockHash>{}))
+      .WillOnce(testing::Return(StateApiMock::KeyValuePairs{
+          {"0103"_hex2buf, "AB"_hex2buf}, {"0104"_hex2buf, "CD"_hex2buf}}));
+
+  registerHandlers();
+
+  jsonrpc::Request::Parameters params{"0x01", 2, "0x0102"};
+  auto result = execute(CallType::kCallType_GetPairsPaged, params).AsArray();
+  ASSERT_EQ(result.size(), 2);
+  ASSERT_EQ(result[0].AsArray()[0].AsString(), "0x0103");
+  ASSERT_EQ(result[0].AsArray()[1].AsString(), "0xab");
+  ASSERT_EQ(result[1].AsArray()[0].AsString(), "0x0104");
+  ASSERT_EQ(result[1].AsArray()[1].AsString(), "0xcd");
+}
+
+/**
+ * @given a request of state_queryStorageAt with keys and block hash
+ * @when processing it
+ * @then the request is successfully processed @and the response contains the
+ * block and values of the keys, missing values are null
+ */
+TEST_F(StateJrpcProcessorTest, ProcessQueryStorageAtRequest) {
+  kagome::primitives::StorageChangeSet change_set{
+      "010203"_hash256, {{"01"_hex2buf, "ABCD"_hex2buf}, {"02"_hex2buf, {}}}};
+
+  EXPECT_CALL(*state_api,
+              queryStorageAt(std::vector{"01"_hex2buf, "02"_hex2buf},
+                             boost::make_optional("010203"_hash256)))
+      .WillOnce(testing::Return(std::vector{change_set}));
+
+  registerHandlers();
+
+  jsonrpc::Request::Parameters params{
+      jsonrpc::Value::Array{"0x01", "0x02"},
+      "0x" + ("010203"_hash256).toHex()};
+  auto result = execute(CallType::kCallType_QueryStorageAt, params).AsArray();
+  ASSERT_EQ(result.size(), 1);
+  auto &result_set = result[0].AsStruct();
+  ASSERT_EQ(result_set.at("block").AsString(),
+            "0x" + ("010203"_hash256).toHex());
+  auto &changes = result_set.at("changes").AsArray();
+  ASSERT_EQ(changes.size(), 2);
+  ASSERT_EQ(changes[0].AsArray()[0].AsString(), "0x01");
+  ASSERT_EQ(changes[0].AsArray()[1].AsString(), "0xabcd");
+  ASSERT_EQ(changes[1].AsArray()[0].AsString(), "0x02");
+  ASSERT_TRUE(changes[1].AsArray()[1].IsNil());
+}
+
 /**
  * @given a request of state_getRuntimeVersion with a valid param
  * @when processing it
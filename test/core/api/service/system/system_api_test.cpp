@@ -47,7 +47,8 @@ class SystemApiTest : public ::testing::Test {
                                                   peer_manager_mock_,
                                                   account_nonce_api_mock_,
                                                   transaction_pool_mock_,
-                                                  hasher_mock_);
+                                                  hasher_mock_,
+                                                  nullptr);
   }
 
  protected:
@@ -5,6 +5,8 @@
 
 #include "core/api/transport/listener_test.hpp"
 
+#include <mutex>
+
 #include "api/transport/impl/ws/ws_listener_impl.hpp"
 #include "core/api/client/ws_client.hpp"
 
@@ -43,3 +45,77 @@ TEST_F(WsListenerTest, EchoSuccess) {
   ASSERT_NO_THROW(service->stop());
   ASSERT_NO_THROW(listener->start());
 }
+
+/**
+ * @given websocket transport with a small outbound queue, which answers the
+ * requests later than they are read
+ * @when a client sends many requests without reading the responses
+ * @then the session stops reading requests when the requests waiting for
+ * responses reach the limit, and reads the rest of them as the responses are
+ * written
+ */
+TEST_F(WsListenerTest, StopsReadingWhenClientDoesNotRead) {
+  constexpr size_t kRequests = 100;
+  session_config.outbound.max_messages = 4;
+  auto listener = std::make_shared<WsListenerImpl>(
+      app_state_manager, main_context, listener_config, session_config);
+
+  std::mutex mutex;
+  std::vector<SessionPtr> unanswered;
+  listener->setHandlerForNewSession([&](const SessionPtr &session) {
+    session->connectOnRequest(
+        [&](std::string_view, std::shared_ptr<Session> session) {
+          std::lock_guard lock(mutex);
+          unanswered.emplace_back(std::move(session));
+        });
+  });
+  auto count_unanswered = [&] {
+    std::lock_guard lock(mutex);
+    return unanswered.size();
+  };
+  auto take_unanswered = [&] {
+    std::lock_guard lock(mutex);
+    return std::exchange(unanswered, {});
+  };
+  ASSERT_TRUE(listener->prepare());
+  ASSERT_TRUE(listener->start());
+  std::thread server_thread([this] { main_context->run(); });
+
+  boost::beast::websocket::stream<Socket> client(*client_context);
+  client.next_layer().connect(listener_config.endpoint);
+  client.handshake(listener_config.endpoint.address().to_string(), "/");
+  for (size_t i = 0; i < kRequests; ++i) {
+    client.write(boost::asio::buffer(request));
+  }
+
+  size_t read_requests;
+  do {
+    read_requests = count_unanswered();
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+  } while (count_unanswered() != read_requests);
+  EXPECT_EQ(read_requests, session_config.outbound.max_messages);
+
+  boost::beast::flat_buffer buffer;
+  size_t responses = 0;
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (responses < kRequests
+         and std::chrono::steady_clock::now() < deadline) {
+    auto sessions = take_unanswered();
+    for (auto &session : sessions) {
+      session->respond(response);
+    }
+    for (size_t i = 0; i < sessions.size(); ++i) {
+      client.read(buffer);
+      buffer.consume(buffer.size());
+    }
+    responses += sessions.size();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(responses, kRequests);
+
+  client.close(boost::beast::websocket::close_code::normal);
+  listener->stop();
+  main_context->stop();
+  server_thread.join();
+}
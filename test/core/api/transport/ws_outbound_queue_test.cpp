@@ -0,0 +1,176 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/transport/impl/ws/ws_outbound_queue.hpp"
+
+#include <gtest/gtest.h>
+
+using kagome::api::WsOutboundConfig;
+using kagome::api::WsOutboundQueue;
+using OverflowPolicy = WsOutboundConfig::OverflowPolicy;
+
+namespace {
+  WsOutboundConfig makeConfig(OverflowPolicy policy,
+                              size_t max_messages,
+                              size_t max_bytes = 1024) {
+    WsOutboundConfig config;
+    config.max_messages = max_messages;
+    config.max_bytes = max_bytes;
+    config.overflow_policy = policy;
+    return config;
+  }
+}  // namespace
+
+/**
+ * @given queue dropping the oldest notifications on overflow
+ * @when more notifications than the queue holds are pushed
+ * @then the oldest notification is dropped @and the rest are kept in order
+ */
+TEST(WsOutboundQueueTest, DropOldest) {
+  WsOutboundQueue queue{makeConfig(OverflowPolicy::kDropOldest, 2)};
+
+  ASSERT_EQ(queue.pushNotification("n1", "k").dropped, 0);
+  ASSERT_EQ(queue.pushNotification("n2", "k").dropped, 0);
+  auto result = queue.pushNotification("n3", "k");
+
+  ASSERT_EQ(result.dropped, 1);
+  ASSERT_FALSE(result.coalesced);
+  ASSERT_FALSE(result.overflown);
+  ASSERT_EQ(queue.size(), 2);
+  ASSERT_EQ(queue.bytes(), 4);
+  ASSERT_EQ(queue.pop(), "n2");
+  ASSERT_EQ(queue.pop(), "n3");
+}
+
+/**
+ * @given queue dropping the oldest notifications on overflow
+ * @when queue is exceeded by size of messages
+ * @then as many oldest notifications are dropped as needed to fit the size
+ */
+TEST(WsOutboundQueueTest, DropOldestByBytes) {
+  WsOutboundQueue queue{makeConfig(OverflowPolicy::kDropOldest, 10, 6)};
+
+  queue.pushNotification("n1", {});
+  queue.pushNotification("n2", {});
+  auto result = queue.pushNotification("n3-n3", {});
+
+  ASSERT_EQ(result.dropped, 2);
+  ASSERT_EQ(queue.size(), 1);
+  ASSERT_EQ(queue.bytes(), 5);
+  ASSERT_EQ(queue.pop(), "n3-n3");
+}
+
+/**
+ * @given queue dropping the oldest notifications on overflow, filled with
+ * responses
+ * @when notification is pushed
+ * @then responses are kept @and the notification is dropped
+ */
+TEST(WsOutboundQueueTest, ResponsesAreNotDropped) {
+  WsOutboundQueue queue{makeConfig(OverflowPolicy::kDropOldest, 2)};
+
+  queue.pushResponse("r1");
+  queue.pushResponse("r2");
+  auto result = queue.pushNotification("n1", {});
+
+  ASSERT_EQ(result.dropped, 1);
+  ASSERT_EQ(queue.pop(), "r1");
+  ASSERT_EQ(queue.pop(), "r2");
+  ASSERT_TRUE(queue.empty());
+}
+
+/**
+ * @given queue coalescing notifications on overflow
+ * @when notification with the key of a queued one is pushed
+ * @then the queued notification is replaced in its place
+ */
+TEST(WsOutboundQueueTest, Coalesce) {
+  WsOutboundQueue queue{makeConfig(OverflowPolicy::kCoalesce, 4)};
+
+  queue.pushNotification("a1", "a");
+  queue.pushNotification("b1", "b");
+  auto result = queue.pushNotification("a2-a2", "a");
+
+  ASSERT_TRUE(result.coalesced);
+  ASSERT_EQ(result.dropped, 0);
+  ASSERT_EQ(queue.size(), 2);
+  ASSERT_EQ(queue.bytes(), 7);
+  ASSERT_EQ(queue.pop(), "a2-a2");
+  ASSERT_EQ(queue.pop(), "b1");
+}
+
+/**
+ * @given queue coalescing notifications on overflow
+ * @when the queue overflows with notifications of different keys
+ * @then the oldest notification is dropped
+ */
+TEST(WsOutboundQueueTest, CoalesceDropsOldestWithoutMatch) {
+  WsOutboundQueue queue{makeConfig(OverflowPolicy::kCoalesce, 2)};
+
+  queue.pushNotification("a1", "a");
+  queue.pushNotification("b1", "b");
+  auto result = queue.pushNotification("c1", "c");
+
+  ASSERT_FALSE(result.coalesced);
+  ASSERT_EQ(result.dropped, 1);
+  ASSERT_EQ(queue.pop(), "b1");
+  ASSERT_EQ(queue.pop(), "c1");
+}
+
+/**
+ * @given queue dropping the oldest notifications on overflow
+ * @when notification with the key of a queued one is pushed
+ * @then both notifications are queued
+ */
+TEST(WsOutboundQueueTest, OnlyCoalescePolicyCoalesces) {
+  WsOutboundQueue queue{makeConfig(OverflowPolicy::kDropOldest, 4)};
+
+  queue.pushNotification("a1", "a");
+  auto result = queue.pushNotification("a2", "a");
+
+  ASSERT_FALSE(result.coalesced);
+  ASSERT_EQ(queue.size(), 2);
+}
+
+/**
+ * @given queue disconnecting the session on overflow
+ * @when more notifications than the queue holds are pushed
+ * @then overflow is reported @and the queue is cleared
+ */
+TEST(WsOutboundQueueTest, Disconnect) {
+  WsOutboundQueue queue{makeConfig(OverflowPolicy::kDisconnect, 2)};
+
+  ASSERT_FALSE(queue.pushNotification("n1", "k").overflown);
+  ASSERT_FALSE(queue.pushNotification("n2", "k").overflown);
+  auto result = queue.pushNotification("n3", "k");
+
+  ASSERT_TRUE(result.overflown);
+  ASSERT_EQ(result.dropped, 0);
+  ASSERT_TRUE(queue.empty());
+  ASSERT_EQ(queue.bytes(), 0);
+}
+
+/**
+ * @given queue of a session
+ * @when responses reach the limit of the queue
+ * @then the queue is full, which stops reading of requests @and it is no
+ * longer full once a message is written
+ */
+TEST(WsOutboundQueueTest, FullQueuePausesReading) {
+  WsOutboundQueue queue{makeConfig(OverflowPolicy::kCoalesce, 2)};
+
+  queue.pushResponse("r1");
+  ASSERT_FALSE(queue.isFull());
+  queue.pushResponse("r2");
+  ASSERT_TRUE(queue.isFull());
+
+  queue.pushResponse("r3");
+  ASSERT_EQ(queue.size(), 3);
+
+  queue.pop();
+  ASSERT_TRUE(queue.isFull());
+  queue.pop();
+  ASSERT_FALSE(queue.isFull());
+}
@@ -7,8 +7,10 @@
 
 #include <gtest/gtest.h>
 
+#include "authorship/impl/block_builder_error.hpp"
 #include "mock/core/authorship/block_builder_factory_mock.hpp"
 #include "mock/core/authorship/block_builder_mock.hpp"
+#include "mock/core/clock/clock_mock.hpp"
 #include "mock/core/runtime/block_builder_api_mock.hpp"
 #include "mock/core/transaction_pool/transaction_pool_mock.hpp"
 #include "primitives/event_types.hpp"
@@ -18,13 +20,18 @@
 #include "testutil/prepare_loggers.hpp"
 
 using ::testing::_;
+using ::testing::InSequence;
+using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::Test;
 
 using kagome::authorship::BlockBuilder;
 using kagome::authorship::BlockBuilderFactoryMock;
+using kagome::authorship::BlockBuilderError;
 using kagome::authorship::BlockBuilderMock;
 using kagome::authorship::ProposerImpl;
+using kagome::clock::SystemClock;
+using kagome::clock::SystemClockMock;
 using kagome::common::Buffer;
 using kagome::primitives::Block;
 using kagome::primitives::BlockId;
@@ -38,6 +45,7 @@ using kagome::primitives::Transaction;
 using kagome::primitives::events::ExtrinsicSubscriptionEngine;
 using kagome::runtime::BlockBuilderApiMock;
 using kagome::subscription::ExtrinsicEventKeyRepository;
+using kagome::transaction_pool::TransactionPool;
 using kagome::transaction_pool::TransactionPoolMock;
 
 // TODO (kamilsa): workaround unless we bump gtest version to 1.8.1+
@@ -69,6 +77,37 @@ class ProposerTest : public ::testing::Test {
 
     EXPECT_CALL(*block_builder_api_mock_, inherent_extrinsics(inherent_data_))
         .WillOnce(Return(inherent_xts));
+
+    ON_CALL(*clock_, now()).WillByDefault(Return(now_));
+  }
+
+  /**
+   * Makes ready transaction with unique extrinsic
+   */
+  static std::shared_ptr<Transaction> makeTransaction(
+      const Transaction::Hash &hash,
+      uint8_t id,
+      Transaction::Priority priority,
+      std::vector<Transaction::Tag> requires = {},
+      std::vector<Transaction::Tag> provides = {}) {
+    auto tx = std::make_shared<Transaction>();
+    tx->hash = hash;
+    tx->ext = Extrinsic{{id}};
+    tx->priority = priority;
+    tx->requires = std::move(requires);
+    tx->provides = std::move(provides);
+    return tx;
+  }
+
+  /**
+   * Makes TransactionPool return given ready transactions in the given order,
+   * which is the order of their priority
+   */
+  void expectReadyTransactions(
+      std::vector<std::shared_ptr<Transaction>> ready_transactions) {
+    EXPECT_CALL(*transaction_pool_, getBestReadyTransactions())
+        .WillOnce(Return(std::vector<std::shared_ptr<const Transaction>>(
+            ready_transactions.begin(), ready_transactions.end())));
   }
 
  protected:
@@ -82,6 +121,8 @@ class ProposerTest : public ::testing::Test {
       std::make_shared<ExtrinsicSubscriptionEngine>();
   std::shared_ptr<ExtrinsicEventKeyRepository> extrinsic_event_key_repo_ =
       std::make_shared<ExtrinsicEventKeyRepository>();
+  std::shared_ptr<SystemClockMock> clock_ =
+      std::make_shared<NiceMock<SystemClockMock>>();
 
   BlockBuilderMock *block_builder_;
 
@@ -89,7 +130,12 @@ class ProposerTest : public ::testing::Test {
                          transaction_pool_,
                          block_builder_api_mock_,
                          extrinsic_sub_engine_,
-                         extrinsic_event_key_repo_};
+                         extrinsic_event_key_repo_,
+                         clock_,
+                         ProposerImpl::Configuration{}};
+
+  SystemClock::TimePoint now_{std::chrono::seconds(1000)};
+  SystemClock::TimePoint deadline_ = now_ + std::chrono::seconds(1);
 
   BlockNumber expected_number_{42};
   BlockId expected_block_id_{expected_number_};
@@ -115,21 +161,18 @@ TEST_F(ProposerTest, CreateBlockSuccess) {
       .WillOnce(Return(outcome::success()))
       .WillOnce(Return(outcome::success()));
 
-  // getReadyTransaction will return vector with single transaction
-  std::map<Transaction::Hash, std::shared_ptr<Transaction>> ready_transactions{
-      std::make_pair("fakeHash"_hash256, std::make_shared<Transaction>())};
+  // TransactionPool has a single ready transaction
+  expectReadyTransactions({makeTransaction("fakeHash"_hash256, 1, 0)});
 
-  EXPECT_CALL(*transaction_pool_, getReadyTransactions())
-      .WillOnce(Return(ready_transactions));
-
-  EXPECT_CALL(*transaction_pool_, removeOne("fakeHash"_hash256))
-      .WillOnce(Return(outcome::success()));
+  // included transaction is removed from the pool only on block import
+  EXPECT_CALL(*transaction_pool_, removeOne(_)).Times(0);
 
   EXPECT_CALL(*block_builder_, bake()).WillOnce(Return(expected_block));
 
   // when
   auto block_res =
-      proposer_.propose(expected_number_, inherent_data_, inherent_digests_);
+      proposer_.propose(
+          expected_number_, inherent_data_, inherent_digests_, deadline_);
 
   // then
   ASSERT_TRUE(block_res);
@@ -150,7 +193,8 @@ TEST_F(ProposerTest, CreateBlockFailsWhenXtNotPushed) {
 
   // when
   auto block_res =
-      proposer_.propose(expected_number_, inherent_data_, inherent_digests_);
+      proposer_.propose(
+          expected_number_, inherent_data_, inherent_digests_, deadline_);
 
   // then
   ASSERT_FALSE(block_res);
@@ -176,17 +220,191 @@ TEST_F(ProposerTest, PushFailed) {
                                            // Error: Success though
   EXPECT_CALL(*block_builder_, bake()).WillOnce(Return(expected_block));
 
-  std::map<Transaction::Hash, std::shared_ptr<Transaction>> ready_transactions{
-      std::make_pair("fakeHash"_hash256, std::make_shared<Transaction>())};
+  expectReadyTransactions({makeTransaction("fakeHash"_hash256, 1, 0)});
 
   EXPECT_CALL(*transaction_pool_, removeOne("fakeHash"_hash256))
       .WillOnce(Return(Transaction{}));
-  EXPECT_CALL(*transaction_pool_, getReadyTransactions())
-      .WillOnce(Return(ready_transactions));
 
   // when
   auto block_res =
-      proposer_.propose(expected_number_, inherent_data_, inherent_digests_);
+      proposer_.propose(
+          expected_number_, inherent_data_, inherent_digests_, deadline_);
+
+  // then
+  ASSERT_TRUE(block_res);
+}
+
+/**
+ * @given TransactionPool returning transactions of different priorities, one
+ * of them requires tag provided by transaction of the lowest priority
+ * @when Proposer creates block
+ * @then transactions are pushed in order of priority, but dependent one is
+ * pushed only after transaction it depends on
+ */
+TEST_F(ProposerTest, PushesByPriorityRespectingDependencies) {
+  // given
+  Transaction::Tag tag{1};
+  auto provider = makeTransaction("provider"_hash256, 1, 1, {}, {tag});
+  auto dependent = makeTransaction("dependent"_hash256, 2, 10, {tag}, {});
+  auto independent = makeTransaction("independent"_hash256, 3, 5);
+
+  expectReadyTransactions({dependent, independent, provider});
+
+  {
+    InSequence s;
+    EXPECT_CALL(*block_builder_, pushExtrinsic(inherent_xts[0]))
+        .WillOnce(Return(outcome::success()));
+    EXPECT_CALL(*block_builder_, pushExtrinsic(independent->ext))
+        .WillOnce(Return(outcome::success()));
+    EXPECT_CALL(*block_builder_, pushExtrinsic(provider->ext))
+        .WillOnce(Return(outcome::success()));
+    EXPECT_CALL(*block_builder_, pushExtrinsic(dependent->ext))
+        .WillOnce(Return(outcome::success()));
+  }
+  EXPECT_CALL(*block_builder_, bake()).WillOnce(Return(expected_block));
+
+  EXPECT_CALL(*transaction_pool_, removeOne(_)).Times(0);
+
+  // when
+  auto block_res = proposer_.propose(
+      expected_number_, inherent_data_, inherent_digests_, deadline_);
+
+  // then
+  ASSERT_TRUE(block_res);
+}
+
+/**
+ * @given TransactionPool returning transactions in order of priority, the
+ * best of them requires tag provided by transaction of lower priority
+ * @when Proposer creates block
+ * @then dependent transaction is pushed right after the one it depends on,
+ * before the rest of transactions of lower priority
+ */
+TEST_F(ProposerTest, UnblockedTransactionPrecedesWorseOnes) {
+  // given
+  Transaction::Tag tag{1};
+  auto dependent = makeTransaction("dependent"_hash256, 1, 10, {tag}, {});
+  auto provider = makeTransaction("provider"_hash256, 2, 5, {}, {tag});
+  auto worst = makeTransaction("worst"_hash256, 3, 1);
+
+  expectReadyTransactions({dependent, provider, worst});
+
+  {
+    InSequence s;
+    EXPECT_CALL(*block_builder_, pushExtrinsic(inherent_xts[0]))
+        .WillOnce(Return(outcome::success()));
+    EXPECT_CALL(*block_builder_, pushExtrinsic(provider->ext))
+        .WillOnce(Return(outcome::success()));
+    EXPECT_CALL(*block_builder_, pushExtrinsic(dependent->ext))
+        .WillOnce(Return(outcome::success()));
+    EXPECT_CALL(*block_builder_, pushExtrinsic(worst->ext))
+        .WillOnce(Return(outcome::success()));
+  }
+  EXPECT_CALL(*block_builder_, bake()).WillOnce(Return(expected_block));
+
+  EXPECT_CALL(*transaction_pool_, removeOne(_)).Times(0);
+
+  // when
+  auto block_res = proposer_.propose(
+      expected_number_, inherent_data_, inherent_digests_, deadline_);
+
+  // then
+  ASSERT_TRUE(block_res);
+}
+
+/**
+ * @given TransactionPool returning transactions
+ * @when Proposer creates block @and deadline is reached before transactions
+ * are pushed
+ * @then block is baked without transactions of the pool, and they stay in the
+ * pool
+ */
+TEST_F(ProposerTest, StopsAtDeadline) {
+  // given
+  expectReadyTransactions({makeTransaction("fakeHash"_hash256, 1, 1)});
+  EXPECT_CALL(*clock_, now())
+      .WillOnce(Return(now_))
+      .WillRepeatedly(Return(deadline_));
+
+  EXPECT_CALL(*block_builder_, pushExtrinsic(inherent_xts[0]))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*block_builder_, bake()).WillOnce(Return(expected_block));
+  EXPECT_CALL(*transaction_pool_, removeOne(_)).Times(0);
+
+  // when
+  auto block_res = proposer_.propose(
+      expected_number_, inherent_data_, inherent_digests_, deadline_);
+
+  // then
+  ASSERT_TRUE(block_res);
+}
+
+/**
+ * @given TransactionPool returning transactions
+ * @when Proposer creates block @and runtime reports the block is full for one
+ * of transactions
+ * @then that transaction stays in the pool, while the rest are included
+ */
+TEST_F(ProposerTest, TransactionNotFittingBlockStaysInPool) {
+  // given
+  auto heavy = makeTransaction("heavy"_hash256, 1, 10);
+  auto light = makeTransaction("light"_hash256, 2, 1);
+  expectReadyTransactions({heavy, light});
+
+  EXPECT_CALL(*block_builder_, pushExtrinsic(inherent_xts[0]))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*block_builder_, pushExtrinsic(heavy->ext))
+      .WillOnce(Return(outcome::failure(BlockBuilderError::BLOCK_IS_FULL)));
+  EXPECT_CALL(*block_builder_, pushExtrinsic(light->ext))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*block_builder_, bake()).WillOnce(Return(expected_block));
+
+  EXPECT_CALL(*transaction_pool_, removeOne(_)).Times(0);
+
+  // when
+  auto block_res = proposer_.propose(
+      expected_number_, inherent_data_, inherent_digests_, deadline_);
+
+  // then
+  ASSERT_TRUE(block_res);
+}
+
+/**
+ * @given Proposer configured with block size limit fitting inherent
+ * extrinsics and one more byte
+ * @when Proposer creates block of ready transactions of one and two bytes
+ * @then the transaction exceeding the limit stays in the pool, while the
+ * fitting one is included
+ */
+TEST_F(ProposerTest, TransactionExceedingSizeLimitStaysInPool) {
+  // given
+  ProposerImpl::Configuration config;
+  config.block_size_limit = inherent_xts[0].data.size() + 1;
+  ProposerImpl proposer{block_builder_factory_,
+                        transaction_pool_,
+                        block_builder_api_mock_,
+                        extrinsic_sub_engine_,
+                        extrinsic_event_key_repo_,
+                        clock_,
+                        config};
+
+  auto large = makeTransaction("large"_hash256, 1, 10);
+  large->ext.data.putUint8(1);
+  auto small = makeTransaction("small"_hash256, 2, 1);
+  expectReadyTransactions({large, small});
+
+  EXPECT_CALL(*block_builder_, pushExtrinsic(inherent_xts[0]))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*block_builder_, pushExtrinsic(large->ext)).Times(0);
+  EXPECT_CALL(*block_builder_, pushExtrinsic(small->ext))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*block_builder_, bake()).WillOnce(Return(expected_block));
+
+  EXPECT_CALL(*transaction_pool_, removeOne(_)).Times(0);
+
+  // when
+  auto block_res = proposer.propose(
+      expected_number_, inherent_data_, inherent_digests_, deadline_);
 
   // then
   ASSERT_TRUE(block_res);
@@ -7,10 +7,12 @@
 
 #include <gtest/gtest.h>
 #include "blockchain/impl/common.hpp"
+#include "crypto/hasher/hasher_impl.hpp"
 #include "mock/core/crypto/hasher_mock.hpp"
 #include "mock/core/storage/persistent_map_mock.hpp"
 #include "scale/scale.hpp"
 #include "storage/database_error.hpp"
+#include "storage/in_memory/in_memory_storage.hpp"
 #include "testutil/outcome.hpp"
 #include "testutil/prepare_loggers.hpp"
 
@@ -24,6 +26,7 @@ using kagome::primitives::BlockHash;
 using kagome::primitives::BlockHeader;
 using kagome::primitives::BlockNumber;
 using kagome::scale::encode;
+using kagome::storage::kCanonicalNumberIndexLookupKey;
 using kagome::storage::face::GenericStorageMock;
 using kagome::storage::trie::RootHash;
 using testing::_;
@@ -119,12 +122,56 @@ TEST_F(BlockStorageTest, LoadFromExistingStorage) {
       // getting header of last finalized block
       .WillOnce(Return(Buffer{}))
       .WillOnce(Return(Buffer{kagome::scale::encode(BlockHeader{}).value()}));
+  // the number index has been made canonical before
+  EXPECT_CALL(*storage, contains(kCanonicalNumberIndexLookupKey))
+      .WillOnce(Return(true));
 
   auto new_block_storage_res =
       KeyValueBlockStorage::loadExisting(storage, hasher, block_handler);
   EXPECT_TRUE(new_block_storage_res.has_value());
 }
 
+/**
+ * @given storage written by an older node, which number index points to a
+ * block of a fork instead of the one of the finalized chain
+ * @when initialising a block storage from it
+ * @then the number is assigned back to the block of the finalized chain
+ */
+TEST_F(BlockStorageTest, LoadReindexesStaleForkNumber) {
+  auto in_memory_storage = std::make_shared<kagome::storage::InMemoryStorage>();
+  auto real_hasher = std::make_shared<kagome::crypto::HasherImpl>();
+  EXPECT_OUTCOME_TRUE(block_storage,
+                      KeyValueBlockStorage::createWithGenesis(
+                          root_hash, in_memory_storage, real_hasher,
+                          block_handler));
+  EXPECT_OUTCOME_TRUE(genesis_hash, block_storage->getGenesisBlockHash());
+
+  // the fork block is added last, so the number index points to it
+  BlockHeader canonical{.parent_hash = genesis_hash, .number = 1};
+  BlockHeader fork{
+      .parent_hash = genesis_hash, .number = 1, .state_root = root_hash};
+  EXPECT_OUTCOME_TRUE(canonical_hash, block_storage->putBlockHeader(canonical));
+  EXPECT_OUTCOME_TRUE_1(block_storage->putBlockHeader(fork));
+  BlockHeader finalized{.parent_hash = canonical_hash, .number = 2};
+  EXPECT_OUTCOME_TRUE(finalized_hash, block_storage->putBlockHeader(finalized));
+  EXPECT_OUTCOME_TRUE_1(
+      block_storage->setLastFinalizedBlockHash(finalized_hash));
+  EXPECT_OUTCOME_TRUE_1(
+      in_memory_storage->remove(kCanonicalNumberIndexLookupKey));
+  EXPECT_OUTCOME_TRUE(stale_header,
+                      block_storage->getBlockHeader(BlockNumber{1}));
+  ASSERT_EQ(stale_header, fork);
+
+  EXPECT_OUTCOME_TRUE(
+      loaded_storage,
+      KeyValueBlockStorage::loadExisting(
+          in_memory_storage, real_hasher, block_handler));
+
+  EXPECT_OUTCOME_TRUE(header, loaded_storage->getBlockHeader(BlockNumber{1}));
+  ASSERT_EQ(header, canonical);
+  ASSERT_TRUE(in_memory_storage->contains(kCanonicalNumberIndexLookupKey));
+}
+
 /**
  * @given a hasher instance and an empty map storage
  * @when trying to initialise a block storage from it and storage throws an
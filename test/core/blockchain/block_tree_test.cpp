@@ -22,6 +22,7 @@
 #include "primitives/block_id.hpp"
 #include "primitives/justification.hpp"
 #include "scale/scale.hpp"
+#include "testutil/literals.hpp"
 #include "testutil/outcome.hpp"
 #include "testutil/prepare_loggers.hpp"
 
@@ -55,6 +56,11 @@ struct BlockTreeTest : public testing::Test {
     EXPECT_CALL(*header_repo_, getHashByNumber(kFinalizedBlockInfo.number))
         .WillRepeatedly(Return(kFinalizedBlockInfo.hash));
 
+    EXPECT_CALL(*storage_, getEpochDigests(kFinalizedBlockInfo.hash))
+        .WillOnce(Return(boost::optional<EpochDigests>{}));
+    EXPECT_CALL(*storage_, putEpochDigests(kFinalizedBlockInfo.hash, _))
+        .WillOnce(Return(outcome::success()));
+
     auto chain_events_engine =
         std::make_shared<primitives::events::ChainSubscriptionEngine>();
     auto ext_events_engine =
@@ -247,8 +253,12 @@ TEST_F(BlockTreeTest, Finalize) {
       .WillOnce(Return(outcome::failure(boost::system::error_code{})));
   EXPECT_CALL(*storage_, putJustification(justification, hash, header.number))
       .WillRepeatedly(Return(outcome::success()));
+  EXPECT_CALL(*storage_, assignNumberToHash(BlockInfo{header.number, hash}))
+      .WillOnce(Return(outcome::success()));
   EXPECT_CALL(*storage_, setLastFinalizedBlockHash(hash))
       .WillRepeatedly(Return(outcome::success()));
+  EXPECT_CALL(*storage_, putEpochDigests(hash, _))
+      .WillOnce(Return(outcome::success()));
   EXPECT_CALL(*storage_, getBlockHeader(bid))
       .WillRepeatedly(Return(outcome::success(header)));
   EXPECT_CALL(*storage_, getBlockBody(bid))
@@ -261,6 +271,8 @@ TEST_F(BlockTreeTest, Finalize) {
 
   // THEN
   ASSERT_EQ(block_tree_->getLastFinalized().hash, hash);
+  ASSERT_TRUE(block_tree_->getEpochDescriptor(0, hash));
+  ASSERT_FALSE(block_tree_->getEpochDescriptor(0, kFinalizedBlockInfo.hash));
 }
 
 /**
@@ -438,3 +450,149 @@ TEST_F(BlockTreeTest, GetBestChain_TargetPastMax) {
   EXPECT_OUTCOME_FALSE(err, block_tree_->getBestContaining(target_hash, 42));
   ASSERT_EQ(err, BlockTreeImpl::Error::TARGET_IS_PAST_MAX);
 }
+
+/**
+ * @given a block tree with a long chain and a fork of it
+ * @when checking if there is a direct chain between the blocks of the tree
+ * @then only the blocks on the same branch make one, which is found without
+ * reading the headers
+ */
+TEST_F(BlockTreeTest, HasDirectChainInTree) {
+  std::vector<BlockHash> chain{kFinalizedBlockInfo.hash};
+  for (auto number = kFinalizedBlockInfo.number + 1;
+       number <= kFinalizedBlockInfo.number + 40;
+       ++number) {
+    chain.push_back(addHeaderToRepository(chain.back(), number));
+  }
+  BlockHeader fork_header{.parent_hash = chain[10],
+                          .number = kFinalizedBlockInfo.number + 11};
+  auto fork_hash = addBlock(Block{fork_header, {{Buffer{0x11}}}});
+  EXPECT_CALL(*header_repo_, getBlockHeader(_)).Times(0);
+
+  for (size_t i = 0; i < chain.size(); ++i) {
+    for (size_t j = 0; j < chain.size(); ++j) {
+      ASSERT_EQ(block_tree_->hasDirectChain(chain[i], chain[j]), i <= j);
+    }
+    ASSERT_EQ(block_tree_->hasDirectChain(chain[i], fork_hash), i <= 10);
+    ASSERT_FALSE(block_tree_->hasDirectChain(fork_hash, chain[i]));
+  }
+}
+
+/**
+ * @given a block tree with a long chain
+ * @when asking for a chain between two blocks of the tree
+ * @then it is made of the tree nodes without reading the headers
+ */
+TEST_F(BlockTreeTest, GetChainByBlocksInTree) {
+  std::vector<BlockHash> chain{kFinalizedBlockInfo.hash};
+  for (auto number = kFinalizedBlockInfo.number + 1;
+       number <= kFinalizedBlockInfo.number + 40;
+       ++number) {
+    chain.push_back(addHeaderToRepository(chain.back(), number));
+  }
+  EXPECT_CALL(*header_repo_, getBlockHeader(_)).Times(0);
+  EXPECT_CALL(*header_repo_, getNumberByHash(_)).Times(0);
+
+  EXPECT_OUTCOME_TRUE(whole, block_tree_->getChainByBlocks(chain[5], chain[30]))
+  ASSERT_EQ(whole,
+            std::vector<BlockHash>(chain.begin() + 5, chain.begin() + 31));
+
+  EXPECT_OUTCOME_TRUE(limited,
+                      block_tree_->getChainByBlocks(chain[5], chain[30], 10))
+  ASSERT_EQ(limited,
+            std::vector<BlockHash>(chain.begin() + 5, chain.begin() + 15));
+}
+
+/**
+ * @given a block tree and a finalized block below its root
+ * @when checking if there is a direct chain from the finalized block to a
+ * block of the tree
+ * @then it is found by the number index without reading the headers
+ */
+TEST_F(BlockTreeTest, HasDirectChainFromFinalized) {
+  auto hash = addHeaderToRepository(kLastFinalizedBlockId,
+                                    kFinalizedBlockInfo.number + 1);
+
+  BlockInfo finalized{kFinalizedBlockInfo.number - 2, "finalized"_hash256};
+  EXPECT_CALL(*header_repo_, getNumberByHash(finalized.hash))
+      .WillRepeatedly(Return(finalized.number));
+  EXPECT_CALL(*header_repo_, getHashByNumber(finalized.number))
+      .WillRepeatedly(Return(finalized.hash));
+  EXPECT_CALL(*header_repo_, getBlockHeader(_)).Times(0);
+
+  ASSERT_TRUE(block_tree_->hasDirectChain(finalized.hash, hash));
+  ASSERT_TRUE(
+      block_tree_->hasDirectChain(finalized.hash, kFinalizedBlockInfo.hash));
+  ASSERT_FALSE(
+      block_tree_->hasDirectChain(kFinalizedBlockInfo.hash, finalized.hash));
+}
+
+/**
+ * @given a block tree and two finalized blocks below its root
+ * @when asking for a chain from a finalized block to a block of the tree
+ * @then the chain is made of the number index and the tree
+ */
+TEST_F(BlockTreeTest, GetChainByBlocksFromIndex) {
+  auto hash = addHeaderToRepository(kLastFinalizedBlockId,
+                                    kFinalizedBlockInfo.number + 1);
+
+  std::vector<BlockInfo> finalized{
+      {kFinalizedBlockInfo.number - 2, "finalized0"_hash256},
+      {kFinalizedBlockInfo.number - 1, "finalized1"_hash256}};
+  for (auto &block : finalized) {
+    EXPECT_CALL(*header_repo_, getNumberByHash(block.hash))
+        .WillRepeatedly(Return(block.number));
+    EXPECT_CALL(*header_repo_, getHashByNumber(block.number))
+        .WillRepeatedly(Return(block.hash));
+  }
+  EXPECT_CALL(*header_repo_, getBlockHeader(_)).Times(0);
+
+  std::vector<BlockHash> expected_chain{
+      finalized[0].hash, finalized[1].hash, kFinalizedBlockInfo.hash, hash};
+  EXPECT_OUTCOME_TRUE(chain,
+                      block_tree_->getChainByBlocks(finalized[0].hash, hash));
+  ASSERT_EQ(chain, expected_chain);
+
+  EXPECT_OUTCOME_TRUE(
+      short_chain, block_tree_->getChainByBlocks(finalized[0].hash, hash, 3));
+  expected_chain.pop_back();
+  ASSERT_EQ(short_chain, expected_chain);
+}
+
+/**
+ * @given epoch digests saved for the last finalized block
+ * @when creating a block tree
+ * @then the digests are not looked for in the chain and are used for the
+ * blocks of the tree
+ */
+TEST_F(BlockTreeTest, CreateWithSavedEpochDigests) {
+  EpochDigests saved{.epoch_number = 7};
+  saved.epoch.randomness.fill(1);
+  saved.next_epoch.randomness.fill(2);
+  EXPECT_CALL(*storage_, getEpochDigests(kFinalizedBlockInfo.hash))
+      .WillOnce(Return(boost::make_optional(saved)));
+  EXPECT_CALL(*storage_, getBlockHeader(_)).Times(0);
+  EXPECT_CALL(*storage_, putEpochDigests(_, _)).Times(0);
+
+  EXPECT_OUTCOME_TRUE(
+      block_tree,
+      BlockTreeImpl::create(
+          header_repo_,
+          storage_,
+          kLastFinalizedBlockId,
+          extrinsic_observer_,
+          hasher_,
+          std::make_shared<primitives::events::ChainSubscriptionEngine>(),
+          std::make_shared<primitives::events::ExtrinsicSubscriptionEngine>(),
+          std::make_shared<subscription::ExtrinsicEventKeyRepository>(),
+          runtime_core_,
+          babe_config_,
+          babe_util_));
+
+  EXPECT_OUTCOME_TRUE(
+      epoch, block_tree->getEpochDescriptor(7, kFinalizedBlockInfo.hash));
+  ASSERT_EQ(epoch, saved.epoch);
+  EXPECT_OUTCOME_TRUE(
+      next_epoch, block_tree->getEpochDescriptor(8, kFinalizedBlockInfo.hash));
+  ASSERT_EQ(next_epoch, saved.next_epoch);
+}
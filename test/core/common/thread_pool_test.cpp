@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/thread_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <set>
+
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::common::ThreadPool;
+
+class ThreadPoolTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+};
+
+/**
+ * @given started thread pool
+ * @when posting a task
+ * @then the task is executed in one of threads of the pool
+ */
+TEST_F(ThreadPoolTest, ExecutesTaskInWorkerThread) {
+  ThreadPool pool("test_pool_1", 2);
+  pool.start();
+
+  std::promise<std::thread::id> executor;
+  pool.post([&executor] { executor.set_value(std::this_thread::get_id()); });
+
+  auto future = executor.get_future();
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(5)),
+            std::future_status::ready);
+  EXPECT_NE(future.get(), std::this_thread::get_id());
+  pool.stop();
+}
+
+/**
+ * @given started thread pool of several threads
+ * @when posting tasks blocking each other until all threads are busy
+ * @then all tasks are executed simultaneously in different threads
+ */
+TEST_F(ThreadPoolTest, ExecutesTasksConcurrently) {
+  constexpr size_t kThreads = 3;
+  ThreadPool pool("test_pool_2", kThreads);
+  pool.start();
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::set<std::thread::id> executors;
+  std::promise<void> done;
+  std::atomic_size_t finished{0};
+
+  for (size_t i = 0; i < kThreads; ++i) {
+    pool.post([&] {
+      std::unique_lock lock(mutex);
+      executors.emplace(std::this_thread::get_id());
+      cv.notify_all();
+      cv.wait_for(lock, std::chrono::seconds(5), [&] {
+        return executors.size() == kThreads;
+      });
+      if (++finished == kThreads) {
+        done.set_value();
+      }
+    });
+  }
+
+  ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(10)),
+            std::future_status::ready);
+  EXPECT_EQ(executors.size(), kThreads);
+  EXPECT_EQ(pool.queueSize(), 0);
+  pool.stop();
+}
+
+/**
+ * @given stopped thread pool
+ * @when posting a task
+ * @then the task is queued and executed only after start of the pool
+ */
+TEST_F(ThreadPoolTest, QueuesTasksUntilStart) {
+  ThreadPool pool("test_pool_3", 1);
+
+  std::promise<void> executed;
+  pool.post([&executed] { executed.set_value(); });
+  EXPECT_EQ(pool.queueSize(), 1);
+
+  pool.start();
+  ASSERT_EQ(executed.get_future().wait_for(std::chrono::seconds(5)),
+            std::future_status::ready);
+  pool.stop();
+}
@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 
+#include "consensus/authority/authority_manager_error.hpp"
 #include "consensus/authority/impl/schedule_node.hpp"
 #include "mock/core/application/app_state_manager_mock.hpp"
 #include "mock/core/blockchain/block_tree_mock.hpp"
@@ -14,6 +15,7 @@
 #include "mock/core/storage/persistent_map_mock.hpp"
 #include "primitives/digest.hpp"
 #include "scale/scale.hpp"
+#include "storage/database_error.hpp"
 #include "storage/predefined_keys.hpp"
 #include "testutil/literals.hpp"
 #include "testutil/outcome.hpp"
@@ -115,6 +117,11 @@ class AuthorityManagerTest : public testing::Test {
 
   static inline const auto schedulerLookupKey =
       authority::AuthorityManagerImpl::SCHEDULER_TREE;
+
+  static common::Buffer nodeLookupKey(const primitives::BlockHash &hash) {
+    return common::Buffer(AuthorityManager::SCHEDULER_NODE_PREFIX).put(hash);
+  }
+
   std::shared_ptr<application::AppStateManagerMock> app_state_manager;
   std::shared_ptr<blockchain::BlockTreeMock> block_tree;
   std::shared_ptr<StorageMock> storage;
@@ -139,6 +146,9 @@ class AuthorityManagerTest : public testing::Test {
 
     EXPECT_CALL(*storage, get(schedulerLookupKey))
         .WillOnce(Return(encoded_data));
+    // nothing is scheduled yet, so the root has no record
+    EXPECT_CALL(*storage, get(nodeLookupKey("GEN"_hash256)))
+        .WillOnce(Return(storage::DatabaseError::NOT_FOUND));
 
     authority_manager->prepare();
   }
@@ -187,6 +197,8 @@ TEST_F(AuthorityManagerTest, InitFromStorage) {
   common::Buffer encoded_data(encode_result.value());
 
   EXPECT_CALL(*storage, get(schedulerLookupKey)).WillOnce(Return(encoded_data));
+  EXPECT_CALL(*storage, get(nodeLookupKey("B"_hash256)))
+      .WillOnce(Return(storage::DatabaseError::NOT_FOUND));
 
   authority_manager->prepare();
 
@@ -224,6 +236,11 @@ TEST_F(AuthorityManagerTest, Prune) {
 
   EXPECT_CALL(*storage, put_rv(schedulerLookupKey, _))
       .WillOnce(Return(outcome::success()));
+  // the new root gets its record, the one of the old root is removed
+  EXPECT_CALL(*storage, put_rv(nodeLookupKey("D"_hash256), _))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*storage, remove(nodeLookupKey("GEN"_hash256)))
+      .WillOnce(Return(outcome::success()));
 
   EXPECT_OUTCOME_SUCCESS(finalisation_result,
                          authority_manager->prune({20, "D"_hash256}));
@@ -250,7 +267,10 @@ TEST_F(AuthorityManagerTest, OnConsensus_ScheduledChange) {
   primitives::AuthorityList new_authorities{makeAuthority("Auth1", 123)};
   uint32_t subchain_length = 10;
 
-  EXPECT_CALL(*storage, put_rv(schedulerLookupKey, _))
+  EXPECT_CALL(*storage, put_rv(nodeLookupKey(target_block.hash), _))
+      .WillOnce(Return(outcome::success()));
+  // the record of the parent node lists the new one
+  EXPECT_CALL(*storage, put_rv(nodeLookupKey("GEN"_hash256), _))
       .WillOnce(Return(outcome::success()));
   EXPECT_OUTCOME_SUCCESS(
       r1,
@@ -267,6 +287,12 @@ TEST_F(AuthorityManagerTest, OnConsensus_ScheduledChange) {
 
   EXPECT_CALL(*storage, put_rv(schedulerLookupKey, _))
       .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*storage, put_rv(nodeLookupKey("D"_hash256), _))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*storage, remove(nodeLookupKey("GEN"_hash256)))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*storage, remove(nodeLookupKey("A"_hash256)))
+      .WillOnce(Return(outcome::success()));
   EXPECT_OUTCOME_SUCCESS(finalisation_result,
                          authority_manager->prune({20, "D"_hash256}));
 
@@ -292,7 +318,10 @@ TEST_F(AuthorityManagerTest, OnConsensus_ForcedChange) {
   primitives::AuthorityList new_authorities{makeAuthority("Auth1", 123)};
   uint32_t subchain_length = 10;
 
-  EXPECT_CALL(*storage, put_rv(schedulerLookupKey, _))
+  EXPECT_CALL(*storage, put_rv(nodeLookupKey(target_block.hash), _))
+      .WillOnce(Return(outcome::success()));
+  // the record of the parent node lists the new one
+  EXPECT_CALL(*storage, put_rv(nodeLookupKey("GEN"_hash256), _))
       .WillOnce(Return(outcome::success()));
 
   EXPECT_OUTCOME_SUCCESS(
@@ -309,6 +338,26 @@ TEST_F(AuthorityManagerTest, OnConsensus_ForcedChange) {
   examine({25, "E"_hash256}, new_authorities);
 }
 
+/**
+ * @given initialized manager, storage failing to write records
+ * @when apply Consensus message
+ * @then the failure to save the schedule is returned
+ */
+TEST_F(AuthorityManagerTest, OnConsensus_SaveError) {
+  prepareAuthorityManager();
+
+  EXPECT_CALL(*storage, put_rv(nodeLookupKey("GEN"_hash256), _))
+      .WillOnce(Return(outcome::failure(testutil::DummyError::ERROR)));
+
+  EXPECT_OUTCOME_ERROR(
+      res,
+      authority_manager->onConsensus(
+          primitives::kGrandpaEngineId,
+          {10, "B"_hash256},
+          primitives::ScheduledChange({makeAuthority("Auth1", 123)}, 10)),
+      authority::AuthorityManagerError::CAN_NOT_SAVE_STATE);
+}
+
 /**
  * @given initialized manager has some state
  * @when apply Consensus message as DisableAuthority
@@ -333,7 +382,7 @@ TEST_F(AuthorityManagerTest, DISABLED_OnConsensus_DisableAuthority) {
   assert(new_authorities.size() == 3);
   new_authorities[authority_index].weight = 0;
 
-  EXPECT_CALL(*storage, put_rv(schedulerLookupKey, _))
+  EXPECT_CALL(*storage, put_rv(nodeLookupKey(target_block.hash), _))
       .WillOnce(Return(outcome::success()));
 
   EXPECT_OUTCOME_SUCCESS(
@@ -365,7 +414,10 @@ TEST_F(AuthorityManagerTest, OnConsensus_OnPause) {
   primitives::BlockInfo target_block{5, "A"_hash256};
   uint32_t delay = 10;
 
-  EXPECT_CALL(*storage, put_rv(schedulerLookupKey, _))
+  EXPECT_CALL(*storage, put_rv(nodeLookupKey(target_block.hash), _))
+      .WillOnce(Return(outcome::success()));
+  // the record of the parent node lists the new one
+  EXPECT_CALL(*storage, put_rv(nodeLookupKey("GEN"_hash256), _))
       .WillOnce(Return(outcome::success()));
   EXPECT_OUTCOME_SUCCESS(
       r1,
@@ -385,6 +437,12 @@ TEST_F(AuthorityManagerTest, OnConsensus_OnPause) {
 
   EXPECT_CALL(*storage, put_rv(schedulerLookupKey, _))
       .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*storage, put_rv(nodeLookupKey("D"_hash256), _))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*storage, remove(nodeLookupKey("GEN"_hash256)))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*storage, remove(nodeLookupKey("A"_hash256)))
+      .WillOnce(Return(outcome::success()));
   EXPECT_OUTCOME_SUCCESS(finalisation_result,
                          authority_manager->prune({20, "D"_hash256}));
 
@@ -419,7 +477,9 @@ TEST_F(AuthorityManagerTest, OnConsensus_OnResume) {
     primitives::BlockInfo target_block{5, "A"_hash256};
     uint32_t delay = 5;
 
-    EXPECT_CALL(*storage, put_rv(schedulerLookupKey, _))
+    EXPECT_CALL(*storage, put_rv(nodeLookupKey(target_block.hash), _))
+        .WillOnce(Return(outcome::success()));
+    EXPECT_CALL(*storage, put_rv(nodeLookupKey("GEN"_hash256), _))
         .WillOnce(Return(outcome::success()));
     EXPECT_OUTCOME_SUCCESS(
         r1,
@@ -428,6 +488,12 @@ TEST_F(AuthorityManagerTest, OnConsensus_OnResume) {
 
     EXPECT_CALL(*storage, put_rv(schedulerLookupKey, _))
         .WillOnce(Return(outcome::success()));
+    EXPECT_CALL(*storage, put_rv(nodeLookupKey("B"_hash256), _))
+        .WillOnce(Return(outcome::success()));
+    EXPECT_CALL(*storage, remove(nodeLookupKey("GEN"_hash256)))
+        .WillOnce(Return(outcome::success()));
+    EXPECT_CALL(*storage, remove(nodeLookupKey("A"_hash256)))
+        .WillOnce(Return(outcome::success()));
     EXPECT_OUTCOME_SUCCESS(finalisation_result,
                            authority_manager->prune({10, "B"_hash256}));
   }
@@ -442,7 +508,9 @@ TEST_F(AuthorityManagerTest, OnConsensus_OnResume) {
     primitives::BlockInfo target_block{15, "C"_hash256};
     uint32_t delay = 10;
 
-    EXPECT_CALL(*storage, put_rv(schedulerLookupKey, _))
+    EXPECT_CALL(*storage, put_rv(nodeLookupKey(target_block.hash), _))
+        .WillOnce(Return(outcome::success()));
+    EXPECT_CALL(*storage, put_rv(nodeLookupKey("B"_hash256), _))
         .WillOnce(Return(outcome::success()));
     EXPECT_OUTCOME_SUCCESS(
         r1,
@@ -455,3 +523,151 @@ TEST_F(AuthorityManagerTest, OnConsensus_OnResume) {
   examine({20, "D"_hash256}, disabled_authorities);
   examine({25, "E"_hash256}, enabled_authorities);
 }
+
+/**
+ * @given manager initialized by data from genesis config, storage keeping
+ * written data
+ * @when apply changes on the both forks, prune and restore state by other
+ * manager
+ * @then restored manager provides the same authorities, records of the pruned
+ * nodes are removed
+ */
+TEST_F(AuthorityManagerTest, RestoreFromRecords) {
+  std::map<common::Buffer, common::Buffer> db;
+  EXPECT_CALL(*storage, get(_))
+      .WillRepeatedly(testing::Invoke(
+          [&db](const common::Buffer &key) -> outcome::result<common::Buffer> {
+            if (auto it = db.find(key); it != db.end()) {
+              return it->second;
+            }
+            return storage::DatabaseError::NOT_FOUND;
+          }));
+  EXPECT_CALL(*storage, put_rv(_, _))
+      .WillRepeatedly(testing::Invoke(
+          [&db](const common::Buffer &key, common::Buffer value) {
+            db[key] = std::move(value);
+            return outcome::success();
+          }));
+  EXPECT_CALL(*storage, remove(_))
+      .WillRepeatedly(testing::Invoke([&db](const common::Buffer &key) {
+        db.erase(key);
+        return outcome::success();
+      }));
+
+  auto root = authority::ScheduleNode::createAsRoot({0, "GEN"_hash256});
+  root->actual_authorities = authorities;
+  EXPECT_OUTCOME_SUCCESS(encode_result, scale::encode(root));
+  db[schedulerLookupKey] = common::Buffer(encode_result.value());
+  ASSERT_TRUE(authority_manager->prepare());
+
+  auto engine_id = primitives::kGrandpaEngineId;
+  primitives::AuthorityList scheduled_authorities{makeAuthority("Auth1", 123)};
+  primitives::AuthorityList forced_authorities{makeAuthority("Auth2", 456)};
+
+  EXPECT_OUTCOME_SUCCESS(
+      r1,
+      authority_manager->onConsensus(
+          engine_id,
+          {10, "B"_hash256},
+          primitives::ScheduledChange(scheduled_authorities, 5)));
+  EXPECT_OUTCOME_SUCCESS(r2, authority_manager->prune({20, "D"_hash256}));
+  EXPECT_OUTCOME_SUCCESS(
+      r3,
+      authority_manager->onConsensus(
+          engine_id,
+          {30, "EA"_hash256},
+          primitives::ForcedChange(forced_authorities, 5)));
+
+  EXPECT_EQ(db.count(nodeLookupKey("GEN"_hash256)), 0);
+  EXPECT_EQ(db.count(nodeLookupKey("B"_hash256)), 0);
+  EXPECT_EQ(db.count(nodeLookupKey("D"_hash256)), 1);
+  EXPECT_EQ(db.count(nodeLookupKey("EA"_hash256)), 1);
+
+  EXPECT_CALL(*app_state_manager, atPrepare(_));
+  EXPECT_CALL(*app_state_manager, atLaunch(_));
+  EXPECT_CALL(*app_state_manager, atShutdown(_));
+  authority_manager = std::make_shared<AuthorityManager>(
+      app_state_manager, block_tree, storage);
+  ASSERT_TRUE(authority_manager->prepare());
+
+  examine({25, "E"_hash256}, scheduled_authorities);
+  examine({30, "EA"_hash256}, scheduled_authorities);
+  examine({35, "EB"_hash256}, forced_authorities);
+  examine({35, "FA"_hash256}, scheduled_authorities);
+}
+
+/**
+ * @given storage keeping the whole schedule tree under one key, as older
+ * versions stored it
+ * @when prepare manager @and restore state by other manager
+ * @then every node gets its own record, the tree key keeps the root only
+ * @and both managers provide the authorities of the old tree
+ */
+TEST_F(AuthorityManagerTest, MigrateWholeTreeToRecords) {
+  std::map<common::Buffer, common::Buffer> db;
+  EXPECT_CALL(*storage, get(_))
+      .WillRepeatedly(testing::Invoke(
+          [&db](const common::Buffer &key) -> outcome::result<common::Buffer> {
+            if (auto it = db.find(key); it != db.end()) {
+              return it->second;
+            }
+            return storage::DatabaseError::NOT_FOUND;
+          }));
+  EXPECT_CALL(*storage, put_rv(_, _))
+      .WillRepeatedly(testing::Invoke(
+          [&db](const common::Buffer &key, common::Buffer value) {
+            db[key] = std::move(value);
+            return outcome::success();
+          }));
+
+  // GEN - B - EA, with FA being the other descendant of B
+  primitives::AuthorityList b_authorities{makeAuthority("Auth1", 1)};
+  primitives::AuthorityList ea_authorities{makeAuthority("Auth2", 2)};
+  primitives::AuthorityList fa_authorities{makeAuthority("Auth3", 3)};
+  auto root = authority::ScheduleNode::createAsRoot({0, "GEN"_hash256});
+  root->actual_authorities = authorities;
+  auto b = root->makeDescendant({10, "B"_hash256});
+  b->actual_authorities =
+      std::make_shared<primitives::AuthorityList>(b_authorities);
+  root->descendants.emplace_back(b);
+  auto ea = b->makeDescendant({30, "EA"_hash256});
+  ea->actual_authorities =
+      std::make_shared<primitives::AuthorityList>(ea_authorities);
+  b->descendants.emplace_back(ea);
+  auto fa = b->makeDescendant({35, "FA"_hash256});
+  fa->actual_authorities =
+      std::make_shared<primitives::AuthorityList>(fa_authorities);
+  b->descendants.emplace_back(fa);
+  EXPECT_OUTCOME_SUCCESS(encode_result, scale::encode(root));
+  db[schedulerLookupKey] = common::Buffer(encode_result.value());
+
+  ASSERT_TRUE(authority_manager->prepare());
+
+  for (auto &hash :
+       {"GEN"_hash256, "B"_hash256, "EA"_hash256, "FA"_hash256}) {
+    EXPECT_EQ(db.count(nodeLookupKey(hash)), 1);
+  }
+  EXPECT_OUTCOME_SUCCESS(
+      stored_root,
+      scale::decode<std::shared_ptr<authority::ScheduleNode>>(
+          db[schedulerLookupKey]));
+  EXPECT_EQ(stored_root.value()->block, root->block);
+  EXPECT_TRUE(stored_root.value()->descendants.empty());
+
+  examine({5, "A"_hash256}, *authorities);
+  examine({20, "D"_hash256}, b_authorities);
+  examine({35, "EB"_hash256}, ea_authorities);
+  examine({40, "FB"_hash256}, fa_authorities);
+
+  EXPECT_CALL(*app_state_manager, atPrepare(_));
+  EXPECT_CALL(*app_state_manager, atLaunch(_));
+  EXPECT_CALL(*app_state_manager, atShutdown(_));
+  authority_manager = std::make_shared<AuthorityManager>(
+      app_state_manager, block_tree, storage);
+  ASSERT_TRUE(authority_manager->prepare());
+
+  examine({5, "A"_hash256}, *authorities);
+  examine({20, "D"_hash256}, b_authorities);
+  examine({35, "EB"_hash256}, ea_authorities);
+  examine({40, "FB"_hash256}, fa_authorities);
+}
@@ -13,11 +13,13 @@
 #include "clock/impl/clock_impl.hpp"
 #include "consensus/babe/babe_error.hpp"
 #include "consensus/babe/impl/babe_impl.hpp"
+#include "consensus/babe/impl/post_state_cache_impl.hpp"
 #include "mock/core/application/app_state_manager_mock.hpp"
 #include "mock/core/authorship/proposer_mock.hpp"
 #include "mock/core/blockchain/block_tree_mock.hpp"
 #include "mock/core/clock/clock_mock.hpp"
 #include "mock/core/clock/ticker_mock.hpp"
+#include "mock/core/clock/timer_mock.hpp"
 #include "mock/core/consensus/authority/authority_update_observer_mock.hpp"
 #include "mock/core/consensus/babe/babe_gossiper_mock.hpp"
 #include "mock/core/consensus/babe/babe_synchronizer_mock.hpp"
@@ -91,9 +93,12 @@ class BabeTest : public testing::Test {
     hasher_ = std::make_shared<HasherMock>();
     ticker_mock_ = std::make_unique<testutil::TickerMock>();
     ticker_ = ticker_mock_.get();
+    prebuild_timer_mock_ = std::make_unique<testutil::TimerMock>();
+    prebuild_timer_ = prebuild_timer_mock_.get();
     grandpa_authority_update_observer_ =
         std::make_shared<AuthorityUpdateObserverMock>();
     io_context_ = std::make_shared<boost::asio::io_context>();
+    post_state_cache_ = std::make_shared<PostStateCacheImpl>();
 
     // add initialization logic
     babe_config_ = std::make_shared<primitives::BabeConfiguration>();
@@ -127,6 +132,7 @@ class BabeTest : public testing::Test {
         hasher_,
         grandpa_authority_update_observer_,
         babe_util_,
+        post_state_cache_,
         io_context_,
         std::make_unique<clock::BasicWaitableTimer>(io_context_));
 
@@ -144,6 +150,7 @@ class BabeTest : public testing::Test {
                                              trie_db_,
                                              babe_config_,
                                              proposer_,
+                                             tx_pool_,
                                              block_tree_,
                                              gossiper_,
                                              sr25519_provider,
@@ -151,8 +158,10 @@ class BabeTest : public testing::Test {
                                              clock_,
                                              hasher_,
                                              std::move(ticker_mock_),
+                                             std::move(prebuild_timer_mock_),
                                              grandpa_authority_update_observer_,
-                                             babe_util_);
+                                             babe_util_,
+                                             post_state_cache_);
 
     epoch_.start_slot = 0;
     epoch_.epoch_number = 0;
@@ -185,11 +194,14 @@ class BabeTest : public testing::Test {
   std::shared_ptr<HasherMock> hasher_;
   std::unique_ptr<testutil::TickerMock> ticker_mock_;
   testutil::TickerMock *ticker_;
+  std::unique_ptr<testutil::TimerMock> prebuild_timer_mock_;
+  testutil::TimerMock *prebuild_timer_;
   std::shared_ptr<AuthorityUpdateObserverMock>
       grandpa_authority_update_observer_;
   std::shared_ptr<primitives::BabeConfiguration> babe_config_;
   std::shared_ptr<BabeUtilMock> babe_util_;
   std::shared_ptr<boost::asio::io_context> io_context_;
+  std::shared_ptr<PostStateCacheImpl> post_state_cache_;
 
   std::shared_ptr<babe::BabeImpl> babe_;
 
@@ -216,6 +228,7 @@ class BabeTest : public testing::Test {
   Block created_block_{block_header_, {extrinsic_}};
 
   Hash256 created_block_hash_{createHash(3)};
+  Hash256 extrinsic_hash_{createHash(4)};
 
   SystemClockImpl real_clock_{};
 };
@@ -231,8 +244,8 @@ ACTION_P(CheckBlockHeader, expected_block_header) {
  * @given BABE production
  * @when running it in epoch with two slots @and out node is a leader in one of
  * them
- * @then block is emitted in the leader slot @and after two slots BABE moves to
- * the next epoch
+ * @then block is emitted in the leader slot @and its state is remembered for
+ * import @and after two slots BABE moves to the next epoch
  */
 TEST_F(BabeTest, Success) {
   Randomness randomness;
@@ -262,11 +275,95 @@ TEST_F(BabeTest, Success) {
       .WillOnce(Return(epoch_.start_slot + 1))
       .WillOnce(Return(epoch_.start_slot + 1));
 
-  EXPECT_CALL(*proposer_, propose(best_block_number_, _, _))
+  // building of the block in advance is scheduled, but does not happen
+  EXPECT_CALL(*babe_util_, slotStartsIn(epoch_.start_slot + 1))
+      .WillOnce(Return(60ms));
+  EXPECT_CALL(*prebuild_timer_, expiresAfter(SystemClock::Duration{40ms}));
+  EXPECT_CALL(*prebuild_timer_, asyncWait(_));
+
+  // remaining time of the leader slot limits block proposal
+  EXPECT_CALL(*babe_util_, slotStartsIn(epoch_.start_slot + 2))
+      .WillRepeatedly(Return(60ms));
+  EXPECT_CALL(*proposer_, propose(best_block_number_, _, _, _))
       .WillOnce(Return(created_block_));
-  EXPECT_CALL(*hasher_, blake2b_256(_)).WillOnce(Return(created_block_hash_));
+  EXPECT_CALL(*hasher_, blake2b_256(_))
+      .Times(2)
+      .WillRepeatedly(Return(created_block_hash_));
   EXPECT_CALL(*block_tree_, addBlock(_)).WillOnce(Return(outcome::success()));
+  // extrinsics are removed from the pool once the block is added
+  EXPECT_CALL(*hasher_, blake2b_256(gsl::span<const uint8_t>(extrinsic_.data)))
+      .WillOnce(Return(extrinsic_hash_));
+  EXPECT_CALL(*tx_pool_, removeOne(extrinsic_hash_))
+      .WillOnce(Return(Transaction{}));
+
+  EXPECT_CALL(*gossiper_, blockAnnounce(_))
+      .WillOnce(CheckBlockHeader(created_block_.header));
+
+  EXPECT_CALL(*babe_util_, setLastEpoch(_))
+      .WillOnce(Return(outcome::success()));
+
+  babe_->runEpoch(epoch_);
+  run_slot({});
+  run_slot({});
+
+  ASSERT_TRUE(post_state_cache_->contains(created_block_hash_,
+                                          created_block_.header.state_root));
+}
+
+/**
+ * @given BABE production, where our node is a leader of the second slot
+ * @when the block for the second slot is built during the first slot
+ * @and the best block stays the same
+ * @then the block built in advance is sealed and announced when the second
+ * slot begins, without building it again
+ */
+TEST_F(BabeTest, PrebuiltBlock) {
+  Randomness randomness;
+  EXPECT_CALL(*lottery_, slotsLeadership(epoch_, randomness, _, *keypair_))
+      .WillOnce(Return(leadership_));
+
+  EXPECT_CALL(*babe_util_, slotStartsIn(epoch_.start_slot))
+      .WillOnce(Return(1ms));
+
+  std::function<void(const std::error_code &ec)> run_slot;
+  EXPECT_CALL(*ticker_, asyncCallRepeatedly(_))
+      .WillOnce(testing::SaveArg<0>(&run_slot));
+  EXPECT_CALL(*ticker_, start(_));
+
+  std::function<void(const std::error_code &ec)> prebuild;
+  EXPECT_CALL(*prebuild_timer_, expiresAfter(_));
+  EXPECT_CALL(*prebuild_timer_, asyncWait(_))
+      .WillOnce(testing::SaveArg<0>(&prebuild));
+
+  EXPECT_CALL(*block_tree_, deepestLeaf())
+      .Times(3)
+      .WillRepeatedly(Return(best_leaf));
+
+  EXPECT_CALL(*babe_util_, getCurrentSlot())
+      .WillOnce(Return(epoch_.start_slot))
+      .WillOnce(Return(epoch_.start_slot))
+      .WillOnce(Return(epoch_.start_slot + 1))
+      .WillOnce(Return(epoch_.start_slot + 1));
+
+  // extrinsics are applied until the leader slot begins
+  SystemClock::TimePoint now{};
+  EXPECT_CALL(*clock_, now()).WillOnce(Return(now));
+  EXPECT_CALL(*babe_util_, slotStartsIn(epoch_.start_slot + 1))
+      .WillRepeatedly(Return(20ms));
+  EXPECT_CALL(*proposer_, propose(best_block_number_, _, _, now + 20ms))
+      .WillOnce(Return(created_block_));
 
+  EXPECT_CALL(*babe_util_, slotStartsIn(epoch_.start_slot + 2))
+      .WillRepeatedly(Return(60ms));
+  EXPECT_CALL(*hasher_, blake2b_256(_))
+      .Times(2)
+      .WillRepeatedly(Return(created_block_hash_));
+  EXPECT_CALL(*block_tree_, addBlock(_)).WillOnce(Return(outcome::success()));
+  // extrinsics are removed from the pool once the block is added
+  EXPECT_CALL(*hasher_, blake2b_256(gsl::span<const uint8_t>(extrinsic_.data)))
+      .WillOnce(Return(extrinsic_hash_));
+  EXPECT_CALL(*tx_pool_, removeOne(extrinsic_hash_))
+      .WillOnce(Return(Transaction{}));
   EXPECT_CALL(*gossiper_, blockAnnounce(_))
       .WillOnce(CheckBlockHeader(created_block_.header));
 
@@ -275,5 +372,90 @@ TEST_F(BabeTest, Success) {
 
   babe_->runEpoch(epoch_);
   run_slot({});
+  prebuild({});
+  run_slot({});
+}
+
+/**
+ * @given BABE production, where our node is a leader of the second slot
+ * @when the block for the second slot is built during the first slot
+ * @and the best block changes before the second slot begins
+ * @then the block is built again on the new best block in the second slot
+ * @and only extrinsics of the block built again are removed from the pool
+ */
+TEST_F(BabeTest, PrebuiltBlockOnStaleParent) {
+  Randomness randomness;
+  EXPECT_CALL(*lottery_, slotsLeadership(epoch_, randomness, _, *keypair_))
+      .WillOnce(Return(leadership_));
+
+  EXPECT_CALL(*babe_util_, slotStartsIn(epoch_.start_slot))
+      .WillOnce(Return(1ms));
+
+  std::function<void(const std::error_code &ec)> run_slot;
+  EXPECT_CALL(*ticker_, asyncCallRepeatedly(_))
+      .WillOnce(testing::SaveArg<0>(&run_slot));
+  EXPECT_CALL(*ticker_, start(_));
+
+  std::function<void(const std::error_code &ec)> prebuild;
+  EXPECT_CALL(*prebuild_timer_, expiresAfter(_));
+  EXPECT_CALL(*prebuild_timer_, asyncWait(_))
+      .WillOnce(testing::SaveArg<0>(&prebuild));
+
+  primitives::BlockInfo new_best_leaf{best_block_number_ + 1, createHash(7)};
+
+  // the block built again includes another extrinsic
+  Extrinsic rebuilt_extrinsic{{4, 5, 6}};
+  Block rebuilt_block{block_header_, {rebuilt_extrinsic}};
+  std::vector<common::Buffer> encoded_exts(
+      {common::Buffer(scale::encode(rebuilt_extrinsic).value())});
+  rebuilt_block.header.extrinsics_root =
+      common::Hash256::fromSpan(
+          kagome::storage::trie::calculateOrderedTrieHash(
+              encoded_exts.begin(), encoded_exts.end())
+              .value())
+          .value();
+  Hash256 rebuilt_extrinsic_hash{createHash(5)};
+  EXPECT_CALL(*block_tree_, deepestLeaf())
+      .WillOnce(Return(best_leaf))
+      .WillOnce(Return(best_leaf))
+      .WillOnce(Return(new_best_leaf));
+
+  EXPECT_CALL(*babe_util_, getCurrentSlot())
+      .WillOnce(Return(epoch_.start_slot))
+      .WillOnce(Return(epoch_.start_slot))
+      .WillOnce(Return(epoch_.start_slot + 1))
+      .WillOnce(Return(epoch_.start_slot + 1));
+
+  EXPECT_CALL(*clock_, now()).Times(2);
+  EXPECT_CALL(*babe_util_, slotStartsIn(epoch_.start_slot + 1))
+      .WillRepeatedly(Return(20ms));
+  EXPECT_CALL(*babe_util_, slotStartsIn(epoch_.start_slot + 2))
+      .WillRepeatedly(Return(60ms));
+  EXPECT_CALL(*proposer_, propose(best_block_number_, _, _, _))
+      .WillOnce(Return(created_block_));
+  EXPECT_CALL(*proposer_, propose(best_block_number_ + 1, _, _, _))
+      .WillOnce(Return(rebuilt_block));
+
+  EXPECT_CALL(*hasher_, blake2b_256(_))
+      .Times(2)
+      .WillRepeatedly(Return(created_block_hash_));
+  EXPECT_CALL(*block_tree_, addBlock(_)).WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*gossiper_, blockAnnounce(_))
+      .WillOnce(CheckBlockHeader(rebuilt_block.header));
+
+  // extrinsics of the discarded block stay in the pool
+  EXPECT_CALL(*tx_pool_, removeOne(extrinsic_hash_)).Times(0);
+  EXPECT_CALL(*hasher_,
+              blake2b_256(gsl::span<const uint8_t>(rebuilt_extrinsic.data)))
+      .WillOnce(Return(rebuilt_extrinsic_hash));
+  EXPECT_CALL(*tx_pool_, removeOne(rebuilt_extrinsic_hash))
+      .WillOnce(Return(Transaction{}));
+
+  EXPECT_CALL(*babe_util_, setLastEpoch(_))
+      .WillOnce(Return(outcome::success()));
+
+  babe_->runEpoch(epoch_);
+  run_slot({});
+  prebuild({});
   run_slot({});
 }
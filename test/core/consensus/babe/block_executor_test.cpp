@@ -0,0 +1,193 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/babe/impl/block_executor.hpp"
+
+#include <gtest/gtest.h>
+
+#include "blockchain/block_tree_error.hpp"
+#include "consensus/babe/impl/post_state_cache_impl.hpp"
+#include "consensus/babe/types/babe_block_header.hpp"
+#include "consensus/babe/types/seal.hpp"
+#include "mock/core/blockchain/block_tree_mock.hpp"
+#include "mock/core/clock/timer_mock.hpp"
+#include "mock/core/consensus/authority/authority_update_observer_mock.hpp"
+#include "mock/core/consensus/babe/babe_synchronizer_mock.hpp"
+#include "mock/core/consensus/babe/babe_util_mock.hpp"
+#include "mock/core/consensus/grandpa/environment_mock.hpp"
+#include "mock/core/consensus/validation/block_validator_mock.hpp"
+#include "mock/core/crypto/hasher_mock.hpp"
+#include "mock/core/runtime/core_mock.hpp"
+#include "mock/core/transaction_pool/transaction_pool_mock.hpp"
+#include "scale/scale.hpp"
+#include "storage/trie/serialization/ordered_trie_hash.hpp"
+#include "testutil/literals.hpp"
+#include "transaction_pool/transaction_pool_error.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using namespace kagome;
+using namespace consensus;
+using namespace primitives;
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+
+class BlockExecutorTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    block_tree_ = std::make_shared<blockchain::BlockTreeMock>();
+    core_ = std::make_shared<runtime::CoreMock>();
+    babe_synchronizer_ = std::make_shared<BabeSynchronizerMock>();
+    block_validator_ = std::make_shared<BlockValidatorMock>();
+    babe_util_ = std::make_shared<BabeUtilMock>();
+    hasher_ = std::make_shared<crypto::HasherMock>();
+    tx_pool_ = std::make_shared<transaction_pool::TransactionPoolMock>();
+    post_state_cache_ = std::make_shared<PostStateCacheImpl>();
+    io_context_ = std::make_shared<boost::asio::io_context>();
+
+    auto babe_config = std::make_shared<BabeConfiguration>();
+    babe_config->leadership_rate = {1, 4};
+
+    block_executor_ = std::make_shared<BlockExecutor>(
+        block_tree_,
+        core_,
+        babe_config,
+        babe_synchronizer_,
+        block_validator_,
+        std::make_shared<grandpa::EnvironmentMock>(),
+        tx_pool_,
+        hasher_,
+        std::make_shared<authority::AuthorityUpdateObserverMock>(),
+        babe_util_,
+        post_state_cache_,
+        io_context_,
+        std::make_unique<testutil::TimerMock>());
+
+    // header of the block carries the babe digests of the first authority
+    BabeBlockHeader babe_header{BabeBlockHeader::kVRFHeader, 5, {}, 0};
+    block_.header->number = 2;
+    block_.header->parent_hash = "parent"_hash256;
+    block_.header->state_root = "state"_hash256;
+    // the block has an empty body
+    block_.body = BlockBody{};
+    auto empty_root = storage::trie::calculateOrderedTrieHash(
+                          std::vector<common::Buffer>{})
+                          .value();
+    block_.header->extrinsics_root =
+        common::Hash256::fromSpan(empty_root).value();
+    block_.header->digest = {
+        PreRuntime{{kBabeEngineId,
+                    common::Buffer{scale::encode(babe_header).value()}}},
+        primitives::Seal{{kBabeEngineId,
+                          common::Buffer{
+                              scale::encode(consensus::Seal{}).value()}}}};
+
+    EXPECT_CALL(*hasher_, blake2b_256(_)).WillRepeatedly(Return(block_.hash));
+    EXPECT_CALL(*block_tree_, getBlockBody(BlockId{block_.hash}))
+        .WillRepeatedly(Return(
+            outcome::failure(blockchain::BlockTreeError::NO_SUCH_BLOCK)));
+    EXPECT_CALL(*babe_util_, slotToEpoch(5)).WillRepeatedly(Return(0));
+    EXPECT_CALL(*block_tree_, getEpochDescriptor(0, "parent"_hash256))
+        .WillRepeatedly(Return(EpochDigest{{Authority{{}, 1}}, Randomness{}}));
+    EXPECT_CALL(*block_validator_, validateHeader(_, 0, _, _, _))
+        .WillRepeatedly(Return(outcome::success()));
+    EXPECT_CALL(*block_tree_, addBlock(_))
+        .WillRepeatedly(Return(outcome::success()));
+  }
+
+  /// Imports the block as received from the peer
+  void importBlock() {
+    std::vector<BlockData> blocks{block_};
+    EXPECT_CALL(*babe_synchronizer_, request(_, block_.hash, _, _))
+        .WillOnce(Invoke([&](auto &, auto &, auto &, const auto &handler) {
+          handler(std::cref(blocks));
+        }));
+
+    bool retrieved = false;
+    block_executor_->requestBlocks(
+        "finalized"_hash256, block_.hash, "peer"_peerid, [&retrieved] {
+          retrieved = true;
+        });
+    io_context_->run();
+    ASSERT_TRUE(retrieved);
+  }
+
+  std::shared_ptr<blockchain::BlockTreeMock> block_tree_;
+  std::shared_ptr<runtime::CoreMock> core_;
+  std::shared_ptr<BabeSynchronizerMock> babe_synchronizer_;
+  std::shared_ptr<BlockValidatorMock> block_validator_;
+  std::shared_ptr<BabeUtilMock> babe_util_;
+  std::shared_ptr<crypto::HasherMock> hasher_;
+  std::shared_ptr<transaction_pool::TransactionPoolMock> tx_pool_;
+  std::shared_ptr<PostStateCacheImpl> post_state_cache_;
+  std::shared_ptr<boost::asio::io_context> io_context_;
+
+  std::shared_ptr<BlockExecutor> block_executor_;
+
+  BlockData block_{.hash = "block"_hash256, .header = BlockHeader{}};
+};
+
+/**
+ * @given block which body is not stored
+ * @when the block is imported
+ * @then the block is executed @and its post-state is remembered
+ */
+TEST_F(BlockExecutorTest, ExecutesUnknownBlock) {
+  EXPECT_CALL(*core_, execute_block(_)).WillOnce(Return(outcome::success()));
+
+  importBlock();
+
+  ASSERT_TRUE(post_state_cache_->contains(block_.hash, "state"_hash256));
+}
+
+/**
+ * @given block which body is not stored, but which post-state is known
+ * @when the block is imported
+ * @then the block is added without running it in the runtime
+ */
+TEST_F(BlockExecutorTest, SkipsExecutionOfKnownPostState) {
+  post_state_cache_->put(block_.hash, "state"_hash256);
+
+  EXPECT_CALL(*core_, execute_block(_)).Times(0);
+  EXPECT_CALL(*block_tree_, addBlock(_)).WillOnce(Return(outcome::success()));
+
+  importBlock();
+}
+
+/**
+ * @given block which post-state is known, but which body differs from the
+ * one its header commits to
+ * @when the block is imported
+ * @then the block is executed
+ */
+TEST_F(BlockExecutorTest, ExecutesKnownPostStateOfOtherBody) {
+  post_state_cache_->put(block_.hash, "state"_hash256);
+  block_.body->emplace_back(Extrinsic{common::Buffer{1, 2, 3}});
+
+  EXPECT_CALL(*core_, execute_block(_)).WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*tx_pool_, removeOne(_))
+      .WillOnce(Return(outcome::failure(
+          transaction_pool::TransactionPoolError::TX_NOT_FOUND)));
+
+  importBlock();
+}
+
+/**
+ * @given block which post-state is known for another state root
+ * @when the block is imported
+ * @then the block is executed
+ */
+TEST_F(BlockExecutorTest, ExecutesBlockOfOtherPostState) {
+  post_state_cache_->put(block_.hash, "other state"_hash256);
+
+  EXPECT_CALL(*core_, execute_block(_)).WillOnce(Return(outcome::success()));
+
+  importBlock();
+}
@@ -0,0 +1,50 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/babe/impl/post_state_cache_impl.hpp"
+
+#include <gtest/gtest.h>
+
+#include "testutil/literals.hpp"
+
+using kagome::consensus::PostStateCacheImpl;
+using kagome::primitives::BlockHash;
+
+/**
+ * @given cache with the post-state of a block
+ * @when the block is looked up with the same and with another state root
+ * @then only the recorded state root is found
+ */
+TEST(PostStateCacheTest, MatchesStateRoot) {
+  PostStateCacheImpl cache;
+  cache.put("block"_hash256, "state"_hash256);
+
+  ASSERT_TRUE(cache.contains("block"_hash256, "state"_hash256));
+  ASSERT_FALSE(cache.contains("block"_hash256, "other state"_hash256));
+  ASSERT_FALSE(cache.contains("other block"_hash256, "state"_hash256));
+}
+
+/**
+ * @given cache with post-states of the maximum number of blocks
+ * @when one more block is put
+ * @then the oldest block is evicted @and the rest are kept
+ */
+TEST(PostStateCacheTest, EvictsOldestBlock) {
+  PostStateCacheImpl cache;
+  auto block_hash = [](size_t i) {
+    BlockHash hash;
+    hash[0] = i & 0xff;
+    hash[1] = i >> 8;
+    return hash;
+  };
+  for (size_t i = 0; i <= PostStateCacheImpl::kMaxBlocks; ++i) {
+    cache.put(block_hash(i), "state"_hash256);
+  }
+
+  ASSERT_FALSE(cache.contains(block_hash(0), "state"_hash256));
+  for (size_t i = 1; i <= PostStateCacheImpl::kMaxBlocks; ++i) {
+    ASSERT_TRUE(cache.contains(block_hash(i), "state"_hash256));
+  }
+}
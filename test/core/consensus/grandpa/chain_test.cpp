@@ -77,8 +77,9 @@ class ChainTest : public testing::Test {
 
   std::shared_ptr<GossiperMock> gossiper = std::make_shared<GossiperMock>();
 
-  std::shared_ptr<Chain> chain =
+  std::shared_ptr<EnvironmentImpl> environment =
       std::make_shared<EnvironmentImpl>(tree, header_repo, gossiper);
+  std::shared_ptr<Chain> chain = environment;
 };
 
 /**
@@ -116,6 +117,70 @@ TEST_F(ChainTest, GetAncestryOfChild) {
   ASSERT_EQ(blocks, expected);
 }
 
+/**
+ * @given chain api instance which has already got the ancestry of h4
+ * @when obtaining the ancestries of h4, of its ancestor h3 and of h2_1,
+ * which forks from h2
+ * @then the block tree is asked only for the part of the fork which was not
+ * got before
+ */
+TEST_F(ChainTest, GetAncestryFromCache) {
+  auto h1 = "010101"_hash256;
+  auto h2 = "020202"_hash256;
+  auto h3 = "030303"_hash256;
+  auto h4 = "040404"_hash256;
+  auto h2_1 = "030101"_hash256;
+  EXPECT_CALL(*tree, getChainByBlocks(h1, h4))
+      .WillOnce(Return(std::vector<Hash256>{h1, h2, h3, h4}));
+  EXPECT_CALL(*tree, getChainByBlocks(h1, h2_1))
+      .WillOnce(Return(std::vector<Hash256>{h1, h2, h2_1}));
+
+  ASSERT_OUTCOME_SUCCESS(ancestry_h4, chain->getAncestry(h1, h4));
+  ASSERT_OUTCOME_SUCCESS(ancestry_h4_again, chain->getAncestry(h1, h4));
+  ASSERT_EQ(ancestry_h4_again, ancestry_h4);
+
+  ASSERT_OUTCOME_SUCCESS(ancestry_h3, chain->getAncestry(h1, h3));
+  ASSERT_EQ(ancestry_h3, (std::vector<Hash256>{h3, h2, h1}));
+
+  ASSERT_OUTCOME_SUCCESS(ancestry_h2_1, chain->getAncestry(h1, h2_1));
+  ASSERT_EQ(ancestry_h2_1, (std::vector<Hash256>{h2_1, h2, h1}));
+}
+
+/**
+ * @given chain api instance which has got the ancestry of h4
+ * @when a block is finalized
+ * @then the following ancestries are got from the block tree again
+ */
+TEST_F(ChainTest, FinalizationDropsAncestryCache) {
+  auto h1 = "010101"_hash256;
+  auto h2 = "020202"_hash256;
+  auto h3 = "030303"_hash256;
+  auto h4 = "040404"_hash256;
+  EXPECT_CALL(*tree, getChainByBlocks(h1, h4))
+      .Times(2)
+      .WillRepeatedly(Return(std::vector<Hash256>{h1, h2, h3, h4}));
+  EXPECT_CALL(*tree, finalize(h1, _))
+      .WillOnce(Return(outcome::success()));
+
+  ASSERT_OUTCOME_SUCCESS_TRY(chain->getAncestry(h1, h4));
+  ASSERT_OUTCOME_SUCCESS_TRY(environment->finalize(h1, {}));
+  ASSERT_OUTCOME_SUCCESS_TRY(chain->getAncestry(h1, h4));
+}
+
+/**
+ * @given chain api instance referring to a block tree where h2 is not an
+ * ancestor of h2_1
+ * @when obtaining the ancestry of h2_1 up to h3
+ * @then an error is returned
+ */
+TEST_F(ChainTest, GetAncestryOfNotDescendant) {
+  auto h3 = "030303"_hash256;
+  auto h2_1 = "030101"_hash256;
+  EXPECT_CALL(*tree, getChainByBlocks(h3, h2_1))
+      .WillOnce(Return(std::vector<Hash256>{}));
+  ASSERT_FALSE(chain->getAncestry(h3, h2_1));
+}
+
 /**
  * @given no special
  * @when obtaining the ancestry from h1 to itself
@@ -0,0 +1,98 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/grandpa/impl/pending_votes.hpp"
+
+#include <gtest/gtest.h>
+
+using kagome::consensus::grandpa::PendingVotes;
+
+class PendingVotesTest : public testing::Test {
+ public:
+  std::shared_ptr<PendingVotes::Vote> push(std::vector<uint8_t> message,
+                                           uint64_t round_number = 1) {
+    return pending_votes_.push(
+        round_number, std::move(message), PendingVotes::Vote{});
+  }
+
+  PendingVotes pending_votes_;
+};
+
+/**
+ * @given two votes being checked
+ * @when the check of the second one finishes first
+ * @then no vote leaves the queue until the check of the first one finishes
+ * @and then the votes leave it in the order they were received
+ */
+TEST_F(PendingVotesTest, ReleasesVotesInArrivalOrder) {
+  auto first = push({1});
+  auto second = push({2});
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(second);
+
+  second->valid = true;
+  ASSERT_FALSE(pending_votes_.popChecked());
+
+  first->valid = true;
+  ASSERT_EQ(pending_votes_.popChecked(), first);
+  ASSERT_EQ(pending_votes_.popChecked(), second);
+  ASSERT_FALSE(pending_votes_.popChecked());
+  ASSERT_EQ(pending_votes_.size(), 0);
+}
+
+/**
+ * @given vote being checked
+ * @when the same message is received while it is being checked @and after
+ * its signature is found valid
+ * @then the duplicates are not queued
+ */
+TEST_F(PendingVotesTest, DropsDuplicates) {
+  ASSERT_FALSE(pending_votes_.isDuplicate(1, {1}));
+  auto vote = push({1});
+  ASSERT_TRUE(vote);
+  ASSERT_TRUE(pending_votes_.isDuplicate(1, {1}));
+  ASSERT_FALSE(push({1}));
+
+  vote->valid = true;
+  ASSERT_EQ(pending_votes_.popChecked(), vote);
+  ASSERT_TRUE(pending_votes_.isDuplicate(1, {1}));
+  ASSERT_FALSE(push({1}));
+
+  // the same message of another round is another vote
+  ASSERT_FALSE(pending_votes_.isDuplicate(2, {1}));
+  ASSERT_TRUE(push({1}, 2));
+}
+
+/**
+ * @given vote with invalid signature
+ * @when its check finishes
+ * @then it leaves the queue as rejected @and its message is not remembered
+ */
+TEST_F(PendingVotesTest, RejectsInvalidSignature) {
+  auto vote = push({1});
+  ASSERT_TRUE(vote);
+
+  vote->valid = false;
+  auto rejected = pending_votes_.popChecked();
+  ASSERT_EQ(rejected, vote);
+  ASSERT_FALSE(rejected->valid.value());
+
+  ASSERT_TRUE(push({1}));
+}
+
+/**
+ * @given valid vote of a round
+ * @when the rounds before the next one are forgotten
+ * @then the same message is queued again
+ */
+TEST_F(PendingVotesTest, ForgetsOldRounds) {
+  auto vote = push({1});
+  vote->valid = true;
+  ASSERT_EQ(pending_votes_.popChecked(), vote);
+
+  pending_votes_.forgetRoundsBefore(2);
+
+  ASSERT_TRUE(push({1}));
+}
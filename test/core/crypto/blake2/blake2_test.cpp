@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <stdio.h>
 
+#include <algorithm>
+
 #include "testutil/literals.hpp"
 #include "crypto/blake2/blake2b.h"
 #include "crypto/blake2/blake2s.h"
@@ -116,3 +118,76 @@ TEST(Blake2s, UnkeyedInit) {
 
   EXPECT_EQ(memcmp(out1, out2, 32), 0) << "hashes are different";
 }
+
+TEST(Blake2b, KnownAnswers) {
+  uint8_t md[64];
+
+  blake2b(md, 32, nullptr, 0, nullptr, 0);
+  EXPECT_EQ(
+      memcmp(md,
+             "0E5751C026E543B2E8AB2EB06099DAA1D1E5DF47778F7787FAAB45CDF12FE3A8"_unhex
+                 .data(),
+             32),
+      0);
+
+  blake2b(md, 64, nullptr, 0, "abc", 3);
+  EXPECT_EQ(
+      memcmp(md,
+             "BA80A53F981C4D0D6A2797B69F12F6E94C212F14685AC4B74B12BB6FDBFFA2D1"
+             "7D87C5392AAB792DC252D5DE4533CC9518D38AA8DBF1925AB92386EDD4009923"_unhex
+                 .data(),
+             64),
+      0);
+}
+
+/**
+ * @given an input fed to blake2b_update in pieces of different sizes
+ * @when the digest is finalized
+ * @then it is the same as the one of the whole input
+ */
+TEST(Blake2b, SplitUpdate) {
+  uint8_t in[1024], expected[32], md[32];
+  selftest_seq(in, sizeof(in), sizeof(in));
+  blake2b(expected, 32, nullptr, 0, in, sizeof(in));
+
+  for (size_t piece : {1, 7, 64, 127, 128, 129, 500}) {
+    blake2b_ctx ctx;
+    blake2b_init(&ctx, 32, nullptr, 0);
+    for (size_t i = 0; i < sizeof(in); i += piece) {
+      blake2b_update(&ctx, in + i, std::min(piece, sizeof(in) - i));
+    }
+    blake2b_final(&ctx, md);
+    EXPECT_EQ(memcmp(md, expected, 32), 0) << "piece of " << piece;
+  }
+}
+
+/**
+ * @given inputs of different lengths, in groups which fill the vector lanes
+ * and which don't
+ * @when they are hashed by blake2b_many
+ * @then the digests are the same as calculated by blake2b one by one
+ */
+TEST(Blake2b, Many) {
+  const size_t lengths[] = {0, 3, 32, 128, 129, 255, 256, 1024, 77, 1};
+  uint8_t in[10][1024], md[10][64], expected[64];
+  const uint8_t *ins[10];
+  uint8_t *outs[10];
+  for (size_t i = 0; i < 10; ++i) {
+    selftest_seq(in[i], lengths[i], i);
+    ins[i] = in[i];
+    outs[i] = md[i];
+  }
+
+  for (size_t outlen : {32, 64}) {
+    for (size_t count = 0; count <= 10; ++count) {
+      ASSERT_EQ(blake2b_many(outs, outlen, ins, lengths, count), 0);
+      for (size_t i = 0; i < count; ++i) {
+        blake2b(expected, outlen, nullptr, 0, in[i], lengths[i]);
+        EXPECT_EQ(memcmp(md[i], expected, outlen), 0)
+            << "input " << i << " of " << count;
+      }
+    }
+  }
+
+  EXPECT_NE(blake2b_many(outs, 65, ins, lengths, 1), 0);
+}
@@ -7,6 +7,7 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <xxhash/xxhash.h>
 #include "testutil/literals.hpp"
 
 using kagome::common::Buffer;
@@ -55,3 +56,30 @@ TEST(Twox256, Correctness) {
     ASSERT_THAT(hash, ::testing::ElementsAreArray(reference));
   }
 }
+
+/**
+ * @given data of lengths covering whole stripes of 32 bytes and all the tails
+ * @when calling make_twox128 and make_twox256
+ * @then the hashes are XXH64 of the data with the seeds 0..1 and 0..3
+ */
+TEST(Twox, MatchesXxh64OfSeeds) {
+  std::vector<uint8_t> data(300);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<uint8_t>(i * 31 + 7);
+  }
+  for (size_t len = 0; len <= data.size(); ++len) {
+    gsl::span<const uint8_t> span(data.data(), len);
+    auto twox128 = make_twox128(span);
+    auto twox256 = make_twox256(span);
+    for (uint64_t seed = 0; seed < 4; ++seed) {
+      auto expected = XXH64(data.data(), len, seed);
+      uint64_t hash = 0;
+      if (seed < 2) {
+        std::memcpy(&hash, twox128.data() + seed * sizeof(hash), sizeof(hash));
+        ASSERT_EQ(hash, expected) << "twox128, length " << len;
+      }
+      std::memcpy(&hash, twox256.data() + seed * sizeof(hash), sizeof(hash));
+      ASSERT_EQ(hash, expected) << "twox256, length " << len;
+    }
+  }
+}
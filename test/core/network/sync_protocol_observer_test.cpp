@@ -114,3 +114,39 @@ TEST_F(SynchronizerTest, ProcessRequest) {
   ASSERT_EQ(received_blocks[1].body, block2_.body);
   ASSERT_FALSE(received_blocks[1].justification);
 }
+
+/**
+ * @given synchronizer
+ * @when blocks of a request are found
+ * @then the response lists their hashes @and no data are read, as it is read
+ * separately from the block tree
+ */
+TEST_F(SynchronizerTest, FindsBlocksWithoutReadingThem) {
+  // GIVEN
+  BlocksRequest received_request{1,
+                                 BlocksRequest::kBasicAttributes,
+                                 block1_hash_,
+                                 boost::none,
+                                 Direction::DESCENDING,
+                                 boost::none};
+
+  EXPECT_CALL(*tree_, getChainByBlock(block1_hash_, false, 10))
+      .WillOnce(Return(std::vector<BlockHash>{block1_hash_, block2_hash_}));
+  EXPECT_CALL(*headers_, getBlockHeader(_)).Times(0);
+  EXPECT_CALL(*tree_, getBlockBody(_)).Times(0);
+  EXPECT_CALL(*tree_, getBlockJustification(_)).Times(0);
+
+  // WHEN
+  EXPECT_OUTCOME_TRUE(
+      response, sync_protocol_observer_->findRequestedBlocks(received_request));
+
+  // THEN
+  ASSERT_EQ(response.id, received_request.id);
+
+  const auto &received_blocks = response.blocks;
+  ASSERT_EQ(received_blocks.size(), 2);
+  ASSERT_EQ(received_blocks[0].hash, block1_hash_);
+  ASSERT_FALSE(received_blocks[0].header);
+  ASSERT_EQ(received_blocks[1].hash, block2_hash_);
+  ASSERT_FALSE(received_blocks[1].header);
+}
@@ -43,12 +43,17 @@ class CoreTest : public RuntimeTest {
     EXPECT_CALL(*header_repo, getBlockHeader(_))
         .WillRepeatedly(Return(kagome::primitives::BlockHeader{}));
     EXPECT_CALL(*storage_provider_, getLatestRootMock());
+    // lookup of the runtime code hash
+    EXPECT_CALL(*storage_provider_, getLatestRootMock()).RetiresOnSaturation();
     EXPECT_CALL(*storage_provider_, getCurrentBatch());
     EXPECT_CALL(*batch_mock_, get(_));
     EXPECT_CALL(*storage_provider_, rollbackTransaction());
 
-    core_ = std::make_shared<CoreImpl>(
-        runtime_env_factory_, wasm_provider_, changes_tracker_, header_repo);
+    core_ = std::make_shared<CoreImpl>(runtime_env_factory_,
+                                       wasm_provider_,
+                                       changes_tracker_,
+                                       header_repo,
+                                       properties_cache_);
   }
 
  protected:
@@ -64,6 +69,20 @@ TEST_F(CoreTest, VersionTest) {
   ASSERT_TRUE(core_->version(boost::none));
 }
 
+/**
+ * @given initialized core api, which version was already requested
+ * @when version is invoked again for the same runtime code
+ * @then the same version is returned without calling the runtime
+ */
+TEST_F(CoreTest, VersionIsCachedByCode) {
+  EXPECT_OUTCOME_TRUE(version, core_->version(boost::none));
+
+  // only the code hash is looked up
+  EXPECT_CALL(*storage_provider_, getLatestRootMock()).RetiresOnSaturation();
+  EXPECT_OUTCOME_TRUE(cached_version, core_->version(boost::none));
+  ASSERT_EQ(cached_version, version);
+}
+
 /**
  * @given initialized core api
  * @when execute_block is invoked
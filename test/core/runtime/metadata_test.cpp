@@ -33,9 +33,13 @@ class MetadataTest : public RuntimeTest {
   void SetUp() override {
     RuntimeTest::SetUp();
     prepareEphemeralStorageExpects();
+    // lookup of the runtime code hash
+    EXPECT_CALL(*storage_provider_, getLatestRootMock()).RetiresOnSaturation();
 
     api_ = std::make_shared<MetadataImpl>(
-        runtime_env_factory_, std::make_shared<BlockHeaderRepositoryMock>());
+        runtime_env_factory_,
+        std::make_shared<BlockHeaderRepositoryMock>(),
+        properties_cache_);
   }
 
  protected:
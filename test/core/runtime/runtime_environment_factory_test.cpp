@@ -0,0 +1,116 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/binaryen/runtime_environment_factory_impl.hpp"
+
+#include <gtest/gtest.h>
+
+#include "crypto/hasher/hasher_impl.hpp"
+#include "mock/core/host_api/host_api_factory_mock.hpp"
+#include "mock/core/runtime/binaryen_wasm_memory_factory_mock.hpp"
+#include "mock/core/runtime/core_factory_mock.hpp"
+#include "mock/core/runtime/trie_storage_provider_mock.hpp"
+#include "mock/core/runtime/wasm_module_factory_mock.hpp"
+#include "mock/core/runtime/wasm_provider_mock.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::common::Buffer;
+using kagome::crypto::HasherImpl;
+using kagome::host_api::HostApiFactoryMock;
+using kagome::runtime::TrieStorageProviderMock;
+using kagome::runtime::WasmProvider;
+using kagome::runtime::WasmProviderMock;
+using kagome::runtime::binaryen::BinaryenWasmMemoryFactoryMock;
+using kagome::runtime::binaryen::CoreFactoryMock;
+using kagome::runtime::binaryen::RuntimeEnvironmentFactory;
+using kagome::runtime::binaryen::RuntimeEnvironmentFactoryImpl;
+using kagome::runtime::binaryen::WasmModuleFactoryMock;
+using testing::Return;
+using testing::ReturnRef;
+
+class RuntimeEnvironmentFactoryTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+ protected:
+  std::shared_ptr<WasmProviderMock> wasm_provider_ =
+      std::make_shared<WasmProviderMock>();
+  std::shared_ptr<TrieStorageProviderMock> storage_provider_ =
+      std::make_shared<TrieStorageProviderMock>();
+  std::shared_ptr<HasherImpl> hasher_ = std::make_shared<HasherImpl>();
+
+  std::shared_ptr<RuntimeEnvironmentFactoryImpl> factory_ =
+      std::make_shared<RuntimeEnvironmentFactoryImpl>(
+          std::make_shared<CoreFactoryMock>(),
+          std::make_shared<BinaryenWasmMemoryFactoryMock>(),
+          std::make_shared<HostApiFactoryMock>(),
+          std::make_shared<WasmModuleFactoryMock>(),
+          wasm_provider_,
+          storage_provider_,
+          hasher_,
+          nullptr);
+
+  Buffer code_{1, 2, 3};
+};
+
+/**
+ * @given runtime environment factory
+ * @when code hash of the same state is requested twice
+ * @then the code is read from the state once @and the hash is the one
+ * modules are cached by
+ */
+TEST_F(RuntimeEnvironmentFactoryTest, ReadsCodeOncePerState) {
+  EXPECT_CALL(*wasm_provider_, getStateCodeAt("root"_hash256))
+      .WillOnce(ReturnRef(code_));
+
+  EXPECT_OUTCOME_TRUE(hash, factory_->getCodeHash("root"_hash256, {}));
+  EXPECT_OUTCOME_TRUE(cached, factory_->getCodeHash("root"_hash256, {}));
+
+  ASSERT_EQ(hash, hasher_->twox_256(code_));
+  ASSERT_EQ(cached, hash);
+}
+
+/**
+ * @given runtime environment factory
+ * @when code hash of the latest state is requested, then of a newer one
+ * @then the code is read at each of the states
+ */
+TEST_F(RuntimeEnvironmentFactoryTest, ReadsCodeOfNewState) {
+  Buffer new_code{4, 5, 6};
+  EXPECT_CALL(*storage_provider_, getLatestRootMock())
+      .WillOnce(Return("old"_hash256))
+      .WillOnce(Return("new"_hash256));
+  EXPECT_CALL(*wasm_provider_, getStateCodeAt("old"_hash256))
+      .WillOnce(ReturnRef(code_));
+  EXPECT_CALL(*wasm_provider_, getStateCodeAt("new"_hash256))
+      .WillOnce(ReturnRef(new_code));
+
+  EXPECT_OUTCOME_TRUE(old_hash, factory_->getCodeHash(boost::none, {}));
+  EXPECT_OUTCOME_TRUE(new_hash, factory_->getCodeHash(boost::none, {}));
+
+  ASSERT_EQ(old_hash, hasher_->twox_256(code_));
+  ASSERT_EQ(new_hash, hasher_->twox_256(new_code));
+}
+
+/**
+ * @given runtime environment factory
+ * @when code hash is requested twice with another wasm provider
+ * @then the code is read each time, as it is not determined by the state
+ */
+TEST_F(RuntimeEnvironmentFactoryTest, ReadsCodeOfAnotherProviderEachTime) {
+  auto other_provider = std::make_shared<WasmProviderMock>();
+  EXPECT_CALL(*other_provider, getStateCodeAt("root"_hash256))
+      .Times(2)
+      .WillRepeatedly(ReturnRef(code_));
+
+  RuntimeEnvironmentFactory::Config config{
+      .wasm_provider = std::shared_ptr<WasmProvider>(other_provider)};
+  EXPECT_OUTCOME_TRUE_1(factory_->getCodeHash("root"_hash256, config));
+  EXPECT_OUTCOME_TRUE_1(factory_->getCodeHash("root"_hash256, config));
+}
@@ -0,0 +1,65 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/common/runtime_profiler_impl.hpp"
+
+#include <gtest/gtest.h>
+
+using kagome::runtime::RuntimeProfiler;
+using kagome::runtime::RuntimeProfilerImpl;
+using CallKind = RuntimeProfiler::CallKind;
+using std::chrono::milliseconds;
+
+class RuntimeProfilerTest : public testing::Test {
+ protected:
+  RuntimeProfilerImpl profiler_;
+};
+
+/**
+ * @given profiler
+ * @when calls of host functions and entry points are recorded
+ * @then statistics are accumulated per function and kind, the most time
+ * consuming functions go first
+ */
+TEST_F(RuntimeProfilerTest, AccumulatesStatsPerFunction) {
+  profiler_.record(CallKind::HOST_FUNCTION, "ext_a", milliseconds(1), 10);
+  profiler_.record(CallKind::HOST_FUNCTION, "ext_b", milliseconds(5), 1);
+  profiler_.record(CallKind::HOST_FUNCTION, "ext_a", milliseconds(2), 20);
+  profiler_.record(CallKind::ENTRY_POINT, "Core_version", milliseconds(7), 3);
+
+  auto host_functions = profiler_.stats(CallKind::HOST_FUNCTION);
+  ASSERT_EQ(host_functions.size(), 2);
+  EXPECT_EQ(host_functions[0].name, "ext_b");
+  EXPECT_EQ(host_functions[0].calls, 1);
+  EXPECT_EQ(host_functions[1].name, "ext_a");
+  EXPECT_EQ(host_functions[1].calls, 2);
+  EXPECT_EQ(host_functions[1].time, milliseconds(3));
+  EXPECT_EQ(host_functions[1].bytes, 30);
+
+  auto entry_points = profiler_.stats(CallKind::ENTRY_POINT);
+  ASSERT_EQ(entry_points.size(), 1);
+  EXPECT_EQ(entry_points[0].name, "Core_version");
+  EXPECT_EQ(entry_points[0].bytes, 3);
+
+  auto dump = profiler_.dump();
+  EXPECT_NE(dump.find("ext_a"), std::string::npos);
+  EXPECT_NE(dump.find("Core_version"), std::string::npos);
+}
+
+/**
+ * @given profiler with recorded calls
+ * @when it is reset
+ * @then statistics are empty until new calls are recorded
+ */
+TEST_F(RuntimeProfilerTest, Reset) {
+  profiler_.record(CallKind::HOST_FUNCTION, "ext_a", milliseconds(1), 10);
+  profiler_.reset();
+  EXPECT_TRUE(profiler_.stats(CallKind::HOST_FUNCTION).empty());
+
+  profiler_.record(CallKind::HOST_FUNCTION, "ext_a", milliseconds(1), 10);
+  auto stats = profiler_.stats(CallKind::HOST_FUNCTION);
+  ASSERT_EQ(stats.size(), 1);
+  EXPECT_EQ(stats[0].calls, 1);
+}
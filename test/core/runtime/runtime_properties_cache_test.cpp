@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/common/runtime_properties_cache_impl.hpp"
+
+#include <gtest/gtest.h>
+
+#include "testutil/literals.hpp"
+#include "testutil/outcome.hpp"
+
+using kagome::primitives::OpaqueMetadata;
+using kagome::primitives::Version;
+using kagome::runtime::RuntimePropertiesCacheImpl;
+
+class RuntimePropertiesCacheTest : public testing::Test {
+ protected:
+  /// Returns a version with the given spec version, counting the calls
+  auto obtainVersion(uint32_t spec_version) {
+    return [this, spec_version]() -> outcome::result<Version> {
+      ++calls_;
+      Version version;
+      version.spec_version = spec_version;
+      return version;
+    };
+  }
+
+  RuntimePropertiesCacheImpl cache_;
+  size_t calls_ = 0;
+};
+
+/**
+ * @given empty cache
+ * @when version of the same code is requested twice
+ * @then the runtime is called once
+ */
+TEST_F(RuntimePropertiesCacheTest, ObtainsVersionOncePerCode) {
+  EXPECT_OUTCOME_TRUE(version,
+                      cache_.getVersion("code"_hash256, obtainVersion(1)));
+  EXPECT_OUTCOME_TRUE(cached,
+                      cache_.getVersion("code"_hash256, obtainVersion(2)));
+
+  ASSERT_EQ(calls_, 1);
+  ASSERT_EQ(version.spec_version, 1);
+  ASSERT_EQ(cached.spec_version, 1);
+}
+
+/**
+ * @given cache with version of one code
+ * @when version of another code is requested
+ * @then the runtime is called for the new code
+ */
+TEST_F(RuntimePropertiesCacheTest, ObtainsVersionOfUpgradedCode) {
+  EXPECT_OUTCOME_TRUE_1(cache_.getVersion("old"_hash256, obtainVersion(1)));
+  EXPECT_OUTCOME_TRUE(version,
+                      cache_.getVersion("new"_hash256, obtainVersion(2)));
+
+  ASSERT_EQ(calls_, 2);
+  ASSERT_EQ(version.spec_version, 2);
+}
+
+/**
+ * @given empty cache
+ * @when obtaining of metadata fails
+ * @then the error is returned @and the next request calls the runtime again
+ */
+TEST_F(RuntimePropertiesCacheTest, DoesNotCacheErrors) {
+  EXPECT_OUTCOME_FALSE_1(cache_.getMetadata(
+      "code"_hash256, []() -> outcome::result<OpaqueMetadata> {
+        return std::errc::io_error;
+      }));
+
+  EXPECT_OUTCOME_TRUE(
+      metadata,
+      cache_.getMetadata("code"_hash256,
+                         []() -> outcome::result<OpaqueMetadata> {
+                           return OpaqueMetadata{1, 2, 3};
+                         }));
+  ASSERT_EQ(metadata, (OpaqueMetadata{1, 2, 3}));
+}
+
+/**
+ * @given cache full of versions of different codes
+ * @when version of one more code is cached
+ * @then the oldest one is evicted
+ */
+TEST_F(RuntimePropertiesCacheTest, EvictsOldestCode) {
+  for (uint32_t i = 0; i <= RuntimePropertiesCacheImpl::kMaxCodes; ++i) {
+    kagome::common::Hash256 code_hash{};
+    code_hash[0] = i;
+    EXPECT_OUTCOME_TRUE_1(cache_.getVersion(code_hash, obtainVersion(i)));
+  }
+  ASSERT_EQ(calls_, RuntimePropertiesCacheImpl::kMaxCodes + 1);
+
+  kagome::common::Hash256 oldest{};
+  EXPECT_OUTCOME_TRUE_1(cache_.getVersion(oldest, obtainVersion(0)));
+  ASSERT_EQ(calls_, RuntimePropertiesCacheImpl::kMaxCodes + 2);
+}
@@ -34,6 +34,7 @@
 #include "runtime/binaryen/runtime_api/core_factory_impl.hpp"
 #include "runtime/binaryen/runtime_environment_factory_impl.hpp"
 #include "runtime/binaryen/wasm_memory_impl.hpp"
+#include "runtime/common/runtime_properties_cache_impl.hpp"
 #include "runtime/common/runtime_transaction_error.hpp"
 #include "testutil/literals.hpp"
 #include "testutil/outcome.hpp"
@@ -130,7 +131,7 @@ class RuntimeTest : public ::testing::Test {
 
     auto core_factory =
         std::make_shared<kagome::runtime::binaryen::CoreFactoryImpl>(
-            changes_tracker_, header_repo_mock);
+            changes_tracker_, header_repo_mock, properties_cache_);
 
     runtime_env_factory_ = std::make_shared<
         kagome::runtime::binaryen::RuntimeEnvironmentFactoryImpl>(
@@ -141,7 +142,8 @@ class RuntimeTest : public ::testing::Test {
         wasm_provider_,
         // copying to allow inherited tests add own EXPECT_CALL rules
         storage_provider_,
-        std::move(hasher));
+        std::move(hasher),
+        nullptr);
   }
 
   void preparePersistentStorageExpects() {
@@ -211,6 +213,8 @@ class RuntimeTest : public ::testing::Test {
       runtime_env_factory_;
   std::shared_ptr<kagome::storage::changes_trie::ChangesTracker>
       changes_tracker_;
+  std::shared_ptr<kagome::runtime::RuntimePropertiesCache> properties_cache_ =
+      std::make_shared<kagome::runtime::RuntimePropertiesCacheImpl>();
 };
 
 #endif  // KAGOME_RUNTIME_TEST_HPP
@@ -137,7 +137,9 @@ class WasmExecutorTest : public ::testing::Test {
 
     auto core_factory =
         std::make_shared<kagome::runtime::binaryen::CoreFactoryImpl>(
-            changes_tracker, header_repo_mock);
+            changes_tracker,
+            header_repo_mock,
+            std::make_shared<kagome::runtime::RuntimePropertiesCacheImpl>());
 
     runtime_env_factory_ = std::make_shared<
         kagome::runtime::binaryen::RuntimeEnvironmentFactoryImpl>(
@@ -147,7 +149,8 @@ class WasmExecutorTest : public ::testing::Test {
         std::move(module_factory),
         wasm_provider_,
         storage_provider_,
-        std::move(hasher));
+        std::move(hasher),
+        nullptr);
 
     executor_ = std::make_shared<WasmExecutor>();
   }
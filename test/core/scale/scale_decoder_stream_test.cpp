@@ -58,3 +58,41 @@ TEST(ScaleDecoderStreamTest, HasMoreTest) {
 
   ASSERT_ANY_THROW(stream.nextByte());
 }
+
+/**
+ * @given encoded vectors of integers, an array and a byte sequence
+ * @when decoding them
+ * @then values are decoded @and byte sequence decoded to span points to the
+ * original data
+ */
+TEST(ScaleDecoderStreamTest, DecodesByteSequencesInBulk) {
+  auto bytes = ByteArray{2 << 2, 1, 2, 4, 1, 2, 0, 3 << 2, 'a', 'b', 'c'};
+  auto stream = ScaleDecoderStream{bytes};
+
+  std::vector<uint8_t> vector;
+  std::array<uint16_t, 2> array{};
+  gsl::span<const uint8_t> span;
+  ASSERT_NO_THROW(stream >> vector >> array >> span);
+
+  ASSERT_EQ(vector, (std::vector<uint8_t>{1, 2}));
+  ASSERT_EQ(array, (std::array<uint16_t, 2>{4 + 256, 2}));
+  ASSERT_EQ(span.data(), bytes.data() + 8);
+  ASSERT_EQ(span.size(), 3);
+  ASSERT_FALSE(stream.hasMore(1));
+}
+
+/**
+ * @given encoded collection which length exceeds available data
+ * @when decoding it as a vector of integers or as a span
+ * @then decoding fails without trying to allocate the declared size
+ */
+TEST(ScaleDecoderStreamTest, FailsOnTruncatedByteSequence) {
+  // compact encoded 2^30 followed by a couple of bytes
+  auto bytes = ByteArray{3, 0, 0, 0, 64, 1, 2};
+
+  std::vector<uint32_t> vector;
+  ASSERT_ANY_THROW(ScaleDecoderStream{bytes} >> vector);
+
+  gsl::span<const uint8_t> span;
+  ASSERT_ANY_THROW(ScaleDecoderStream{bytes} >> span);
+}
@@ -0,0 +1,101 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "scale/scale_encoder_stream.hpp"
+
+#include <list>
+
+#include <gtest/gtest.h>
+#include <testutil/outcome.hpp>
+
+#include "common/blob.hpp"
+#include "common/buffer.hpp"
+#include "scale/scale.hpp"
+
+using kagome::common::Blob;
+using kagome::common::Buffer;
+using kagome::scale::ByteArray;
+using kagome::scale::encode;
+using kagome::scale::encodedSize;
+using kagome::scale::encodeTo;
+using kagome::scale::ScaleEncoderStream;
+
+/**
+ * Encodes items of collection one by one, as std::list is always encoded
+ */
+template <class T>
+ByteArray encodeItemByItem(const std::vector<T> &v) {
+  ScaleEncoderStream s;
+  s << std::list<T>(v.begin(), v.end());
+  return s.data();
+}
+
+/**
+ * @given vectors of integers of different width and lengths of all compact
+ * length categories
+ * @when they are encoded
+ * @then result is the same as when items are encoded one by one
+ */
+TEST(ScaleEncoderStreamTest, BulkCopiedCollectionMatchesItemByItem) {
+  for (size_t length : {0, 1, 63, 64, 16383, 16384}) {
+    std::vector<uint8_t> bytes(length);
+    std::vector<uint32_t> ints(length);
+    std::vector<int64_t> longs(length);
+    for (size_t i = 0; i < length; ++i) {
+      bytes[i] = i;
+      ints[i] = i * 0x01020304u;
+      longs[i] = -static_cast<int64_t>(i) * 0x0102030405;
+    }
+    EXPECT_OUTCOME_TRUE(encoded_bytes, encode(bytes));
+    ASSERT_EQ(encoded_bytes, encodeItemByItem(bytes));
+    EXPECT_OUTCOME_TRUE(encoded_ints, encode(ints));
+    ASSERT_EQ(encoded_ints, encodeItemByItem(ints));
+    EXPECT_OUTCOME_TRUE(encoded_longs, encode(longs));
+    ASSERT_EQ(encoded_longs, encodeItemByItem(longs));
+  }
+}
+
+/**
+ * @given blob, array of integers and a string
+ * @when they are encoded
+ * @then they are encoded as is, string is prefixed with its length
+ */
+TEST(ScaleEncoderStreamTest, EncodesArraysAndStrings) {
+  Blob<4> blob{{1, 2, 3, 4}};
+  std::array<uint16_t, 2> array{0x0102, 0x0304};
+  std::string_view string = "abc";
+
+  EXPECT_OUTCOME_TRUE(encoded, encode(blob, array, string));
+  ASSERT_EQ(encoded,
+            (ByteArray{1, 2, 3, 4, 2, 1, 4, 3, 3 << 2, 'a', 'b', 'c'}));
+}
+
+/**
+ * @given stream which drops data
+ * @when values are written to it
+ * @then only size of encoded data is counted
+ */
+TEST(ScaleEncoderStreamTest, CountsSizeWithoutStoringData) {
+  ScaleEncoderStream s{true};
+  s << Buffer(100, 1) << uint32_t{1} << std::string("abc");
+  ASSERT_EQ(s.size(), 2 + 100 + 4 + 1 + 3);
+  ASSERT_TRUE(s.data().empty());
+
+  EXPECT_OUTCOME_TRUE(
+      size, encodedSize(Buffer(100, 1), uint32_t{1}, std::string("abc")));
+  ASSERT_EQ(size, s.size());
+}
+
+/**
+ * @given buffer with some data
+ * @when values are encoded to it
+ * @then encoded data is appended to the buffer
+ */
+TEST(ScaleEncoderStreamTest, EncodesToProvidedBuffer) {
+  ByteArray out{42};
+  EXPECT_OUTCOME_TRUE_1(encodeTo(out, Buffer{1, 2}, uint16_t{3}));
+  ASSERT_EQ(out, (ByteArray{42, 2 << 2, 1, 2, 3, 0}));
+  ASSERT_EQ(out.capacity(), out.size());
+}
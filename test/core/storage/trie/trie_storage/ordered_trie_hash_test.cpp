@@ -6,6 +6,8 @@
 #include "storage/trie/serialization/ordered_trie_hash.hpp"
 
 #include <gtest/gtest.h>
+#include "storage/trie/polkadot_trie/polkadot_trie_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
 #include "testutil/literals.hpp"
 #include "testutil/outcome.hpp"
 
@@ -64,3 +66,89 @@ TEST(OrderedTrieHash, TwoValueVectorErr2) {
   ASSERT_EQ(kagome::common::hex_lower(val),
             "5147323d593b7bb01fe8ea3e9d5a4bba0497c7f47b5daa121f4a6d791164d60b");
 }
+
+namespace {
+  using kagome::common::Buffer;
+
+  /// Root of the trie built by PolkadotTrieImpl, which serves as a reference
+  Buffer referenceRoot(const std::vector<std::pair<Buffer, Buffer>> &pairs) {
+    kagome::storage::trie::PolkadotCodec codec;
+    if (pairs.empty()) {
+      return Buffer{codec.hash256({0})};
+    }
+    kagome::storage::trie::PolkadotTrieImpl trie;
+    for (auto &[key, value] : pairs) {
+      EXPECT_OUTCOME_TRUE_1(trie.put(key, value));
+    }
+    EXPECT_OUTCOME_TRUE(enc, codec.encodeNode(*trie.getRoot()));
+    return Buffer{codec.hash256(enc)};
+  }
+}  // namespace
+
+/**
+ * @given value lists of sizes around the bounds of compact encoding
+ * categories, where the order of keys differs from the order of values
+ * @when calculating their ordered trie hash
+ * @then it matches the root of the trie filled with the same values
+ */
+TEST(OrderedTrieHash, MatchesTrieRoot) {
+  for (size_t size : {1, 2, 17, 63, 64, 65, 300, 16384, 16385}) {
+    std::vector<Buffer> vals;
+    std::vector<std::pair<Buffer, Buffer>> pairs;
+    for (size_t i = 0; i < size; ++i) {
+      // values both shorter and longer than a hash
+      vals.emplace_back(i % 40, static_cast<uint8_t>(i));
+      pairs.emplace_back(
+          Buffer{kagome::scale::encode(kagome::scale::CompactInteger{i})
+                     .value()},
+          vals.back());
+    }
+    EXPECT_OUTCOME_TRUE(val,
+                        kagome::storage::trie::calculateOrderedTrieHash(
+                            vals.begin(), vals.end()));
+    EXPECT_EQ(val, referenceRoot(pairs)) << size << " values";
+  }
+}
+
+/**
+ * @given unordered key-value pairs including an empty key, keys which are
+ * prefixes of others, a partial key of more than 63 nibbles and a repeated
+ * key
+ * @when calculating their trie hash
+ * @then it matches the root of the trie filled with the same pairs
+ */
+TEST(OrderedTrieHash, MatchesTrieRootOfPairs) {
+  std::vector<std::pair<Buffer, Buffer>> pairs{
+      {"abc"_buf, "1"_buf},
+      {"ab"_buf, "2"_buf},
+      {""_buf, "3"_buf},
+      {"b"_buf, Buffer(100, 4)},
+      {"abd"_buf, ""_buf},
+      {Buffer(40, 'x'), "5"_buf},
+      {Buffer(40, 'x').put("y"), "6"_buf},
+      {"ab"_buf, "7"_buf},
+  };
+  EXPECT_OUTCOME_TRUE(val,
+                      kagome::storage::trie::calculateTrieHash(pairs.begin(),
+                                                               pairs.end()));
+  EXPECT_EQ(val, referenceRoot(pairs));
+
+  std::vector<std::pair<Buffer, Buffer>> none;
+  EXPECT_OUTCOME_TRUE(empty,
+                      kagome::storage::trie::calculateTrieHash(none.begin(),
+                                                               none.end()));
+  EXPECT_EQ(empty, referenceRoot(none));
+}
+
+/**
+ * @given a trie root builder
+ * @when a key which is not greater than the previous one is pushed
+ * @then an error is returned
+ */
+TEST(TrieRootBuilder, UnsortedKeys) {
+  kagome::storage::trie::TrieRootBuilder builder;
+  EXPECT_OUTCOME_TRUE_1(builder.push("ab"_buf, "1"_buf));
+  EXPECT_OUTCOME_FALSE_1(builder.push("a"_buf, "2"_buf));
+  EXPECT_OUTCOME_FALSE_1(builder.push("ab"_buf, "2"_buf));
+  EXPECT_OUTCOME_FALSE_1(builder.push("aa"_buf, "2"_buf));
+}
@@ -33,6 +33,25 @@ TEST_P(NodeDecodingTest, GetHeader) {
   EXPECT_EQ(decoded_node->value, node->value);
 }
 
+/**
+ * @given encoded node stored in a larger buffer
+ * @when decode the node from the part of the buffer it occupies
+ * @then the node is decoded the same as from a separate buffer
+ */
+TEST_P(NodeDecodingTest, DecodesFromSpan) {
+  auto node = GetParam();
+
+  EXPECT_OUTCOME_TRUE(encoded, codec->encodeNode(*node));
+  Buffer storage{0xff};
+  storage.put(encoded);
+  EXPECT_OUTCOME_TRUE(
+      decoded,
+      codec->decodeNode(gsl::make_span(storage).subspan(1, encoded.size())));
+  auto decoded_node = std::dynamic_pointer_cast<PolkadotNode>(decoded);
+  EXPECT_EQ(decoded_node->key_nibbles, node->key_nibbles);
+  EXPECT_EQ(decoded_node->value, node->value);
+}
+
 template <typename T>
 std::shared_ptr<PolkadotNode> make(const common::Buffer &key_nibbles,
                                    const common::Buffer &value) {
@@ -59,6 +78,7 @@ using T = PolkadotNode::Type;
 static const std::vector<std::shared_ptr<PolkadotNode>> CASES = {
     make<LeafNode>("010203"_hex2buf, "abcdef"_hex2buf),
     make<LeafNode>("0a0b0c"_hex2buf, "abcdef"_hex2buf),
+    make<LeafNode>("0a0b0c0d"_hex2buf, "abcdef"_hex2buf),
     make<BranchNode>("010203"_hex2buf, "abcdef"_hex2buf),
     branch_with_2_children};
 
@@ -0,0 +1,245 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "transaction_pool/impl/pool_maintainer.hpp"
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/post.hpp>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "crypto/hasher/hasher_impl.hpp"
+#include "mock/core/application/app_state_manager_mock.hpp"
+#include "mock/core/blockchain/block_tree_mock.hpp"
+#include "mock/core/runtime/tagged_transaction_queue_mock.hpp"
+#include "mock/core/transaction_pool/transaction_pool_mock.hpp"
+#include "scale/scale.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::application::AppStateManagerMock;
+using kagome::blockchain::BlockTreeMock;
+using kagome::common::Buffer;
+using kagome::crypto::HasherImpl;
+using kagome::primitives::BlockBody;
+using kagome::primitives::BlockHash;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::BlockId;
+using kagome::primitives::BlockInfo;
+using kagome::primitives::Extrinsic;
+using kagome::primitives::InvalidTransaction;
+using kagome::primitives::Transaction;
+using kagome::primitives::TransactionValidity;
+using kagome::primitives::TransactionValidityError;
+using kagome::primitives::ValidTransaction;
+using kagome::primitives::events::ChainEventType;
+using kagome::primitives::events::ChainSubscriptionEngine;
+using kagome::primitives::events::ExtrinsicSubscriptionEngine;
+using kagome::runtime::TaggedTransactionQueueMock;
+using kagome::subscription::ExtrinsicEventKeyRepository;
+using kagome::transaction_pool::PoolMaintainer;
+using kagome::transaction_pool::TransactionPoolMock;
+
+using testing::_;
+using testing::AllOf;
+using testing::Field;
+using testing::InvokeWithoutArgs;
+using testing::NiceMock;
+using testing::Return;
+
+class PoolMaintainerTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    ON_CALL(*pool_, getPendingTransactions())
+        .WillByDefault(testing::ReturnPointee(&pending_));
+    ON_CALL(*pool_, removeStale(_))
+        .WillByDefault(Return(std::vector<Transaction>{}));
+
+    best_header_.number = 1;
+    best_header_.state_root = "best state"_hash256;
+    EXPECT_CALL(*block_tree_, deepestLeaf())
+        .WillOnce(Return(BlockInfo{1, hash(best_header_)}));
+    EXPECT_CALL(*block_tree_, getBlockHeader(BlockId{hash(best_header_)}))
+        .WillOnce(Return(best_header_));
+
+    maintainer_ = std::make_shared<PoolMaintainer>(app_state_manager_,
+                                                   pool_,
+                                                   block_tree_,
+                                                   tx_queue_,
+                                                   hasher_,
+                                                   chain_sub_engine_,
+                                                   ext_sub_engine_,
+                                                   ext_key_repo_,
+                                                   io_context_);
+    ASSERT_TRUE(maintainer_->prepare());
+    ASSERT_TRUE(maintainer_->start());
+  }
+
+  void TearDown() override {
+    maintainer_->stop();
+  }
+
+  BlockHash hash(const BlockHeader &header) const {
+    return hasher_->blake2b_256(kagome::scale::encode(header).value());
+  }
+
+  /**
+   * Notifies about a new head, which is the best block, and waits for
+   * maintenance to be done
+   */
+  void importBestBlock(const BlockHeader &header) {
+    EXPECT_CALL(*block_tree_, deepestLeaf())
+        .WillRepeatedly(Return(BlockInfo{header.number, hash(header)}));
+    chain_sub_engine_->notify(ChainEventType::kNewHeads, header);
+    // maintenance itself, validation in chunks and applying of its result
+    auto work_guard = boost::asio::make_work_guard(*io_context_);
+    io_context_->run_for(std::chrono::milliseconds(100));
+  }
+
+ protected:
+  std::shared_ptr<AppStateManagerMock> app_state_manager_ =
+      std::make_shared<NiceMock<AppStateManagerMock>>();
+  std::shared_ptr<TransactionPoolMock> pool_ =
+      std::make_shared<NiceMock<TransactionPoolMock>>();
+  std::shared_ptr<BlockTreeMock> block_tree_ =
+      std::make_shared<BlockTreeMock>();
+  std::shared_ptr<TaggedTransactionQueueMock> tx_queue_ =
+      std::make_shared<TaggedTransactionQueueMock>();
+  std::shared_ptr<HasherImpl> hasher_ = std::make_shared<HasherImpl>();
+  std::shared_ptr<ChainSubscriptionEngine> chain_sub_engine_ =
+      std::make_shared<ChainSubscriptionEngine>();
+  std::shared_ptr<ExtrinsicSubscriptionEngine> ext_sub_engine_ =
+      std::make_shared<ExtrinsicSubscriptionEngine>();
+  std::shared_ptr<ExtrinsicEventKeyRepository> ext_key_repo_ =
+      std::make_shared<ExtrinsicEventKeyRepository>();
+  std::shared_ptr<boost::asio::io_context> io_context_ =
+      std::make_shared<boost::asio::io_context>();
+
+  std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>> pending_;
+  BlockHeader best_header_;
+
+  std::shared_ptr<PoolMaintainer> maintainer_;
+};
+
+/**
+ * @given pool containing transactions
+ * @when new best block is imported @and runtime reports one of transactions
+ * as invalid
+ * @then stale transactions are removed @and transactions are validated at the
+ * state of the new block @and invalid transaction is removed, while the valid
+ * one stays in the pool
+ */
+TEST_F(PoolMaintainerTest, RemovesStaleAndInvalidTransactions) {
+  auto valid_tx = std::make_shared<Transaction>();
+  valid_tx->ext = Extrinsic{Buffer{1}};
+  valid_tx->hash = "valid"_hash256;
+  auto invalid_tx = std::make_shared<Transaction>();
+  invalid_tx->ext = Extrinsic{Buffer{2}};
+  invalid_tx->hash = "invalid"_hash256;
+  pending_.emplace(valid_tx->hash, valid_tx);
+  pending_.emplace(invalid_tx->hash, invalid_tx);
+
+  BlockHeader header;
+  header.number = 2;
+  header.parent_hash = hash(best_header_);
+  header.state_root = "new state"_hash256;
+  EXPECT_CALL(*block_tree_, hasDirectChain(hash(best_header_), hash(header)))
+      .WillOnce(Return(true));
+  EXPECT_CALL(*pool_, removeStale(_))
+      .WillOnce(Return(std::vector<Transaction>{}));
+
+  EXPECT_CALL(*tx_queue_,
+              validate_transaction(header.state_root, _, valid_tx->ext))
+      .WillOnce(Return(TransactionValidity{ValidTransaction{}}));
+  EXPECT_CALL(*tx_queue_,
+              validate_transaction(header.state_root, _, invalid_tx->ext))
+      .WillOnce(Return(TransactionValidity{
+          TransactionValidityError{InvalidTransaction::Stale}}));
+  EXPECT_CALL(*pool_, removeOne("invalid"_hash256))
+      .WillOnce(Return(*invalid_tx));
+  EXPECT_CALL(*pool_, removeOne("valid"_hash256)).Times(0);
+
+  importBestBlock(header);
+}
+
+/**
+ * @given best block with extrinsic
+ * @when block of another fork becomes the best
+ * @then extrinsic of the retracted block is validated and returned to the pool
+ */
+TEST_F(PoolMaintainerTest, ReturnsExtrinsicsOfRetractedBlocks) {
+  Extrinsic ext{Buffer{1, 2, 3}};
+  auto old_best = hash(best_header_);
+
+  BlockHeader header;
+  header.number = 2;
+  header.parent_hash = "fork"_hash256;
+  header.state_root = "fork state"_hash256;
+  EXPECT_CALL(*block_tree_, hasDirectChain(old_best, hash(header)))
+      .WillOnce(Return(false));
+  EXPECT_CALL(*block_tree_, getBlockHeader(BlockId{old_best}))
+      .WillOnce(Return(best_header_));
+  EXPECT_CALL(*block_tree_, getBlockBody(BlockId{old_best}))
+      .WillOnce(Return(BlockBody{ext}));
+  EXPECT_CALL(*block_tree_, hasDirectChain(best_header_.parent_hash, _))
+      .WillOnce(Return(true));
+
+  ValidTransaction validity;
+  validity.priority = 42;
+  EXPECT_CALL(*tx_queue_, validate_transaction(header.state_root, _, ext))
+      .WillOnce(Return(TransactionValidity{validity}));
+  EXPECT_CALL(*pool_,
+              submitOne(AllOf(Field(&Transaction::hash,
+                                    hasher_->blake2b_256(ext.data)),
+                              Field(&Transaction::priority, 42))))
+      .WillOnce(Return(outcome::success()));
+
+  importBestBlock(header);
+}
+
+/**
+ * @given pool containing more transactions than are validated at once
+ * @when new best block is imported
+ * @then transactions are validated in chunks, so that a handler queued in
+ * io_context meanwhile runs after the first chunk, before the rest
+ */
+TEST_F(PoolMaintainerTest, ValidatesInChunks) {
+  constexpr size_t kTransactions = PoolMaintainer::kRevalidationChunkSize + 1;
+  for (size_t i = 0; i < kTransactions; ++i) {
+    auto tx = std::make_shared<Transaction>();
+    tx->ext = Extrinsic{Buffer{static_cast<uint8_t>(i)}};
+    tx->hash[0] = static_cast<uint8_t>(i);
+    pending_.emplace(tx->hash, tx);
+  }
+
+  BlockHeader header;
+  header.number = 2;
+  header.parent_hash = hash(best_header_);
+  EXPECT_CALL(*block_tree_, hasDirectChain(hash(best_header_), hash(header)))
+      .WillOnce(Return(true));
+
+  size_t validated = 0;
+  EXPECT_CALL(*tx_queue_, validate_transaction(header.state_root, _, _))
+      .Times(kTransactions)
+      .WillRepeatedly(InvokeWithoutArgs([&validated] {
+        ++validated;
+        return TransactionValidity{ValidTransaction{}};
+      }));
+
+  EXPECT_CALL(*block_tree_, deepestLeaf())
+      .WillRepeatedly(Return(BlockInfo{header.number, hash(header)}));
+  chain_sub_engine_->notify(ChainEventType::kNewHeads, header);
+  size_t validated_before_handler = 0;
+  boost::asio::post(*io_context_,
+                    [&] { validated_before_handler = validated; });
+  io_context_->run_for(std::chrono::milliseconds(100));
+
+  EXPECT_EQ(validated_before_handler, PoolMaintainer::kRevalidationChunkSize);
+  EXPECT_EQ(validated, kTransactions);
+}
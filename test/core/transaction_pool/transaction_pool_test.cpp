@@ -5,6 +5,8 @@
 
 #include "transaction_pool/impl/transaction_pool_impl.hpp"
 
+#include <thread>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "mock/core/blockchain/block_header_repository_mock.hpp"
@@ -147,3 +149,65 @@ TEST_F(TransactionPoolTest, CorrectRemoveTx) {
     EXPECT_EQ(outcome.error(), TransactionPoolError::TX_NOT_FOUND);
   }
 }
+
+/**
+ * @given transactions of different priorities
+ * @when import them to the pool
+ * @then ready transactions are returned from the highest priority, and in order
+ * of import among transactions of the same priority
+ */
+TEST_F(TransactionPoolTest, ReadyTransactionsOrderedByPriority) {
+  std::vector<Transaction> txs{makeTx("01"_hash256, {{1}}, {}),
+                               makeTx("02"_hash256, {{2}}, {}),
+                               makeTx("03"_hash256, {{3}}, {})};
+  txs[0].priority = 1;
+  txs[1].priority = 5;
+  txs[2].priority = 5;
+
+  EXPECT_OUTCOME_TRUE_1(pool_->submit(txs));
+
+  auto hashes = [this] {
+    std::vector<Hash256> hashes;
+    for (const auto &tx : pool_->getBestReadyTransactions()) {
+      hashes.push_back(tx->hash);
+    }
+    return hashes;
+  };
+  EXPECT_EQ(hashes(),
+            (std::vector<Hash256>{"02"_hash256, "03"_hash256, "01"_hash256}));
+
+  // the taken transactions stay valid while the pool changes
+  auto ready = pool_->getBestReadyTransactions();
+
+  // removing transaction keeps order of the rest
+  EXPECT_OUTCOME_TRUE_1(pool_->removeOne("02"_hash256));
+  EXPECT_EQ(hashes(), (std::vector<Hash256>{"03"_hash256, "01"_hash256}));
+  ASSERT_EQ(ready.size(), 3);
+  EXPECT_EQ(ready.front()->hash, "02"_hash256);
+}
+
+/**
+ * @given transactions submitted to and removed from the pool by one thread
+ * @when another thread takes the ready transactions meanwhile, as the block
+ * proposer does
+ * @then every taken transaction stays readable
+ */
+TEST_F(TransactionPoolTest, TakesReadyTransactionsWhileChanged) {
+  std::thread changer([this] {
+    for (uint8_t i = 0; i < 200; ++i) {
+      Hash256 hash;
+      hash.fill(i);
+      EXPECT_OUTCOME_TRUE_1(pool_->submitOne(makeTx(hash, {{i}}, {})));
+      EXPECT_OUTCOME_TRUE_1(pool_->removeOne(hash));
+    }
+  });
+
+  for (size_t round = 0; round < 1000; ++round) {
+    for (const auto &tx : pool_->getBestReadyTransactions()) {
+      EXPECT_EQ(tx->provides.size(), 1);
+    }
+  }
+  changer.join();
+
+  EXPECT_EQ(pool_->getStatus().ready_num, 0);
+}
@@ -27,12 +27,35 @@ namespace kagome::api {
                            const boost::optional<common::Buffer> &,
                            const boost::optional<primitives::BlockHash> &));
 
+    MOCK_CONST_METHOD2(getPairs,
+                       outcome::result<KeyValuePairs>(
+                           const common::Buffer &,
+                           const boost::optional<primitives::BlockHash> &));
+
+    MOCK_CONST_METHOD4(getPairsPaged,
+                       outcome::result<KeyValuePairs>(
+                           const boost::optional<common::Buffer> &,
+                           uint32_t,
+                           const boost::optional<common::Buffer> &,
+                           const boost::optional<primitives::BlockHash> &));
+
     MOCK_CONST_METHOD1(
         getStorage, outcome::result<common::Buffer>(const common::Buffer &key));
     MOCK_CONST_METHOD2(
         getStorage,
         outcome::result<common::Buffer>(const common::Buffer &key,
                                         const primitives::BlockHash &at));
+    MOCK_CONST_METHOD3(
+        queryStorage,
+        outcome::result<std::vector<primitives::StorageChangeSet>>(
+            const std::vector<common::Buffer> &keys,
+            const primitives::BlockHash &from,
+            const boost::optional<primitives::BlockHash> &to));
+    MOCK_CONST_METHOD2(
+        queryStorageAt,
+        outcome::result<std::vector<primitives::StorageChangeSet>>(
+            const std::vector<common::Buffer> &keys,
+            const boost::optional<primitives::BlockHash> &at));
 
     MOCK_METHOD1(
         subscribeStorage,
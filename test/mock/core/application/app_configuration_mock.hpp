@@ -52,14 +52,20 @@ namespace kagome::application {
 
     MOCK_CONST_METHOD0(maxWsConnections, uint32_t());
 
+    MOCK_CONST_METHOD0(wsOutboundConfig, const api::WsOutboundConfig &());
+
     MOCK_CONST_METHOD0(verbosity, log::Level());
 
     MOCK_CONST_METHOD0(maxBlocksInResponse, uint32_t());
 
     MOCK_CONST_METHOD0(peeringConfig, const network::PeeringConfig &());
 
+    MOCK_CONST_METHOD0(threadingConfig, const ThreadingConfig &());
+
     MOCK_CONST_METHOD0(isRunInDevMode, bool());
 
+    MOCK_CONST_METHOD0(isRuntimeProfilingEnabled, bool());
+
     MOCK_CONST_METHOD0(nodeName, const std::string &());
   };
 
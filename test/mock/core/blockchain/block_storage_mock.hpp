@@ -22,6 +22,15 @@ namespace kagome::blockchain {
     MOCK_METHOD1(setLastFinalizedBlockHash,
                  outcome::result<void>(const primitives::BlockHash &));
 
+    MOCK_CONST_METHOD1(
+        getEpochDigests,
+        outcome::result<boost::optional<consensus::EpochDigests>>(
+            const primitives::BlockHash &));
+
+    MOCK_METHOD2(putEpochDigests,
+                 outcome::result<void>(const primitives::BlockHash &,
+                                       const consensus::EpochDigests &));
+
     MOCK_CONST_METHOD1(
         getBlockHeader,
         outcome::result<primitives::BlockHeader>(const primitives::BlockId &));
@@ -56,6 +65,9 @@ namespace kagome::blockchain {
                                        const primitives::BlockHash &,
                                        const primitives::BlockNumber &));
 
+    MOCK_METHOD1(assignNumberToHash,
+                 outcome::result<void>(const primitives::BlockInfo &));
+
     MOCK_METHOD2(removeBlock,
                  outcome::result<void>(const primitives::BlockHash &,
                                        const primitives::BlockNumber &));
@@ -35,6 +35,9 @@ namespace kagome::consensus::grandpa {
     MOCK_METHOD1(onProposal, void(const SignedMessage &));
     MOCK_METHOD1(onPrevote, void(const SignedMessage &));
     MOCK_METHOD1(onPrecommit, void(const SignedMessage &));
+    MOCK_METHOD1(onVerifiedVote, void(const SignedMessage &));
+    MOCK_CONST_METHOD0(voteCryptoProvider,
+                       std::shared_ptr<VoteCryptoProvider>());
     MOCK_METHOD2(applyJustification,
                  outcome::result<void>(const BlockInfo &,
                                        const GrandpaJustification &));
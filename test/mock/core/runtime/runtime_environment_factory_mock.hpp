@@ -31,6 +31,13 @@ namespace kagome::runtime::binaryen {
                  outcome::result<RuntimeEnvironment>(
                      const storage::trie::RootHash &state_root));
 
+    MOCK_METHOD2(getCodeHash,
+                 outcome::result<common::Hash256>(
+                     const boost::optional<storage::trie::RootHash> &,
+                     const Config &));
+
+    MOCK_CONST_METHOD0(profiler, std::shared_ptr<RuntimeProfiler>());
+
     MOCK_METHOD0(reset, void());
   };
 
@@ -16,6 +16,12 @@ namespace kagome::runtime {
                  outcome::result<primitives::TransactionValidity>(
                      primitives::TransactionSource,
                      const primitives::Extrinsic &));
+
+    MOCK_METHOD3(validate_transaction,
+                 outcome::result<primitives::TransactionValidity>(
+                     const storage::trie::RootHash &,
+                     primitives::TransactionSource,
+                     const primitives::Extrinsic &));
   };
 }  // namespace kagome::runtime
 
@@ -0,0 +1,27 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_TEST_MOCK_CORE_RUNTIME_WASM_MODULE_FACTORY_MOCK_HPP
+#define KAGOME_TEST_MOCK_CORE_RUNTIME_WASM_MODULE_FACTORY_MOCK_HPP
+
+#include "runtime/binaryen/module/wasm_module_factory.hpp"
+
+#include <gmock/gmock.h>
+
+namespace kagome::runtime::binaryen {
+
+  class WasmModuleFactoryMock : public WasmModuleFactory {
+   public:
+    MOCK_CONST_METHOD3(
+        createModule,
+        outcome::result<std::unique_ptr<WasmModule>>(
+            const common::Buffer &code,
+            std::shared_ptr<RuntimeExternalInterface> rei,
+            std::shared_ptr<TrieStorageProvider> storage_provider));
+  };
+
+}  // namespace kagome::runtime::binaryen
+
+#endif  // KAGOME_TEST_MOCK_CORE_RUNTIME_WASM_MODULE_FACTORY_MOCK_HPP
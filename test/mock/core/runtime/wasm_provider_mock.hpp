@@ -14,7 +14,8 @@ namespace kagome::runtime {
 
   class WasmProviderMock: public WasmProvider {
    public:
-    MOCK_CONST_METHOD0(getStateCode, const common::Buffer &());
+    MOCK_CONST_METHOD1(getStateCodeAt,
+                       const common::Buffer &(const storage::trie::RootHash &));
   };
 
 }
@@ -16,7 +16,7 @@ namespace kagome::transaction_pool {
    public:
     MOCK_CONST_METHOD0(getPendingTransactions,
                        std::unordered_map<Transaction::Hash,
-                                          std::shared_ptr<Transaction>> &());
+                                          std::shared_ptr<Transaction>>());
 
     outcome::result<void> submitOne(Transaction &&tx) {
       return submitOne(tx);
@@ -31,6 +31,9 @@ namespace kagome::transaction_pool {
         getReadyTransactions,
         std::map<Transaction::Hash, std::shared_ptr<Transaction>>());
 
+    MOCK_CONST_METHOD0(getBestReadyTransactions,
+                       std::vector<std::shared_ptr<const Transaction>>());
+
     MOCK_METHOD1(
         removeStale,
         outcome::result<std::vector<Transaction>>(const primitives::BlockId &));